@@ -13,6 +13,7 @@
 
 class UPrimitiveComponent;
 class UAbleAbilityTargetingFilter;
+class UAbleTargetingIndex;
 
 /* Base class for all our Targeting volumes/types. */
 UCLASS(Abstract, EditInlineNew)
@@ -27,6 +28,9 @@ public:
 
 	/* Override in child classes, this method should find any targets according to the targeting volume/rules.*/
 	virtual void FindTargets(UAbleAbilityContext& Context) const { };
+
+	/* Picks the filters back up if one of them was waiting on async work (see UAbleAbilityContext::HasPendingTargetFilter). If bWait is true, that work is finished immediately. */
+	void ResumeFilterTargets(UAbleAbilityContext& Context, bool bWait = false) const;
 	
 	virtual bool ShouldClearTargets() const;
 
@@ -74,6 +78,12 @@ protected:
 	/* Runs all Targeting Filters. */
 	void FilterTargets(UAbleAbilityContext& Context) const;
 
+	/* Runs the Targeting Filters from StartIndex onward, stopping early if one has to wait on async work. */
+	void RunFilters(UAbleAbilityContext& Context, int32 StartIndex) const;
+
+	/* Returns the Targeting Index if we can use it, and takes the object types it answers for (OutIndexedObjectTypes) out of ObjectQuery. Whatever is left still needs a physics query. */
+	const UAbleTargetingIndex* GetTargetingIndex(const UAbleAbilityContext& Context, FCollisionObjectQueryParams& ObjectQuery, int32& OutIndexedObjectTypes) const;
+
 	/* If true, the targeting range will be automatically calculated using shape, rotation, and offset information. This does not include socket offsets. */
 	UPROPERTY(EditInstanceOnly, Category = "Targeting|Range", meta = (DisplayName = "Auto-calculate Range"))
 	bool m_AutoCalculateRange;
@@ -118,6 +128,10 @@ protected:
 	*/
 	UPROPERTY(EditInstanceOnly, Category = "Optimization", meta = (DisplayName = "Use Async"))
 	bool m_UseAsync;
+
+	/* If true, and the world Targeting Index is enabled, any object types it answers for (usually pawns) are looked up there rather than with a physics query. Primitives are tested by their bounds, so results can be slightly looser than physics. */
+	UPROPERTY(EditInstanceOnly, Category = "Optimization", meta = (DisplayName = "Use Targeting Index"))
+	bool m_UseTargetingIndex;
 	
 	/* The Identifier applied to any Dynamic Property methods for this task. This can be used to differentiate multiple tasks of the same type from each other within the same Ability. */
 	UPROPERTY(EditInstanceOnly, Category = "Dynamic Properties", meta = (DisplayName = "Identifier"))
@@ -40,6 +40,9 @@ private:
 	/* Helper method to process all potential results. */
 	void ProcessResults(UAbleAbilityContext& Context, const TArray<struct FOverlapResult>& Results, float _FOV, float _Height, float _Length) const;
 
+	/* Adds any Actors from the Targeting Index that fall within our cone. */
+	void AddIndexedTargets(UAbleAbilityContext& Context, const UAbleTargetingIndex& TargetingIndex, int32 ObjectTypes, const FTransform& QueryTransform, const FVector& QueryLocation, float QueryRadius, float _FOV, float _Height, float _Length) const;
+
 	/* The Field of View (Angle/Azimuth) of the cone, in degrees. Supports Angles greater than 180 degrees. */
 	UPROPERTY(EditInstanceOnly, Category = "Cone", meta = (DisplayName = "FOV", ClampMin=1.0f, ClampMax=360.0f, AbleBindableProperty))
 	float m_FOV; // Azimuth
@@ -25,6 +25,9 @@ public:
 	/* Override and filter out whatever you deem invalid.*/
 	virtual void Filter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase) const;
 
+	/* Called by the Targeting Base while Filter has traces pending on the Context. Finish whatever has come back (or everything, if bWait is set) and clear the traces once done. */
+	virtual void ResumeFilter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase, bool bWait) const {}
+
 #if WITH_EDITOR
 	/* Fix up our flags. */
 	bool FixUpObjectFlags();
@@ -49,6 +52,9 @@ public:
 	/* Sort the Targets by filter in either ascending or descending mode. */
 	virtual void Filter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase) const override;
 
+	/* Sorts the Targets, keeping only the first MaxTargets of them (if MaxTargets > 0). Same result as Filter followed by a Max Targets filter, but only the kept Targets are sorted. */
+	void SortTargets(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase, int32 MaxTargets) const;
+
 protected:
 	/* Helper method to return the location for our distance logic. */
 	FVector GetSourceLocation(const UAbleAbilityContext& Context, EAbleAbilityTargetType SourceType) const;
@@ -129,6 +135,9 @@ public:
 
 	/* Keep all but N Targets.*/
 	virtual void Filter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase) const override;
+
+	/* Returns the Maximum Amount of Targets allowed. */
+	FORCEINLINE int32 GetMaxTargets() const { return m_MaxTargets; }
 protected:
 	/* The Maximum Amount of Targets allowed. */
 	UPROPERTY(EditInstanceOnly, Category = "Filter", meta = (DisplayName = "Max Targets", ClampMin = 1))
@@ -163,9 +172,18 @@ public:
 	UAbleAbilityTargetingFilterLineOfSight(const FObjectInitializer& ObjectInitializer);
 	virtual ~UAbleAbilityTargetingFilterLineOfSight();
 
-	/* Call into the Ability's CustomFilter method. */
+	/* Removes any Target we can't see. */
 	virtual void Filter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase) const override;
+
+	/* Applies any Line of Sight traces that have come back. */
+	virtual void ResumeFilter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase, bool bWait) const override;
 protected:
+	/* Builds the object query and ray start shared by every Target. */
+	void GetTraceParams(const UAbleAbilityContext& Context, FCollisionObjectQueryParams& OutObjectQuery, FVector& OutRaySource) const;
+
+	/* Runs a blocking Line of Sight trace, returns true if Target is blocked. */
+	bool TraceLineOfSight(UWorld* World, const FVector& RaySource, AActor* Target, AActor* SelfActor, const FCollisionObjectQueryParams& ObjectQuery) const;
+
 	// The Location to use as our source for our raycast.
 	UPROPERTY(EditInstanceOnly, Category = "Filter", meta = (DisplayName = "Source Location"))
 	FAbleAbilityTargetTypeLocation m_SourceLocation;
@@ -176,6 +194,10 @@ protected:
 	// The Collision Channels to run the Raycast against.
 	UPROPERTY(EditInstanceOnly, Category = "Filter", meta = (DisplayName = "Collision Channels"))
 	TArray<TEnumAsByte<ESPAbleTraceType>> m_CollisionChannels;
+
+	/* If true, and the Targeting uses Async, every ray is issued as an async trace and the results are applied next frame. */
+	UPROPERTY(EditInstanceOnly, Category = "Optimize", meta = (DisplayName = "Use Async"))
+	bool m_UseAsync;
 };
 
 UCLASS(EditInlineNew, meta = (DisplayName = "Unique Actors", ShortToolTip = "Reduce Collision results to only the unique results based on Actors hit rather than components hit."))
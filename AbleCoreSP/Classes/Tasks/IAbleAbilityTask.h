@@ -61,6 +61,21 @@ public:
 	virtual ~UAbleAbilityTaskScratchPad() { };
 };
 
+/* The Task callbacks that are exposed as BlueprintNativeEvents (OnTaskStartBP, etc), and so may be overridden in Blueprint or Lua. */
+enum class EAbleTaskEvent : uint8
+{
+	OnTaskStart,
+	OnTaskTick,
+	OnTaskEnd,
+	IsDone,
+	OnTaskTickBatched,
+
+	Count
+};
+
+/* Calls one of our EAbleTaskEvent callbacks, going straight to the native _Implementation unless our Class overrides it in Blueprint or Lua. */
+#define ABLE_TASK_EVENT(Event, ...) (IsTaskEventOverridden(EAbleTaskEvent::Event) ? Event##BP(__VA_ARGS__) : Event##BP_Implementation(__VA_ARGS__))
+
 /* Tasks execute a single bit of logic. They are the building blocks of an ability.*/
 UCLASS(Abstract, EditInlineNew, HideCategories="Internal")
 class ABLECORESP_API  UAbleAbilityTask : public UObject
@@ -75,6 +90,7 @@ public:
 	/* UObject override to fix up any properties. */
 	virtual void PostInitProperties() override;
     void PostLoad() override;
+	virtual void PostRename(UObject* OldOuter, const FName OldName) override;
 	virtual UWorld* GetWorld() const override;
 	virtual int32 GetFunctionCallspace(UFunction* Function, FFrame* Stack) override;
 	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
@@ -93,6 +109,12 @@ public:
 	/* Called per tick if NeedsTick returns true. Not called on the 1st frame (OnTaskStart is called instead).*/
 	virtual void OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const;
 
+	/* Called per tick, on a worker thread, for running Tasks that return true from HasThreadSafeTick. All Instances in the World run this
+	 * in parallel, and it is always finished before the Game Thread update (and OnTaskTick) of the same frame. Only read the Context and
+	 * write to this Task's Scratch Pad here - no Blueprint/Script calls, no Object creation. IsDone has not been checked yet this frame.
+	 * Only Components registered with the batched tick manager get this call, so a Task must still be able to finish without it. */
+	virtual void OnTaskTickThreadSafe(const UAbleAbilityContext& Context, float deltaTime) const { }
+
 	/* Called to determine if a Task can end. Default behavior is to see if our context time is > than our end time. */
 	virtual bool IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const;
 
@@ -127,8 +149,11 @@ public:
 	/* Returns whether this Task can be executed Asynchronously or not. */
 	FORCEINLINE virtual bool  IsAsyncFriendly() const { return false; }
 
+	/* Returns whether this Task has work to do in OnTaskTickThreadSafe. Note this is stricter than IsAsyncFriendly. */
+	FORCEINLINE virtual bool  HasThreadSafeTick() const { return false; }
+
 	/* Returns the Task Name Hash. */
-	FORCEINLINE uint32 GetTaskNameHash() const { return FCrc::StrCrc32(*GetName()); }
+	FORCEINLINE uint32 GetTaskNameHash() const { return m_TaskNameHash; }
 	
 	/* Returns the Realm (Client/Server/Both) that this Task is allowed to execute on. */
 	FORCEINLINE virtual EAbleAbilityTaskRealm GetTaskRealm() const { return EAbleAbilityTaskRealm::ATR_Client; }
@@ -139,6 +164,15 @@ public:
 	/* Returns any Tasks we are dependent on. */
 	FORCEINLINE const TArray<const UAbleAbilityTask*>& GetTaskDependencies() const { return m_Dependencies; }
 
+	/* Returns our index in our Segment's Task timeline. Assigned by the Ability in PreExecutionInit. */
+	FORCEINLINE int32 GetTimelineIndex() const { return m_TimelineIndex; }
+
+	/* Returns the timeline indices of the Tasks we are dependent on, INDEX_NONE for any outside of our Segment. */
+	FORCEINLINE const TArray<int32>& GetDependencyTimelineIndices() const { return m_DependencyTimelineIndices; }
+
+	/* Sets our timeline index and the timeline indices of our dependencies. */
+	void SetTimelineIndices(int32 TimelineIndex, TArray<int32>&& DependencyTimelineIndices) { m_TimelineIndex = TimelineIndex; m_DependencyTimelineIndices = MoveTemp(DependencyTimelineIndices); }
+
 	/* Returns whether to run in verbose mode or not. */
 	FORCEINLINE bool IsVerbose() const { return m_Verbose; }
 
@@ -154,6 +188,9 @@ public:
 	/* Called when a Task is about to begin execution. Used to allocate any run-specific memory requirements. */
 	virtual UAbleAbilityTaskScratchPad* CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const { return nullptr; }
 
+	/* Returns the class of Scratchpad CreateScratchPad hands out, if any. Context can be null (e.g. when prewarming the pools). */
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const { return nullptr; }
+
 	/* Returns the StatId for this Task, used by the Profiler. */
 	virtual TStatId GetStatId() const { checkNoEntry(); return TStatId(); }
 
@@ -168,6 +205,9 @@ public:
 
 	virtual void BindDynamicDelegates( UAbleAbility* Ability );
 
+	/* Adds every soft asset this Task references to OutPaths, so the Ability can stream them in ahead of time. By default this picks up any Soft Object properties (and arrays of them). */
+	virtual void GatherSoftAssetReferences(TArray<FSoftObjectPath>& OutPaths) const;
+
 	/* If this Task should be inherited by derived Abilities */
     bool IsInheritable() const { return m_Inheritable; }
 
@@ -336,6 +376,21 @@ protected:
 	
 	EAbleConditionResults CheckConditions(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const;
 
+	/* Returns true if our Class overrides the Event in Blueprint or Lua, in which case it has to be called through reflection. See ABLE_TASK_EVENT. */
+	bool IsTaskEventOverridden(EAbleTaskEvent Event) const;
+
+	/* Same as IsTaskEventOverridden, but doesn't count towards the reflected/direct call stats. */
+	bool HasTaskEventOverride(EAbleTaskEvent Event) const;
+
+	/* Returns the soft asset, loading it synchronously only if the Asset Preload Policy allows it. Use this rather than LoadSynchronous at runtime. */
+	template <typename T>
+	T* ResolveSoftAsset(const TSoftObjectPtr<T>& Asset, const UAbleAbilityContext* Context) const
+	{
+		return Cast<T>(ResolveSoftAssetPath(Asset.ToSoftObjectPath(), Context));
+	}
+
+	UObject* ResolveSoftAssetPath(const FSoftObjectPath& Path, const UAbleAbilityContext* Context) const;
+
 #if !(UE_BUILD_SHIPPING)
 	void PrintVerbose(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const FString& Output) const;
 #endif
@@ -425,6 +480,21 @@ protected:
 
 	UPROPERTY(VisibleAnywhere, Category = "Segment", meta = (DisplayName = "Segment"))
 	int32 m_Segment;
+
+	/* CRC Hash of our Name, kept up to date as we're created/loaded/renamed. */
+	uint32 m_TaskNameHash = 0U;
+
+	/* Our index in our Segment's Task timeline. */
+	int32 m_TimelineIndex = INDEX_NONE;
+
+	/* Timeline indices of our dependencies, so Instances can track them with a bit array rather than a map. */
+	TArray<int32> m_DependencyTimelineIndices;
+
+	/* Bit mask of the EAbleTaskEvents our Class overrides, copied from the per Class cache the first time we need it. */
+	mutable uint8 m_OverriddenTaskEvents = 0U;
+
+	/* The override cache serial m_OverriddenTaskEvents was copied from, 0 if we haven't looked it up yet. */
+	mutable uint32 m_OverriddenTaskEventsSerial = 0U;
 };
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -0,0 +1,347 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#pragma once
+
+#include "ableAbilityContext.h"
+#include "ableAbilityTypes.h"
+#include "ableCollisionFilters.h"
+#include "SPAbilityTask.h"
+#include "UObject/ObjectMacros.h"
+
+#include "SPAbilityCollisionDamageTask.generated.h"
+
+#define LOCTEXT_NAMESPACE "AbleAbilityTask"
+
+/* Shapes supported by the Collision Damage Task. */
+UENUM(BlueprintType)
+enum class ESPAbilityCollisionShape : uint8
+{
+	Box,
+	Sphere,
+	Capsule,
+	Cone,
+	Cylinder
+};
+
+/* Dimensions of a Collision Damage query. Only the fields used by the chosen shape matter. */
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityShapeRange
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Box")
+	FVector HalfExtents = FVector(50.0f, 50.0f, 50.0f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sphere/Capsule")
+	float Radius = 50.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Capsule")
+	float HalfHeight = 100.0f;
+
+	/* Radius of the Cone's base. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cone")
+	float ConeRadius = 100.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cone")
+	float ConeLength = 200.0f;
+
+	/* Anything closer than this (on the horizontal plane) is ignored, which allows for rings. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderInnerRadius = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderOuterRadius = 100.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderHeight = 200.0f;
+
+	/* Angle of the Cylinder slice, in degrees. 360 is the full Cylinder. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder", meta = (ClampMin = 0.0f, ClampMax = 360.0f))
+	float CylinderAngle = 360.0f;
+};
+
+/* How the Collision Damage query grows over the Task. Any Time <= 0 means grow by Velocity every update instead. */
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityShapeRangeGrowth
+{
+	GENERATED_BODY()
+public:
+	/* Box Half Extents growth, reached after ExtentsTime (per axis). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Box")
+	FVector ExtentsVelocity = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Box")
+	FVector ExtentsTime = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sphere/Capsule")
+	float RadiusVelocity = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sphere/Capsule")
+	float RadiusTime = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Capsule")
+	float HeightVelocity = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Capsule")
+	float HeightTime = 0.0f;
+
+	/* Outer radius the Cylinder grows to. Negative shrinks it down to nothing. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderMaxOuterRadius = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderRadiusVelocity = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderRadiusTime = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderHeightVelocity = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cylinder")
+	float CylinderHeightTime = 0.0f;
+};
+
+UCLASS(Transient)
+class ABLECORESP_API USPAbilityCollisionDamageTaskScratchPad : public USPAbilityTaskScratchPad
+{
+	GENERATED_BODY()
+public:
+	USPAbilityCollisionDamageTaskScratchPad();
+	virtual ~USPAbilityCollisionDamageTaskScratchPad();
+
+	/* Clears everything, keeping any allocations around. */
+	void Reset();
+
+	/* Range at the start of the Task (after any Owner scaling). */
+	UPROPERTY(Transient)
+	FSPAbilityShapeRange BaseRange;
+
+	/* Range after any growth. */
+	UPROPERTY(Transient)
+	FSPAbilityShapeRange CurrentRange;
+
+	/* Query Transform, used every tick unless we're following our Query Location. */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Able|Collision Damage")
+	FTransform QueryTransform;
+
+	/* Time into the Task. */
+	UPROPERTY(Transient)
+	float TaskTime = 0.0f;
+
+	/* Time since we last grew our range. */
+	UPROPERTY(Transient)
+	float TimeSinceRangeUpdate = 0.0f;
+
+	/* Set once we've interrupted the Ability or branched, after which we don't interrupt or branch again. */
+	UPROPERTY(Transient)
+	bool Interrupted = false;
+
+	/* Set once we've branched on damage, after which we stop dealing it. */
+	UPROPERTY(Transient)
+	bool DamageStopped = false;
+
+	/* Where we queried last update, we sweep from here when Use Sweep In Detect is set. */
+	UPROPERTY(Transient)
+	FVector PreviousQueryLocation = FVector::ZeroVector;
+
+	UPROPERTY(Transient)
+	bool HasPreviousQuery = false;
+
+	/* Cleared by script once a hit has triggered a "once per collision" Perfect Dodge. */
+	UPROPERTY(Transient, BlueprintReadWrite, Category = "Able|Collision Damage")
+	bool CanTriggerPerfectDodge = true;
+
+	UPROPERTY(Transient)
+	FSPAbilityDamageTargetRecords DamageRecords;
+
+	/* Per tick query/damage results, kept around to avoid re-allocating. */
+	UPROPERTY(Transient)
+	TArray<FAbleQueryResult> QueryResults;
+
+	UPROPERTY(Transient)
+	TArray<FAbleQueryResult> DamageResults;
+};
+
+/*
+* Native version of the Lua Collision Damage Task. Queries a (possibly growing) shape each tick, filters the results,
+* applies per target interval/max count rules and hands whatever is left to OnDamageTargets, which is the only
+* part script needs to provide for game specific damage formulae.
+*/
+UCLASS(EditInlineNew, hidecategories = ("Optimization"))
+class ABLECORESP_API USPAbilityCollisionDamageTask : public USPAbilityTask
+{
+	GENERATED_BODY()
+
+protected:
+	virtual FString GetModuleName_Implementation() const override;
+public:
+	USPAbilityCollisionDamageTask(const FObjectInitializer& ObjectInitializer);
+	virtual ~USPAbilityCollisionDamageTask();
+
+	virtual void OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const override;
+	virtual void OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float DeltaTime) const override;
+	virtual void OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const override;
+
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClassBP_Implementation(const UAbleAbilityContext* Context) const override;
+	virtual void ResetScratchPadBP_Implementation(UAbleAbilityTaskScratchPad* ScratchPad) const override;
+
+	virtual bool IsSingleFrameBP_Implementation() const override { return m_SingleFrame; }
+	virtual EAbleAbilityTaskRealm GetTaskRealmBP_Implementation() const override { return m_TaskRealm; }
+
+	virtual TStatId GetStatId() const override;
+
+	/*
+	* Called with every target that passed our filters and damage rules this update. Our script module builds the
+	* game's damage and hands it to the Instigator's ability damage component, by default this applies m_Damage as Point Damage.
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category = "Able|Collision Damage", meta = (DisplayName = "OnDamageTargets"))
+	void OnDamageTargetsBP(const UAbleAbilityContext* Context, const TArray<FAbleQueryResult>& DamageTargets) const;
+
+	/*
+	* Called the first time we hit anything with Interrupt On Collision set. Our script module routes this through the
+	* Ability Component's InterruptedAbility and starts the Combo Ability, by default this cancels the Ability with Interrupted.
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category = "Able|Collision Damage", meta = (DisplayName = "OnInterrupt"))
+	void OnInterruptBP(const UAbleAbilityContext* Context) const;
+
+#if WITH_EDITOR
+	virtual FText GetTaskCategory() const override { return LOCTEXT("SPAbilityCollisionDamageTaskCategory", "Collision"); }
+	virtual FText GetTaskName() const override { return LOCTEXT("SPAbilityCollisionDamageTask", "Collision Damage"); }
+	virtual FText GetDescriptiveTaskName() const override { return GetTaskName(); }
+	virtual FText GetTaskDescription() const override { return LOCTEXT("SPAbilityCollisionDamageTaskDesc", "Queries a shape every tick and damages whatever is inside, with per target interval and max count rules."); }
+	virtual FLinearColor GetTaskColor() const override { return FLinearColor(226.0f / 255.0f, 60.0f / 255.0f, 60.0f / 255.0f); }
+	virtual float GetEstimatedTaskCost() const override { return UAbleAbilityTask::GetEstimatedTaskCost() + ABLETASK_EST_COLLISION_SIMPLE_QUERY; }
+#endif
+
+protected:
+	/* Grows/queries/damages, the body of every update. */
+	void CollisionAndDamage(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad, bool IsStart) const;
+
+	/* Applies any Owner scaling to our Range. */
+	void InitShapeRange(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const;
+
+	/* Grows our Range based on how far into the Task we are. */
+	void UpdateShapeRange(USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const;
+
+	/* Runs the overlap and our Filters, leaving the results in the Scratch Pad. */
+	void DoCollision(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad, bool IsStart) const;
+
+	/* Applies the interval/max count/dead/attachment rules, leaving the results in the Scratch Pad. */
+	void FilterDamage(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const;
+
+	/* Interrupt/branch on collision. Damage is still applied afterwards, same as the script Task. */
+	void ApplyCollisionEffects(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const;
+
+	/* Branch on damage. */
+	void ApplyDamageEffects(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const;
+
+	/* Shape to query with. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Collision Shape"))
+	ESPAbilityCollisionShape m_CollisionShape;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Shape Range"))
+	FSPAbilityShapeRange m_ShapeRange;
+
+	/* Where to place the query. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Query Location"))
+	FAbleAbilityTargetTypeLocation m_QueryLocation;
+
+	/* If true, the query follows the Query Location every tick. Otherwise it stays where it was when the Task started. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Follow Query Location"))
+	bool m_TickCollisionChange;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Collision Channel Present"))
+	TEnumAsByte<EAbleChannelPresent> m_ChannelPresent;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Collision Channels"))
+	TArray<TEnumAsByte<ESPAbleTraceType>> m_CollisionChannels;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Ignore Self"))
+	bool m_IgnoreSelf;
+
+	/* If true, World Static is always queried (on top of our Collision Channels), so we can find obstacles to branch on. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Use World Static In Types"))
+	bool m_UseWorldStaticInTypes;
+
+	/* If true, the shape is swept from where we queried last update to where it is now, rather than overlapped in place, so fast moving queries don't skip anything. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Use Sweep In Detect"))
+	bool m_UseSweepInDetect;
+
+	UPROPERTY(EditAnywhere, Instanced, Category = "Collision|Filter", meta = (DisplayName = "Filters"))
+	TArray<UAbleCollisionFilter*> m_Filters;
+
+	/* If true, scale our Range by our Owner's scale. */
+	UPROPERTY(EditAnywhere, Category = "Collision|Range", meta = (DisplayName = "Adapt Owner Scale"))
+	bool m_AdaptOwnerScale;
+
+	/* If true, grow our Range over the Task. */
+	UPROPERTY(EditAnywhere, Category = "Collision|Range", meta = (DisplayName = "Update Range"))
+	bool m_UpdateRange;
+
+	UPROPERTY(EditAnywhere, Category = "Collision|Range", meta = (DisplayName = "Range Growth", EditCondition = "m_UpdateRange"))
+	FSPAbilityShapeRangeGrowth m_RangeGrowth;
+
+	/* How often to grow our Range, 0 to grow every update. */
+	UPROPERTY(EditAnywhere, Category = "Collision|Range", meta = (DisplayName = "Range Update Interval", EditCondition = "m_UpdateRange", ClampMin = 0.0f))
+	float m_RangeUpdateInterval;
+
+	/* Damage applied by the default OnDamageTargets. */
+	UPROPERTY(EditAnywhere, Category = "Damage", meta = (DisplayName = "Damage"))
+	float m_Damage;
+
+	/* Damage config our script module sends to the damage component, -1 to use the Ability's damage list at Damage Index. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (DisplayName = "Damage Id"))
+	int32 m_DamageId;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (DisplayName = "Damage Index", ClampMin = 0))
+	int32 m_DamageIndex;
+
+	/* If true, the server's damage is trusted over any client prediction. Always the case when we branch on hit. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (DisplayName = "Damage Force Trust Server"))
+	bool m_DamageForceTrustServer;
+
+	/* If true, never damage the Actor our Owner is attached to (e.g. a Summon riding its target). */
+	UPROPERTY(EditAnywhere, Category = "Damage", meta = (DisplayName = "Skip Summon Attachment Actor Damage"))
+	bool m_SkipSummonAttachmentActorDamage;
+
+	/* Minimum time between hits on the same target, 0 for no limit. */
+	UPROPERTY(EditAnywhere, Category = "Damage", meta = (DisplayName = "Damage Interval", ClampMin = 0.0f))
+	float m_DamageInterval;
+
+	/* Maximum number of hits on the same target, 0 for no limit. */
+	UPROPERTY(EditAnywhere, Category = "Damage", meta = (DisplayName = "Damage Max Count", ClampMin = 0))
+	int32 m_DamageMaxCount;
+
+	/* If true, interrupt the Ability the first time we hit anything (see OnInterrupt). */
+	UPROPERTY(EditAnywhere, Category = "Segment", meta = (DisplayName = "Interrupt On Collision"))
+	bool m_InterruptOnCollision;
+
+	/* Ability to start once we've interrupted, 0 for none. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Segment", meta = (DisplayName = "Combo Ability Id", EditCondition = "m_InterruptOnCollision"))
+	int32 m_ComboAbilityId;
+
+	/* Segment to branch to when we hit World Static geometry. */
+	UPROPERTY(EditAnywhere, Category = "Segment", meta = (DisplayName = "Obstacle Segment"))
+	FName m_ObstacleSegmentName;
+
+	/* If true, branch to Segment Name once we damage something. */
+	UPROPERTY(EditAnywhere, Category = "Segment", meta = (DisplayName = "Hit And Branch Segment"))
+	bool m_HitAndBranchSegment;
+
+	UPROPERTY(EditAnywhere, Category = "Segment", meta = (DisplayName = "Segment Name", EditCondition = "m_HitAndBranchSegment"))
+	FName m_SegmentName;
+
+	/* If true, only branch if we damaged our Target Actor. */
+	UPROPERTY(EditAnywhere, Category = "Segment", meta = (DisplayName = "Branch When Hit Target", EditCondition = "m_HitAndBranchSegment"))
+	bool m_BranchWhenHitTarget;
+
+	/* If true, the Task only runs once on start. */
+	UPROPERTY(EditAnywhere, Category = "Realm", meta = (DisplayName = "Single Frame"))
+	bool m_SingleFrame;
+
+	UPROPERTY(EditAnywhere, Category = "Realm", meta = (DisplayName = "Realm"))
+	TEnumAsByte<EAbleAbilityTaskRealm> m_TaskRealm;
+};
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,318 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#pragma once
+
+#include "ableAbilityContext.h"
+#include "ableAbilityTypes.h"
+#include "ableCollisionFilters.h"
+#include "Engine/EngineTypes.h"
+#include "SPAbilityTask.h"
+#include "UObject/ObjectMacros.h"
+
+#include "SPAbilityLaserTask.generated.h"
+
+#define LOCTEXT_NAMESPACE "AbleAbilityTask"
+
+class UCurveFloat;
+class UParticleSystem;
+class UParticleSystemComponent;
+
+UCLASS(Transient)
+class ABLECORESP_API USPAbilityLaserTaskScratchPad : public USPAbilityTaskScratchPad
+{
+	GENERATED_BODY()
+public:
+	USPAbilityLaserTaskScratchPad();
+	virtual ~USPAbilityLaserTaskScratchPad();
+
+	/* Clears everything, keeping any allocations around. */
+	void Reset();
+
+	/* Beam origin/orientation, the rotation is replaced by the sweep rotation when sweeping. */
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Able|Laser")
+	FTransform QueryTransform;
+
+	/* Sweep rotations, calculated once on start. */
+	UPROPERTY(Transient)
+	FRotator SweepStartRotation;
+
+	UPROPERTY(Transient)
+	FRotator SweepEndRotation;
+
+	/* Beam pose from our last query, we sweep from here to the current pose. */
+	UPROPERTY(Transient)
+	FVector PreviousBeamStart;
+
+	UPROPERTY(Transient)
+	FQuat PreviousBeamRotation;
+
+	UPROPERTY(Transient)
+	bool HasPreviousBeam = false;
+
+	/* False if we were asked to sweep but had nothing to sweep towards. */
+	UPROPERTY(Transient)
+	bool IsSweeping = false;
+
+	/* Time into the Task. */
+	UPROPERTY(Transient)
+	float TaskTime = 0.0f;
+
+	/* Where the beam stopped this update, only valid if HasHitPoint. */
+	UPROPERTY(Transient)
+	FVector HitPoint;
+
+	UPROPERTY(Transient)
+	FVector HitNormal;
+
+	UPROPERTY(Transient)
+	bool HasHitPoint = false;
+
+	UPROPERTY(Transient)
+	bool HitPointIsBody = false;
+
+	/* Particle spawn transform, used every tick unless we're following our Particle Location. */
+	UPROPERTY(Transient)
+	FTransform ParticleTransform;
+
+	UPROPERTY(Transient)
+	bool HasParticleTransform = false;
+
+	/* Spawned once and then moved around, rather than re-spawned every tick. */
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UParticleSystemComponent> BeamEffect;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UParticleSystemComponent> HitBodyEffect;
+
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UParticleSystemComponent> HitSceneEffect;
+
+	/* Cleared by script once a hit has triggered a "once per collision" Perfect Dodge. */
+	UPROPERTY(Transient, BlueprintReadWrite, Category = "Able|Laser")
+	bool CanTriggerPerfectDodge = true;
+
+	UPROPERTY(Transient)
+	FSPAbilityDamageTargetRecords DamageRecords;
+
+	/* Per tick query/damage results, kept around to avoid re-allocating. */
+	UPROPERTY(Transient)
+	TArray<FAbleQueryResult> QueryResults;
+
+	UPROPERTY(Transient)
+	TArray<FAbleQueryResult> StepResults;
+
+	UPROPERTY(Transient)
+	TArray<FAbleQueryResult> DamageResults;
+
+	TArray<FHitResult> StepHits;
+};
+
+/*
+* Native version of the Lua Laser Task. Casts a beam from the Query Location (optionally sweeping it across the first
+* Target over the Task), damages whatever it hits on an interval and keeps the beam/hit effects lined up with it.
+* The beam is swept from its previous pose to its current one each update, so fast sweeps or low frame rates don't
+* skip over anything in between.
+*/
+UCLASS(EditInlineNew, hidecategories = ("Optimization"))
+class ABLECORESP_API USPAbilityLaserTask : public USPAbilityTask
+{
+	GENERATED_BODY()
+
+protected:
+	virtual FString GetModuleName_Implementation() const override;
+public:
+	USPAbilityLaserTask(const FObjectInitializer& ObjectInitializer);
+	virtual ~USPAbilityLaserTask();
+
+	virtual void OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const override;
+	virtual void OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float DeltaTime) const override;
+	virtual void OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const override;
+
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClassBP_Implementation(const UAbleAbilityContext* Context) const override;
+	virtual void ResetScratchPadBP_Implementation(UAbleAbilityTaskScratchPad* ScratchPad) const override;
+
+	virtual EAbleAbilityTaskRealm GetTaskRealmBP_Implementation() const override { return EAbleAbilityTaskRealm::ATR_ClientAndServer; }
+
+	virtual TStatId GetStatId() const override;
+
+	/*
+	* Called with every target the beam damaged this update. Our script module builds the game's damage and hands it
+	* to the Instigator's ability damage component, by default this applies m_Damage as Point Damage.
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category = "Able|Laser", meta = (DisplayName = "OnDamageTargets"))
+	void OnDamageTargetsBP(const UAbleAbilityContext* Context, const TArray<FAbleQueryResult>& DamageTargets) const;
+
+#if WITH_EDITOR
+	virtual FText GetTaskCategory() const override { return LOCTEXT("SPAbilityLaserTaskCategory", "Collision"); }
+	virtual FText GetTaskName() const override { return LOCTEXT("SPAbilityLaserTask", "Laser"); }
+	virtual FText GetDescriptiveTaskName() const override { return GetTaskName(); }
+	virtual FText GetTaskDescription() const override { return LOCTEXT("SPAbilityLaserTaskDesc", "Casts a (possibly sweeping) beam every tick, damaging what it hits and keeping its effects lined up with it."); }
+	virtual FLinearColor GetTaskColor() const override { return FLinearColor(226.0f / 255.0f, 120.0f / 255.0f, 60.0f / 255.0f); }
+	virtual float GetEstimatedTaskCost() const override { return UAbleAbilityTask::GetEstimatedTaskCost() + ABLETASK_EST_COLLISION_SIMPLE_QUERY; }
+#endif
+
+protected:
+	/* Moves/queries/damages and updates our effects, the body of every update. */
+	void CollisionAndDamage(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, bool IsStart) const;
+
+	/* Works out the sweep start/end rotations from our first Target. */
+	void InitSweep(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const;
+
+	/* Updates the beam origin and orientation. */
+	void UpdateBeamTransform(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, bool IsStart) const;
+
+	/* Sweeps the beam from its previous pose to its current one, leaving the results in the Scratch Pad. */
+	void DoQuery(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const;
+
+	/* Casts the beam at a single pose, leaving the sorted and filtered results in StepResults/StepHits. */
+	void QueryBeam(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, UWorld& World, const FVector& Start, const FQuat& Rotation,
+		const FCollisionObjectQueryParams& ObjectQuery, const FCollisionQueryParams& QueryParams) const;
+
+	/* Applies the interval rule, leaving the results in the Scratch Pad. */
+	void FilterDamage(USPAbilityLaserTaskScratchPad& ScratchPad) const;
+
+	/* Spawns our beam effect on start, afterwards just moves it. */
+	void SpawnOrUpdateBeamEffect(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, bool IsStart) const;
+
+	/* Spawns our hit effects, or moves them if they're already around. */
+	void SpawnOrUpdateHitEffect(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const;
+
+	/* Stops all our effects and plays the ending effect, if we have one. */
+	void StopEffects(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const;
+
+	/* Returns the transform our beam effects should use, with the scale already applied. */
+	FTransform GetParticleTransform(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, float& OutLengthScale) const;
+
+	/* Spawns the Template at the Transform, attached to our Query Location socket if we're set to. */
+	UParticleSystemComponent* SpawnBeamEmitter(const UAbleAbilityContext& Context, UParticleSystem* Template, const FTransform& Transform) const;
+
+	/* Where the beam starts. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Query Location"))
+	FAbleAbilityTargetTypeLocation m_QueryLocation;
+
+	/* If true, the beam follows the Query Location every tick. Otherwise it stays where it was when the Task started. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Follow Query Location"))
+	bool m_TickCollisionChange;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Beam Length", ClampMin = 0.0f))
+	float m_BeamLength;
+
+	/* Radius of the beam, 0 for a line trace. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Beam Radius", ClampMin = 0.0f))
+	float m_BeamRadius;
+
+	/* Most queries we'll do between the previous and current beam pose in a single update. */
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Max Sweep Steps", ClampMin = 1))
+	int32 m_MaxSweepSteps;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Collision Channel Present"))
+	TEnumAsByte<EAbleChannelPresent> m_ChannelPresent;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Collision Channels"))
+	TArray<TEnumAsByte<ESPAbleTraceType>> m_CollisionChannels;
+
+	UPROPERTY(EditAnywhere, Category = "Collision", meta = (DisplayName = "Ignore Self"))
+	bool m_IgnoreSelf;
+
+	UPROPERTY(EditAnywhere, Instanced, Category = "Collision|Filter", meta = (DisplayName = "Filters"))
+	TArray<UAbleCollisionFilter*> m_Filters;
+
+	/* If true, the beam sweeps from just in front of us to past our first Target over the Task, and damages everything it touches. */
+	UPROPERTY(EditAnywhere, Category = "Sweep", meta = (DisplayName = "Is Sweeping"))
+	bool m_IsSweeping;
+
+	/* Distance (past our collision radius) towards our Target the sweep starts at. */
+	UPROPERTY(EditAnywhere, Category = "Sweep", meta = (DisplayName = "Sweep Start Length", EditCondition = "m_IsSweeping"))
+	float m_SweepStartLength;
+
+	/* Distance the sweep covers. */
+	UPROPERTY(EditAnywhere, Category = "Sweep", meta = (DisplayName = "Sweep Length", EditCondition = "m_IsSweeping"))
+	float m_SweepLength;
+
+	/* Optional remap of the sweep progress, both axes normalized. */
+	UPROPERTY(EditAnywhere, Category = "Sweep", meta = (DisplayName = "Sweep Change Curve", EditCondition = "m_IsSweeping"))
+	UCurveFloat* m_SweepChangeCurve;
+
+	/* Added to the beam rotation for the beam effect. */
+	UPROPERTY(EditAnywhere, Category = "Sweep", meta = (DisplayName = "Sweep Rotator Offset", EditCondition = "m_IsSweeping"))
+	FRotator m_SweepRotatorOffset;
+
+	/* Damage applied by the default OnDamageTargets. */
+	UPROPERTY(EditAnywhere, Category = "Damage", meta = (DisplayName = "Damage"))
+	float m_Damage;
+
+	/* Damage config our script module sends to the damage component, -1 to use the Ability's damage list at Damage Index. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (DisplayName = "Damage Id"))
+	int32 m_DamageId;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (DisplayName = "Damage Index", ClampMin = 0))
+	int32 m_DamageIndex;
+
+	/* If true, the server's damage is trusted over any client prediction. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Damage", meta = (DisplayName = "Damage Force Trust Server"))
+	bool m_DamageForceTrustServer;
+
+	/* Minimum time between hits on the same target, 0 for no limit. */
+	UPROPERTY(EditAnywhere, Category = "Damage", meta = (DisplayName = "Damage Interval", ClampMin = 0.0f))
+	float m_DamageInterval;
+
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Effect Template"))
+	UParticleSystem* m_EffectTemplate;
+
+	/* Where the beam effect is spawned. */
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Particle Location"))
+	FAbleAbilityTargetTypeLocation m_ParticleLocation;
+
+	/* If true, the beam effect follows the Particle Location every tick. */
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Follow Particle Location"))
+	bool m_TickParticleChange;
+
+	/* If true, effects are attached to the Query Location socket. */
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Attach To Socket"))
+	bool m_AttachToSocket;
+
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Scale"))
+	float m_Scale;
+
+	/* Which axes use the beam length scale rather than Scale. */
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Length Scale X"))
+	bool m_CanEditScaleX;
+
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Length Scale Y"))
+	bool m_CanEditScaleY;
+
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Length Scale Z"))
+	bool m_CanEditScaleZ;
+
+	/* Beam length the effect was authored at, 0 to never scale the effect. */
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Particle Normalize Length", ClampMin = 0.0f))
+	float m_ParticleNormalizeLength;
+
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Particle Max Length", ClampMin = 0.0f))
+	float m_ParticleMaxLength;
+
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Render Sort Priority"))
+	int32 m_RenderSortPriority;
+
+	/* If true, the beam effect is detached before it's deactivated, so it finishes in place. */
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Detach On Stop"))
+	bool m_DetachOnStop;
+
+	/* Played where the beam hits a Pawn. */
+	UPROPERTY(EditAnywhere, Category = "Particle|Hit", meta = (DisplayName = "Hit Body Effect Template"))
+	UParticleSystem* m_HitBodyEffectTemplate;
+
+	/* Played where the beam hits anything else. */
+	UPROPERTY(EditAnywhere, Category = "Particle|Hit", meta = (DisplayName = "Hit Scene Effect Template"))
+	UParticleSystem* m_HitSceneEffectTemplate;
+
+	/* If true, the hit effect is rotated to face along the hit normal. */
+	UPROPERTY(EditAnywhere, Category = "Particle|Hit", meta = (DisplayName = "Align Hit Effect To Normal"))
+	bool m_AlignHitEffectToNormal;
+
+	/* Played on the client once the Task ends. */
+	UPROPERTY(EditAnywhere, Category = "Particle", meta = (DisplayName = "Ending Effect Template"))
+	UParticleSystem* m_EndingEffectTemplate;
+};
+
+#undef LOCTEXT_NAMESPACE
@@ -10,6 +10,183 @@
 
 #define LOCTEXT_NAMESPACE "AbleAbilityTask"
 
+class UParticleSystem;
+class USPAbilityTaskScratchPad;
+
+/* Everything a script Task usually asks for each tick, gathered up front so it can be handed over in a single call. */
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityTaskTickSnapshot
+{
+	GENERATED_BODY()
+public:
+	/* Resets the Snapshot, keeping any allocations around for the next tick. */
+	void Reset();
+
+	/* Our Self Actor. */
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	AActor* Owner = nullptr;
+
+	/* Our Instigator, or our Owner if we don't have one. */
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	AActor* Instigator = nullptr;
+
+	/* Transform of our Owner. */
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	FTransform OwnerTransform;
+
+	/* The Actors for our Task Targets. */
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	TArray<AActor*> Targets;
+
+	/* Our Scratch Pad for this Context, if we have one. */
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	USPAbilityTaskScratchPad* ScratchPad = nullptr;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	float DeltaTime = 0.0f;
+
+	/* Current time of the Ability. */
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	float AbilityTime = 0.0f;
+
+	/* How far into the Task we are. */
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	float TaskTime = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	int32 AbilityId = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Able|Custom Task")
+	int32 AbilityUniqueID = 0;
+
+	/* Scratch space for gathering Targets, kept with the Snapshot so it's reused from tick to tick. */
+	TArray<TWeakObjectPtr<AActor>> TargetBuffer;
+};
+
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityTaskIntParameterCommand
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	int32 Value = 0;
+};
+
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityTaskFloatParameterCommand
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	float Value = 0.0f;
+};
+
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityTaskDamageCommand
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	AActor* Target = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	float Damage = 0.0f;
+
+	/* Where the hit happened, used for the Shot Direction. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	FVector HitLocation = FVector::ZeroVector;
+};
+
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityTaskEffectCommand
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	UParticleSystem* Template = nullptr;
+
+	/* World Transform, or relative Transform if AttachTo is set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	FTransform Transform;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	AActor* AttachTo = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	FName SocketName;
+};
+
+/* Work a script Task wants done this tick. Filled out in OnTaskTickBatched and applied natively afterwards. */
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FSPAbilityTaskCommandBuffer
+{
+	GENERATED_BODY()
+public:
+	/* Resets the Buffer, keeping any allocations around for the next tick. */
+	void Reset();
+
+	/* Returns the total number of commands in the Buffer. */
+	int32 Num() const { return IntParameters.Num() + FloatParameters.Num() + Damage.Num() + Effects.Num() + BranchSegments.Num(); }
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	TArray<FSPAbilityTaskIntParameterCommand> IntParameters;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	TArray<FSPAbilityTaskFloatParameterCommand> FloatParameters;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	TArray<FSPAbilityTaskDamageCommand> Damage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	TArray<FSPAbilityTaskEffectCommand> Effects;
+
+	/* Segments to branch to, in order. We stop at the first successful branch. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Able|Custom Task")
+	TArray<FName> BranchSegments;
+};
+
+/* Per target damage bookkeeping for our damage dealing Tasks. */
+USTRUCT()
+struct ABLECORESP_API FSPAbilityDamageTargetRecord
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Transient)
+	TWeakObjectPtr<AActor> Actor;
+
+	/* Task time we last damaged this Actor. */
+	UPROPERTY(Transient)
+	float LastDamageTime = 0.0f;
+
+	UPROPERTY(Transient)
+	int32 DamageCount = 0;
+};
+
+/* Damage records for every target a Task has hit, kept as a flat array since we rarely have more than a handful of targets. */
+USTRUCT()
+struct ABLECORESP_API FSPAbilityDamageTargetRecords
+{
+	GENERATED_BODY()
+public:
+	/* Clears all records, keeping the allocation around. */
+	void Reset() { Records.Reset(); }
+
+	/* Returns the record for the Actor, adding one if needed. */
+	FSPAbilityDamageTargetRecord& FindOrAdd(AActor* Actor);
+
+	/* Returns the record for the Actor, if we have one. */
+	const FSPAbilityDamageTargetRecord* Find(const AActor* Actor) const;
+
+	UPROPERTY(Transient)
+	TArray<FSPAbilityDamageTargetRecord> Records;
+};
+
 UCLASS(Blueprintable, Transient)
 class ABLECORESP_API USPAbilityTaskScratchPad : public UAbleAbilityTaskScratchPad, public IUnLuaInterface
 {
@@ -19,6 +196,14 @@ public:
 	virtual ~USPAbilityTaskScratchPad();
 
 	virtual bool SkipObjectReferencer_Implementation() const override;
+
+	/* Reused by OnTaskTickBatched each tick, so we don't re-allocate. */
+	UPROPERTY(Transient)
+	FSPAbilityTaskTickSnapshot TickSnapshot;
+
+	/* Reused by OnTaskTickBatched each tick, so we don't re-allocate. */
+	UPROPERTY(Transient)
+	FSPAbilityTaskCommandBuffer TickCommands;
 };
 
 UCLASS(Abstract, Blueprintable, EditInlineNew, hidecategories = ("Optimization"))
@@ -46,6 +231,14 @@ public:
 	UFUNCTION(BlueprintNativeEvent, meta=(DisplayName="OnTaskTick"))
 	void OnTaskTickBP(const UAbleAbilityContext* Context, float DeltaTime) const;
 
+	/* 
+	* Batched alternative to OnTaskTick. If this is overridden it is called instead of OnTaskTick, with everything the Task
+	* usually needs already gathered into Snapshot. Anything the Task wants done goes into Commands, which we apply natively
+	* once it returns, so script Tasks only cross into script once per tick.
+	*/
+	UFUNCTION(BlueprintNativeEvent, meta = (DisplayName = "OnTaskTickBatched"))
+	void OnTaskTickBatchedBP(const UAbleAbilityContext* Context, const FSPAbilityTaskTickSnapshot& Snapshot, FSPAbilityTaskCommandBuffer& Commands) const;
+
 	virtual void OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const override;
 
 	UFUNCTION(BlueprintNativeEvent, meta = (DisplayName = "OnTaskEnd"))
@@ -56,7 +249,7 @@ public:
 	UFUNCTION(BlueprintNativeEvent, meta = (DisplayName = "IsDone"))
 	bool IsDoneBP(const UAbleAbilityContext* Context) const;
 
-	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const;
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const override;
 
 	UFUNCTION(BlueprintNativeEvent, meta = (DisplayName = "GetTaskScratchPadClass"))
 	TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClassBP(const UAbleAbilityContext* Context) const;
@@ -83,6 +276,24 @@ public:
 
 	virtual EAbleAbilityTaskRealm GetTaskRealm() const override;
 
+protected:
+	/* Gathers the Snapshot, calls OnTaskTickBatched, and applies the resulting Commands. */
+	void TickBatched(const UAbleAbilityContext& Context, float DeltaTime) const;
+
+	/* Fills out the Snapshot for this tick. */
+	virtual void GatherTickSnapshot(const UAbleAbilityContext& Context, float DeltaTime, FSPAbilityTaskTickSnapshot& OutSnapshot) const;
+
+	/* Applies everything in the Command Buffer. */
+	virtual void ApplyTickCommands(const UAbleAbilityContext& Context, const FSPAbilityTaskCommandBuffer& Commands) const;
+
+	/* Applies any Damage commands. By default this goes through AActor::TakeDamage, override to route it through your own damage system. */
+	virtual void ApplyDamageCommands(const UAbleAbilityContext& Context, const TArray<FSPAbilityTaskDamageCommand>& Commands) const;
+
+	/* Returns true if the Actor has a GetIsDead function and it says so, the same check our script Tasks do. */
+	static bool IsActorDead(const AActor* Actor);
+
+public:
+
 	UFUNCTION(BlueprintNativeEvent, meta = (DisplayName = "GetTaskRealm"))
 	EAbleAbilityTaskRealm GetTaskRealmBP() const;
 
@@ -77,6 +77,9 @@ public:
 	/* Create the Scratchpad for this Task. */
 	virtual UAbleAbilityTaskScratchPad* CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const;
 
+	/* Returns the class of Scratchpad this Task uses, if any. */
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const;
+
 	/* Return the Profiler Stat Id for this Task. */
 	virtual TStatId GetStatId() const override;
 
@@ -110,6 +110,9 @@ public:
 	/* Perform our filter logic. */
 	virtual void Filter(const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const;
 
+	/* Returns true if the Actor should be removed by this filter. */
+	bool ShouldRemove(const AActor* Actor) const;
+
 #if WITH_EDITOR
 	/* Data Validation Tests. */
     virtual EDataValidationResult IsTaskDataValid(const UAbleAbility* AbilityContext, const FText& AssetName, TArray<FText>& ValidationErrors);
@@ -144,6 +147,15 @@ public:
 
 	/* Bind any Dynamic Delegates. */
 	virtual void BindDynamicDelegates(class UAbleAbility* Ability) override;
+
+	/* Returns the Location we measure distance from. */
+	FVector GetSourceLocation(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const;
+
+	/* Returns true if we sort nearest first. */
+	FORCEINLINE bool IsAscending() const { return m_SortDirection == EAbleCollisionFilterSort::AbleFitlerSort_Ascending; }
+
+	/* Returns true if we only use the XY distance. */
+	FORCEINLINE bool GetUse2DDistance() const { return m_Use2DDistance; }
 #if WITH_EDITOR
 	/* Data Validation Tests. */
     virtual EDataValidationResult IsTaskDataValid(const UAbleAbility* AbilityContext, const FText& AssetName, TArray<FText>& ValidationErrors);
@@ -176,6 +188,9 @@ public:
 	/* Perform our filter logic. */
 	virtual void Filter(const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const;
 
+	/* Returns the Max Entities to keep. */
+	FORCEINLINE int32 GetMaxEntities() const { return m_MaxEntities; }
+
 #if WITH_EDITOR
 	/* Data Validation Tests. */
     virtual EDataValidationResult IsTaskDataValid(const UAbleAbility* AbilityContext, const FText& AssetName, TArray<FText>& ValidationErrors);
@@ -221,6 +236,9 @@ public:
 
 	virtual void Filter(const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const;
 
+	/* Returns true if the Target should be removed, based on its attitude towards the Self Actor. */
+	bool ShouldRemove(const AActor* SelfActor, const AActor* Target) const;
+
 #if WITH_EDITOR
 	virtual EDataValidationResult IsAbilityDataValid(const UAbleAbility* AbilityContext, TArray<FText>& ValidationErrors);
 #endif
@@ -277,4 +295,82 @@ public:
 #endif
 };
 
+/* Pass types of a compiled filter list. */
+enum class EAbleCollisionFilterPass : uint8
+{
+	Predicates,		// A run of simple keep/remove filters, evaluated together in one pass.
+	Sort,			// Sort by Distance.
+	Limit,			// Max Results.
+	SortAndLimit,	// Sort by Distance directly followed by Max Results, only the nearest (or furthest) are ever sorted.
+	Opaque			// Anything else (Custom, Line of Sight, Script filters, ...), runs its own Filter.
+};
+
+/* Keep/remove filters we know how to evaluate inline. */
+enum class EAbleCollisionFilterPredicate : uint8
+{
+	Self,
+	Owner,
+	Instigator,
+	ByClass,
+	TeamAttitude
+};
+
+/**
+* A Collision Filter list flattened into passes. Consecutive keep/remove filters run as a single pass over the results, resolving
+* each Actor once, and Sort by Distance + Max Results only orders the entries that are kept. Only the exact native filter classes are
+* compiled, any subclass (or any other filter) is kept as an opaque pass and runs through its own Filter call.
+*
+* Build it once the filters are loaded (BindDynamicDelegates), it holds raw pointers to the filters and is read-only afterwards.
+* Instanced copies of a Task never bind their delegates, so Run compiles for whatever filter list it's handed the first time it sees it.
+*/
+struct ABLECORESP_API FAbleCollisionFilterProgram
+{
+	/* Rebuilds our passes from the provided filters. */
+	void Compile(const TArray<UAbleCollisionFilter*>& Filters);
+
+	/* Runs all our passes, same results as calling Filter on each filter in turn. */
+	void Execute(const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const;
+
+	/* Runs Filters through our passes, compiling them first if we weren't built from them. Off the game thread, an uncompiled list just calls Filter on each filter in turn. */
+	void Run(const TArray<UAbleCollisionFilter*>& Filters, const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray);
+
+	/* Returns true if we were compiled from exactly these filters. */
+	bool IsCompiledFor(const TArray<UAbleCollisionFilter*>& Filters) const;
+
+	/* Returns true if there is nothing to run. */
+	FORCEINLINE bool IsEmpty() const { return m_Passes.Num() == 0; }
+
+private:
+	struct FPredicate
+	{
+		EAbleCollisionFilterPredicate Type;
+		const UAbleCollisionFilter* Filter;
+	};
+
+	struct FPass
+	{
+		EAbleCollisionFilterPass Type;
+
+		/* Sort, Limit or Opaque filter. For SortAndLimit, this is the Sort. */
+		const UAbleCollisionFilter* Filter;
+
+		/* Our range in m_Predicates. */
+		int32 FirstPredicate;
+		int32 NumPredicates;
+
+		/* Max Results, 0 = no limit. */
+		int32 Limit;
+	};
+
+	void ExecutePredicates(const FPass& Pass, const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const;
+	void ExecuteSort(const FPass& Pass, const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const;
+
+	TArray<FPass> m_Passes;
+	TArray<FPredicate> m_Predicates;
+
+	/* The filter list we were compiled from. */
+	TArray<UAbleCollisionFilter*> m_Source;
+	bool m_IsCompiled = false;
+};
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
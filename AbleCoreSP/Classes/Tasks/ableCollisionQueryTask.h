@@ -89,6 +89,9 @@ public:
 	/* Creates the Scratchpad for our Task. */
 	virtual UAbleAbilityTaskScratchPad* CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const;
 
+	/* Returns the class of Scratchpad this Task uses, if any. */
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const;
+
 	/* Returns the Profiler Stat ID for our Task. */
 	virtual TStatId GetStatId() const override;
 
@@ -165,6 +168,9 @@ protected:
 	UPROPERTY(EditAnywhere, Instanced, Category = "Query|Filter", meta = (DisplayName = "Filters"))
 	TArray<UAbleCollisionFilter*> m_Filters;
 
+	/* m_Filters compiled into passes, built when we bind our delegates (or on first use, for instanced copies). */
+	mutable FAbleCollisionFilterProgram m_FilterProgram;
+
 	/* If true, the results of the query will be added to the Target Actor Array in the Ability Context. Note this takes 1 full frame to complete.*/
 	UPROPERTY(EditAnywhere, Category = "Query|Misc", meta = (DisplayName = "Copy to Context"))
 	bool m_CopyResultsToContext;
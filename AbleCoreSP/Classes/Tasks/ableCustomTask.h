@@ -115,7 +115,7 @@ public:
 	*
 	* @return The class to use for the Scratchpad of this Task (https://able.extralifestudios.com/wiki/index.php/Task_Scratchpad)
 	*/
-	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const;
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const override;
 
 	/**
 	* Gets the Scratchpad Class of this Task.
@@ -91,6 +91,9 @@ public:
 	/* Creates the Scratchpad for this Task. */
 	virtual UAbleAbilityTaskScratchPad* CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const;
 
+	/* Returns the class of Scratchpad this Task uses, if any. */
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const;
+
 	virtual bool IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const;
 
 	UFUNCTION(BlueprintNativeEvent, meta = (DisplayName = "IsDone"))
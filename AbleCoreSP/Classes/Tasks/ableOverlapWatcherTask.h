@@ -93,6 +93,9 @@ public:
     /* Create the Scratchpad for this Task. */
     virtual UAbleAbilityTaskScratchPad* CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const;
 
+    /* Returns the class of Scratchpad this Task uses, if any. */
+    virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const;
+
 #if WITH_EDITOR
 	/* Returns the category of this Task. */
 	virtual FText GetTaskCategory() const override { return LOCTEXT("AbleOverlapWatcherCategory", "Blueprint|Collision"); }
@@ -137,6 +140,9 @@ private:
 
 	/* Helper that does the actual checks.*/
     void CheckForOverlaps(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const;
+
+	/* Bind our dynamic delegates. */
+	virtual void BindDynamicDelegates(UAbleAbility* Ability) override;
 protected:
 
     /* If true, we'll fire the OnCollisionEvent in the Ability Blueprint. */
@@ -154,6 +160,9 @@ protected:
     UPROPERTY(EditAnywhere, Instanced, Category = "Query|Filter", meta = (DisplayName = "Filters"))
     TArray<UAbleCollisionFilter*> m_Filters;
 
+	/* m_Filters compiled into passes, built when we bind our delegates (or on first use, for instanced copies). */
+	mutable FAbleCollisionFilterProgram m_FilterProgram;
+
     /* If true, the results of the query will be added to the Target Actor Array in the Ability Context. Note this takes 1 full frame to complete.*/
     UPROPERTY(EditAnywhere, Category = "Query|Misc", meta = (DisplayName = "Copy to Context"))
     bool m_CopyResultsToContext;
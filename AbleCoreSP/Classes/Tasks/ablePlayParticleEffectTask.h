@@ -84,6 +84,9 @@ public:
 
 	/* Creates the Scratchpad for our Task. */
 	virtual UAbleAbilityTaskScratchPad* CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const override;
+
+	/* Returns the class of Scratchpad this Task uses, if any. */
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const override;
 	
 	/* Returns the Profiler Stat ID of our Task. */
 	virtual TStatId GetStatId() const override;
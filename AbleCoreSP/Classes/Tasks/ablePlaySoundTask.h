@@ -66,6 +66,9 @@ public:
 
 	/* Creates the Scratchpad for this Task. */
 	virtual UAbleAbilityTaskScratchPad* CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const;
+
+	/* Returns the class of Scratchpad this Task uses, if any. */
+	virtual TSubclassOf<UAbleAbilityTaskScratchPad> GetTaskScratchPadClass(const UAbleAbilityContext* Context) const;
 	
 	/* Returns the Profiler Stat ID for our Task. */
 	virtual TStatId GetStatId() const override;
@@ -93,6 +93,10 @@ struct ABLECORESP_API FAbilitySegmentBranchData
 
 	UPROPERTY(VisibleAnywhere)
 	TEnumAsByte<EAbleAbilityTaskRealm> Realm = EAbleAbilityTaskRealm::ATR_ClientAndServer;
+
+	/* Index of the Segment named by NextName, resolved by the Ability at load time. Use UAbleAbility::GetBranchSegmentIndex rather than reading this directly. */
+	UPROPERTY(Transient)
+	mutable int32 NextIndex = INDEX_NONE;
 };
 
 
@@ -168,9 +172,25 @@ public:
 	UPROPERTY(Transient)
 	mutable TArray<const UAbleAbilityTask*> m_AllDependentTasks;
 
-	/* Whether we need to update our dependencies or not. */
+	/* Index into m_Tasks for each entry of m_AllDependentTasks. Per-activation instances use their template's to skip the search. */
+	UPROPERTY(Transient)
+	mutable TArray<int32> m_AllDependentTaskIndices;
+
+	/* Whether we need to update our dependencies or not. Outside of the editor our Tasks never change, so this only happens once. */
 	UPROPERTY(Transient)
-	mutable bool m_DependenciesDirty = false;
+	mutable bool m_DependenciesDirty = true;
+
+	/* Our Tasks sorted by start time, so Instances can walk them with a cursor. Built in PreExecutionInit, mutable for the same reason as above. */
+	UPROPERTY(Transient)
+	mutable TArray<UAbleAbilityTask*> m_TaskTimeline;
+
+	/* Index into m_Tasks for each entry of m_TaskTimeline. Per-activation instances use their template's to skip the sort. */
+	UPROPERTY(Transient)
+	mutable TArray<int32> m_TaskTimelineOrder;
+
+	/* Whether m_TaskTimeline has been built. Outside of the editor our Tasks never change, so this only happens once. */
+	UPROPERTY(Transient)
+	mutable bool m_TaskTimelineBuilt = false;
 
 	UPROPERTY(Transient)
 	TArray<FAbleCompactTaskData> CompactData;
@@ -342,6 +362,21 @@ public:
     
 	/* Returns the Ability Tasks, including inherited Tasks. */
     const TArray<UAbleAbilityTask*> GetTasks(int SegmentIndex) const;
+
+	/* Returns the Segment's Tasks sorted by start time. Only valid after PreExecutionInit. */
+	const TArray<UAbleAbilityTask*>& GetTaskTimeline(int SegmentIndex) const;
+
+	/* Adds every soft asset referenced by our Tasks, across all Segments, to OutPaths. */
+	void GatherSoftAssetReferences(TArray<FSoftObjectPath>& OutPaths) const;
+
+	/**
+	* Starts streaming in every soft asset our Tasks reference, if we haven't already. Call this when the Ability is granted,
+	* otherwise it's done the first time the Ability is queried.
+	*
+	* @return true once everything has loaded.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
+	bool RequestAssetPreload() const;
 	
 	/**
 	* Returns the Ability Name Hash.
@@ -378,6 +413,25 @@ public:
 
 	const int FindSegmentIndexByFName(FName name) const;
 
+	/* Returns the most Tasks any one of our Segments has. Valid once PreExecutionInit has run. */
+	FORCEINLINE int32 GetMaxSegmentTaskCount() const { return m_MaxSegmentTaskCount; }
+
+	/* Returns the most Across Segment Tasks any one of our Segments has. Valid once PreExecutionInit has run. */
+	FORCEINLINE int32 GetNumAcrossSegmentTasks() const { return m_NumAcrossSegmentTasks; }
+
+	/* Returns the Ability we were copied from, or ourselves if we aren't a per-activation instance. */
+	FORCEINLINE const UAbleAbility* GetTemplate() const { return m_Template ? m_Template : this; }
+
+	/* Returns where our declared Context Parameters live inside a Context. */
+	const FAbleContextParameterLayout& GetContextParameterLayout() const { return m_ContextParameterLayout; }
+
+	/* Returns a handle to the declared Context Parameter, or an invalid handle if it wasn't declared. Resolve this once and use it with the Context's ByHandle methods. */
+	UFUNCTION(BlueprintPure, Category = "Able|Ability|Context")
+	FAbleContextParameterHandle FindContextParameterHandle(FName Id) const { return m_ContextParameterLayout.Find(Id); }
+
+	/* Returns the Segment index the Branch leads to, or -1 if it doesn't exist. */
+	int32 GetBranchSegmentIndex(const FAbilitySegmentBranchData& InBranchData) const;
+
 	int FindSpecSegmentIndexByFName(TArray<FAbilitySegmentDefineData>& m_SpecSegments, FName name) const;
 
 	UFUNCTION()
@@ -478,7 +532,7 @@ public:
 	* @return the Ability Tag Container.
 	*/
 	UFUNCTION(BlueprintPure, Category = "Able|Ability")
-	FORCEINLINE FGameplayTagContainer GetAbilityTagContainer() const { return m_TagContainer; }
+	FORCEINLINE const FGameplayTagContainer& GetAbilityTagContainer() const { return m_TagContainer; }
     
 	/**
 	* Returns true if we have the supplied tag in our tag container.
@@ -1438,6 +1492,21 @@ private:
 	/* Helper method to build our Task dependency list. */
 	void BuildDependencyList(const int SegmentIndex) const;
 
+	/* Helper method to build a Segment's Task dependency list from our template's. Returns false if the template's can't be used. */
+	bool CopyDependencyListFromTemplate(const int SegmentIndex) const;
+
+	/* Helper method to build the start time sorted Task list for a Segment. */
+	void BuildTaskTimeline(const int SegmentIndex) const;
+
+	/* Helper method to build a Segment's Task timeline from our template's, rather than sorting it again. Returns false if the template's can't be used. */
+	bool CopyTaskTimelineFromTemplate(const int SegmentIndex) const;
+
+	/* Helper method to build our Segment name lookup and resolve Branch indices. */
+	void BuildSegmentLookup() const;
+
+	/* Helper method to resolve our declared Context Parameters to slots. */
+	void BuildContextParameterLayout() const;
+
 	/* For Ability Dynamic Delegates. */
 	FName GetDynamicDelegateName(const FString& PropertyName) const;
 
@@ -1550,6 +1619,10 @@ private:
 	UPROPERTY(EditDefaultsOnly, Instanced, Category = "Targeting", meta = (DisplayName = "Target Logic"))
 	UAbleTargetingBase* m_Targeting;
 
+	/* Context Parameters this Ability uses. Declared parameters get a fixed slot in the Context, which is much cheaper to read/write than the name lookup used for everything else. */
+	UPROPERTY(EditDefaultsOnly, Category = "Parameters", meta = (DisplayName = "Context Parameters"))
+	TArray<FAbleContextParameterDeclaration> m_ContextParameters;
+
 	/* Time value that allows for passive abilities to automatically decay. 0.0 = No decay */
     UPROPERTY(EditDefaultsOnly, Category = "Stack Decay", meta = (DisplayName = "Stack Decay Time", ClampMin = 0, EditCondition = "m_IsPassive", AbleBindableProperty))
     float m_DecayStackTime;
@@ -1612,6 +1685,28 @@ private:
 	/* Whether we need to update our dependencies or not. */
 	UPROPERTY(Transient)
 	mutable bool m_DependenciesDirty;
+
+	/* Segment Name to Segment index, built at load time so we aren't scanning the Segments by name at runtime. */
+	UPROPERTY(Transient)
+	mutable TMap<FName, int32> m_SegmentIndexByName;
+
+	/* Slots for our declared Context Parameters, built at load time (or on init, for per-activation instances). */
+	mutable FAbleContextParameterLayout m_ContextParameterLayout;
+
+	/* Largest Segment Task count, gathered while building our Task timelines. */
+	mutable int32 m_MaxSegmentTaskCount = 0;
+
+	/* Largest Across Segment Task count in a Segment, gathered while building our Task timelines. */
+	mutable int32 m_NumAcrossSegmentTasks = 0;
+
+	/* Keeps our Task assets streamed in, mutable for the same reason as above. Only used on templates, per-activation instances defer to theirs. */
+	mutable TSharedPtr<struct FStreamableHandle> m_AssetPreloadHandle;
+
+	/* Whether we've gathered and requested our Task assets yet. */
+	mutable bool m_AssetPreloadRequested = false;
+
+	/* The Ability we were copied from, if we're a per-activation instance. Set in Process, and outlives us. */
+	const UAbleAbility* m_Template = nullptr;
 	
 	UPROPERTY(EditDefaultsOnly, Category = "Debug")
 	TArray<FAbilitySegmentDefineData> m_Segments;
@@ -6,6 +6,7 @@
 #include "ableAbilityTypes.h"
 #include "ableAbilityContext.h"
 #include "Components/ActorComponent.h"
+#include "Engine/NetSerialization.h"
 #include "GameplayTagContainer.h"
 #include "GameplayTagAssetInterface.h"
 #include "Tasks/IAbleAbilityTask.h"
@@ -19,8 +20,10 @@
 #define LOCTEXT_NAMESPACE "AbleCore"
 
 class UAbleAbility;
+class UAbleAbilityComponent;
 class USPAbleSettings;
-class FAsyncAbilityCooldownUpdaterTask;
+class UAbleAbilityTickManager;
+class UAbleCooldownManager;
 struct FAnimNode_SPAbilityAnimPlayer;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityStartBP, const UAbleAbilityContext*, Context);
@@ -29,6 +32,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityInterruptBP, const UAbleAb
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityBranchedBP, const UAbleAbilityContext*, Context);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilitySegmentBranchedBP, const UAbleAbilityContext*, Context);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityIterationBP, const UAbleAbilityContext*, Context);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAbilityCooldownExpiredBP, const UAbleAbility*, Ability);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnAbilityStart, const UAbleAbilityContext& /*Context*/);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAbilityEnd, const UAbleAbilityContext& /*Context*/, EAbleAbilityTaskResult /*Result*/);
@@ -36,33 +40,97 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnAbilityInterrupt, const UAbleAbilityConte
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnAbilityBranched, const UAbleAbilityContext& /*Context*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnAbilitySegmentBranched, const UAbleAbilityContext& /*Context*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnAbilityIteration, const UAbleAbilityContext& /*Context*/);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAbilityCooldownExpired, const UAbleAbility& /*Ability*/);
 
-/* Helper struct to keep track of Cooldowns. */
+/* A Passive Ability running on the server, replicated to clients as part of a Fast Array. */
+USTRUCT()
+struct FAbleReplicatedPassiveAbility : public FFastArraySerializerItem
+{
+	GENERATED_USTRUCT_BODY()
+public:
+	FAbleReplicatedPassiveAbility() : AbilityNameHash(0U) {}
+	FAbleReplicatedPassiveAbility(const FAbleAbilityNetworkContext& InContext);
+
+	/* Fast Array callbacks, these run on the client. */
+	void PreReplicatedRemove(const struct FAbleReplicatedPassiveAbilityArray& InArraySerializer);
+	void PostReplicatedAdd(const struct FAbleReplicatedPassiveAbilityArray& InArraySerializer);
+	void PostReplicatedChange(const struct FAbleReplicatedPassiveAbilityArray& InArraySerializer);
+
+	UPROPERTY()
+	FAbleAbilityNetworkContext Context;
+
+	/* Name Hash of our Ability, cached so lookups don't need to touch the Ability. */
+	UPROPERTY(NotReplicated)
+	uint32 AbilityNameHash;
+};
+
+/* Passive Abilities running on the server. Only Passives that were added, removed, or changed are sent. */
+USTRUCT()
+struct FAbleReplicatedPassiveAbilityArray : public FFastArraySerializer
+{
+	GENERATED_USTRUCT_BODY()
+public:
+	FAbleReplicatedPassiveAbilityArray() : Owner(nullptr) {}
+
+	/* Returns the entry for the Ability, if we have one. */
+	FAbleReplicatedPassiveAbility* FindByHash(uint32 AbilityNameHash);
+
+	/* Adds a new Passive, or updates the stack count of an existing one. Only marks things dirty if they actually changed. */
+	void AddOrUpdate(const UAbleAbilityContext& Context, int32 StackCount);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FAbleReplicatedPassiveAbility, FAbleReplicatedPassiveAbilityArray>(Items, DeltaParms, *this);
+	}
+
+	UPROPERTY()
+	TArray<FAbleReplicatedPassiveAbility> Items;
+
+	/* The Component that owns us, for our client callbacks. Set in InitializeComponent, since a property would be copied from our archetype. */
+	UAbleAbilityComponent* Owner;
+};
+
+template<>
+struct TStructOpsTypeTraits<FAbleReplicatedPassiveAbilityArray> : public TStructOpsTypeTraitsBase2<FAbleReplicatedPassiveAbilityArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
+/* Helper struct to keep track of Cooldowns. Times are absolute World time, so nothing needs to count them down. */
 USTRUCT()
 struct FAbleAbilityCooldown
 {
 	GENERATED_USTRUCT_BODY()
 public:
 	FAbleAbilityCooldown();
-	FAbleAbilityCooldown(const UAbleAbility& InAbility, const UAbleAbilityContext& InContext);
+	FAbleAbilityCooldown(const UAbleAbility& InAbility, const UAbleAbilityContext& InContext, float InStartTime);
 
 	/* The Ability tied to this Cooldown. */
 	const UAbleAbility* GetAbility() const { return Ability; }
 
 	/* Returns a value between 0 - 1.0 with how much time is left on the cooldown.*/
-	float getTimeRatio() const { return FMath::Min(CurrentTime / CooldownTime, 1.0f);	}
+	float getTimeRatio(float CurrentTime) const { return CooldownTime > 0.0f ? FMath::Clamp((CurrentTime - StartTime) / CooldownTime, 0.0f, 1.0f) : 1.0f; }
 	
 	/* Returns if the Cooldown is complete or not. */
-	bool IsComplete() const { return CurrentTime > CooldownTime; }
+	bool IsComplete(float CurrentTime) const { return CurrentTime >= GetExpiryTime(); }
 	
-	/* Updates the Cooldown. */
-	void Update(float DeltaTime);
+	/* Re-calculates the Cooldown if the Ability doesn't allow it to be cached. Returns true if the value changed. */
+	bool RefreshCooldownTime();
+
+	/* Returns true if our Ability allows its Cooldown to be cached, otherwise it needs refreshing every frame. */
+	bool CanCacheCooldownTime() const;
 
 	/* Returns the Calculated Cooldown. */
 	float GetCooldownTime() const { return CooldownTime; }
 
 	/* Sets the Cooldown. */
 	void SetCooldownTime(float time) { CooldownTime = time; }
+
+	/* Returns the World time this Cooldown expires at. */
+	float GetExpiryTime() const { return StartTime + CooldownTime; }
 private:
 	/* The Ability for this Cooldown.*/
 	UPROPERTY()
@@ -72,8 +140,8 @@ private:
 	UPROPERTY()
 	const UAbleAbilityContext* Context;
 	
-	/* Current Time on the Cooldown.*/
-	float CurrentTime;
+	/* World time the Cooldown started at.*/
+	float StartTime;
 
 	/* Total Cooldown time. */
 	float CooldownTime;
@@ -102,6 +170,109 @@ private:
 	EAbleAbilityTaskResult ResultToUse;
 };
 
+/* Stable reference to a running Passive Ability. Stays valid while that Passive runs, no matter what else is added or removed, and never aliases a later Passive. */
+USTRUCT(BlueprintType)
+struct FAblePassiveAbilityHandle
+{
+	GENERATED_USTRUCT_BODY()
+public:
+	FAblePassiveAbilityHandle() : Slot(INDEX_NONE), Serial(0) {}
+	FAblePassiveAbilityHandle(int32 InSlot, int32 InSerial) : Slot(InSlot), Serial(InSerial) {}
+
+	/* Returns true if this handle was ever assigned, use the Component to check if it still refers to a running Passive. */
+	bool IsSet() const { return Slot != INDEX_NONE; }
+
+	bool operator==(const FAblePassiveAbilityHandle& Other) const { return Slot == Other.Slot && Serial == Other.Serial; }
+	bool operator!=(const FAblePassiveAbilityHandle& Other) const { return !(*this == Other); }
+
+	UPROPERTY()
+	int32 Slot;
+
+	UPROPERTY()
+	int32 Serial;
+};
+
+/* Indirection entry for FAblePassiveAbilityInstanceArray, maps a handle slot to where the Instance currently lives. */
+struct FAblePassiveAbilitySlot
+{
+	FAblePassiveAbilitySlot() : DenseIndex(INDEX_NONE), Serial(0) {}
+
+	/* Index into the dense Instance array, INDEX_NONE if the slot is free. */
+	int32 DenseIndex;
+
+	/* Bumped every time the slot is freed, so old handles stop resolving. */
+	int32 Serial;
+};
+
+/**
+* Slot map of running Passive Ability Instances. Instances are kept densely packed in activation (and update) order and indexed by Ability Name Hash,
+* handles go through a slot table so they survive removals shifting the Instances down. Removed Instances are reset in place and reused by the next Passive.
+*/
+USTRUCT()
+struct FAblePassiveAbilityInstanceArray
+{
+	GENERATED_USTRUCT_BODY()
+public:
+	/* Number of running Passives. */
+	FORCEINLINE int32 Num() const { return Instances.Num(); }
+
+	/* Dense access, for update loops. */
+	FORCEINLINE UAbleAbilityInstance* operator[](int32 Index) const { return Instances[Index]; }
+
+	/* Ranged-for support, iterates in update order. */
+	FORCEINLINE TArray<UAbleAbilityInstance*>::RangedForConstIteratorType begin() const { return Instances.begin(); }
+	FORCEINLINE TArray<UAbleAbilityInstance*>::RangedForConstIteratorType end() const { return Instances.end(); }
+
+	/* Returns the dense index of the Passive for this Ability, or INDEX_NONE. */
+	FORCEINLINE int32 IndexOfHash(uint32 AbilityNameHash) const
+	{
+		const int32* Found = HashToIndex.Find(AbilityNameHash);
+		return Found ? *Found : INDEX_NONE;
+	}
+
+	/* Returns the Passive for this Ability, if it's running. */
+	FORCEINLINE UAbleAbilityInstance* FindByHash(uint32 AbilityNameHash) const
+	{
+		const int32 Index = IndexOfHash(AbilityNameHash);
+		return Index != INDEX_NONE ? Instances[Index] : nullptr;
+	}
+
+	/* Returns the handle of the Passive at the provided dense index. */
+	FAblePassiveAbilityHandle GetHandle(int32 Index) const;
+
+	/* Returns the Passive the handle refers to, or null if it has since been removed. */
+	UAbleAbilityInstance* Resolve(const FAblePassiveAbilityHandle& Handle) const;
+
+	/* Adds an Initialized Instance, returns its handle. */
+	FAblePassiveAbilityHandle Add(UAbleAbilityInstance* Instance);
+
+	/* Removes the Passive at the dense index (shifting the later ones down) and returns it. The Instance must already be stopped. */
+	UAbleAbilityInstance* RemoveAt(int32 Index);
+
+	/* Removes every Passive. Instances must already be stopped and released. */
+	void Empty();
+
+private:
+	/* Running Instances, densely packed. */
+	UPROPERTY(Transient)
+	TArray<UAbleAbilityInstance*> Instances;
+
+	/* Slot of each dense entry, parallel to Instances. */
+	TArray<int32> IndexToSlot;
+
+	/* Ability Name Hash of each dense entry, parallel to Instances. */
+	TArray<uint32> IndexToHash;
+
+	/* Handle slots. */
+	TArray<FAblePassiveAbilitySlot> Slots;
+
+	/* Free entries in Slots. */
+	TArray<int32> FreeSlots;
+
+	/* Ability Name Hash to dense index of its oldest Instance. */
+	TMap<uint32, int32> HashToIndex;
+};
+
 UCLASS(ClassGroup = Able, hidecategories = (Internal, Activation, Collision), meta = (DisplayName = "Ability Component", ShortToolTip = "A component for playing active and passive abilities."))
 class ABLECORESP_API UAbleAbilityComponent : public UActorComponent, public IGameplayTagAssetInterface
 {
@@ -110,6 +281,7 @@ public:
 	UAbleAbilityComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	// UActorComponent Overrides
+	virtual void InitializeComponent() override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
@@ -186,6 +358,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
 	bool IsPlayingAbility() const { return m_ActiveAbilityInstance != nullptr && m_ActiveAbilityInstance->IsValid(); }
 
+	/**
+	* Returns whether or not the component is dormant, meaning it has nothing that needs a per frame update and isn't ticking.
+	* Cooldowns alone don't keep a component awake.
+	*
+	* @return true if we are not currently ticking, false otherwise.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
+	bool IsDormant() const { return m_IsDormant; }
+
 	/**
 	* If you've set up your Animation Blueprint to use the AbilityAnimPlayer Graph Node,
 	* this method will tell you if you have a Play Animation Task requesting you to use transition to that node.
@@ -254,6 +435,48 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
 	int32 GetTotalNumberOfPassives() const { return m_PassiveAbilityInstances.Num(); }
 
+	/**
+	* Returns a handle to the running Passive for this Ability. The handle stays valid for as long as that Passive runs, and is cheaper to use than the Ability itself.
+	*
+	* @param Ability The Passive Ability to find.
+	*
+	* @return the handle, or an unset handle if the Passive isn't running.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
+	FAblePassiveAbilityHandle GetPassiveAbilityHandle(const UAbleAbility* Ability) const;
+
+	/**
+	* Returns whether or not the Passive a handle refers to is still running.
+	*
+	* @param Handle The Passive handle to check.
+	*
+	* @return true if the Passive is still running, false otherwise.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
+	bool IsPassiveAbilityHandleValid(const FAblePassiveAbilityHandle& Handle) const { return m_PassiveAbilityInstances.Resolve(Handle) != nullptr; }
+
+	/**
+	* Returns the stack count of the Passive a handle refers to.
+	*
+	* @param Handle The Passive handle to check.
+	*
+	* @return the stack count, or 0 if the Passive is no longer running.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
+	int32 GetPassiveStackCountByHandle(const FAblePassiveAbilityHandle& Handle) const;
+
+	/**
+	* Cancels the Passive a handle refers to, if it's still running.
+	*
+	* @param Handle The Passive handle to cancel.
+	* @param ResultToUse The result to pass along to the Ability.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability")
+	void CancelPassiveAbilityByHandle(const FAblePassiveAbilityHandle& Handle, EAbleAbilityTaskResult ResultToUse);
+
+	/* Returns the Passive Instance a handle refers to, or null if it is no longer running. */
+	UAbleAbilityInstance* ResolvePassiveAbilityHandle(const FAblePassiveAbilityHandle& Handle) const { return m_PassiveAbilityInstances.Resolve(Handle); }
+
 	/**
 	* Returns the specific stack count for the passed in passive ability, or 0 if not found.
 	*
@@ -359,7 +582,7 @@ public:
 	/* Returns the Gameplay Tag Container. */
 	const FGameplayTagContainer& GetGameplayTagContainer() const { return m_TagContainer; }
 	
-	/* Returns all Cooldowns, mutable. */
+	/* Returns all Cooldowns, mutable. Re-schedule through SetCooldown rather than editing the expiry time here. */
 	TMap<uint32, FAbleAbilityCooldown>& GetMutableCooldowns() { return m_ActiveCooldowns; }
 	
 	/* Returns all Cooldowns, non-mutable. */
@@ -492,6 +715,9 @@ public:
 	// C++ Delegate
 	FOnAbilityIteration& GetOnAbilityIteration() { return m_AbilityIterationDelegate; }
 
+	// C++ Delegate for Ability Cooldown expiring.
+	FOnAbilityCooldownExpired& GetOnAbilityCooldownExpired() { return m_AbilityCooldownExpiredDelegate; }
+
 	// Ability Animation Node Helper.
 	void SetAbilityAnimationNode(const FAnimNode_SPAbilityAnimPlayer* Node);
 
@@ -535,6 +761,10 @@ public:
 	UPROPERTY(BlueprintAssignable, meta = (DisplayName = "OnAbilityIteration"))
 	FOnAbilityIterationBP AbilityIterationBPDelegate;
 
+	// Blueprint Assignable event that fires when an Ability comes off Cooldown. Not fired for Cooldowns removed with RemoveCooldown.
+	UPROPERTY(BlueprintAssignable, meta = (DisplayName = "OnAbilityCooldownExpired"))
+	FOnAbilityCooldownExpiredBP AbilityCooldownExpiredBPDelegate;
+
 protected:
 	// Server Methods
 	
@@ -590,17 +820,30 @@ protected:
 	UFUNCTION()
 	void OnServerActiveAbilityChanged();
 	
-	/* Called when the number of Passives (or some aspect of the passive) is changed on the Server. */
-	UFUNCTION()
-	void OnServerPassiveAbilitiesChanged();
+	/* Called when a Passive is started on the Server. */
+	void OnServerPassiveAbilityAdded(const FAbleAbilityNetworkContext& ServerPassive);
+
+	/* Called when some aspect of a Passive (e.g. stack count) is changed on the Server. */
+	void OnServerPassiveAbilityChanged(const FAbleAbilityNetworkContext& ServerPassive);
+
+	/* Called when a Passive is removed on the Server. */
+	void OnServerPassiveAbilityRemoved(uint32 AbilityNameHash);
+
+	friend struct FAbleReplicatedPassiveAbility;
 
 	/*UFUNCTION()
 	void OnServerPredictiveKeyChanged();*/
 	////
 
-	/* Checks if this Component still needs to Tick each frame. */
+	/* Checks if this Component still needs to Tick each frame, going dormant (or waking back up) as needed. */
 	virtual void CheckNeedsTick();
 
+	// Friend class so the batched update can drive us directly.
+	friend class UAbleAbilityTickManager;
+
+	/* Updates our Active and Passive Abilities, everything TickComponent does aside from Cooldowns. */
+	void TickAbilities(float DeltaTime);
+
 	/* Returns true if the Component is in the middle of an update. */
 	bool IsProcessingUpdate() const { return m_IsProcessingUpdate; }
 
@@ -622,11 +865,26 @@ protected:
 	/* Attempts to Activate the provided Context and returns the result. */
 	EAbleAbilityStartResult ActivatePassiveAbility(UAbleAbilityContext* Context, bool ServerActivatedAbility = false);
 
-	// Friend class to help call this method via Async task graph.
-	friend class FAsyncAbilityCooldownUpdaterTask;
+	// Friend class so the Cooldown wheel can tell us when a Cooldown is done.
+	friend class UAbleCooldownManager;
+
+	/* Starts (or re-schedules) the expiry of the provided Cooldown. */
+	void ScheduleCooldownExpiry(uint32 AbilityNameHash, const FAbleAbilityCooldown& Cooldown);
+
+	/* Called by the Cooldown Manager when a scheduled expiry comes due. Stale expiries (removed or re-scheduled Cooldowns) are ignored. */
+	void OnCooldownTimerExpired(uint32 AbilityNameHash, float ExpiryTime, float CurrentTime);
 
-	/* Updates all Cooldowns using the provided DeltaTime. */
-	void UpdateCooldowns(float DeltaTime);
+	/* Refreshes and removes any expired Cooldowns. With a Cooldown Manager, only Cooldowns that can't be cached are handled here (so changes to them show up right away). */
+	void UpdateCooldowns();
+
+	/* Returns true if any of our Cooldowns can't be cached. */
+	bool HasUncachedCooldowns() const;
+
+	/*
+	* Returns the current World time, used for all Cooldown math. Note this is unaffected by our Owner's Custom Time Dilation,
+	* Cooldowns used to count down by our (dilated) tick Delta Time.
+	*/
+	float GetCooldownWorldTime() const;
 
 	/* Helper method to deal with all the pending contexts we may have. */
 	void HandlePendingContexts();
@@ -642,6 +900,15 @@ protected:
 	/* Handle any Instance clean up. */
 	void HandleInstanceCleanUp(const UAbleAbility& Ability);
 
+	/* Returns an Instance ready to be Initialized, from the Utility Subsystem pool if we have one. */
+	UAbleAbilityInstance* AcquireAbilityInstance();
+
+	/* Resets a finished Instance and holds onto it until the end of our update, when it goes back to the pool. */
+	void ReleaseAbilityInstance(UAbleAbilityInstance* Instance);
+
+	/* Returns any released Instances to the pool. */
+	void FlushRetiredInstances();
+
 	/* Check our running Abilities against our Server variables. Only executed on remote clients. */
 	void ValidateRemoteRunningAbilities();
 	////
@@ -660,6 +927,12 @@ protected:
 
     void GetCombinedGameplayTags(FGameplayTagContainer& CombinedTags, bool includeRunningAbilities) const;
 
+	/* Returns our tags (plus those of our running Abilities, if requested) without building a new container each call. Scratch is only used if we have to build one off the Game Thread. */
+	const FGameplayTagContainer& GetCachedCombinedGameplayTags(bool includeRunningAbilities, FGameplayTagContainer& Scratch) const;
+
+	/* Call whenever our tags, Active Ability, or Passive set changes. */
+	FORCEINLINE void InvalidateCombinedGameplayTags() { m_CombinedTagsDirty = true; }
+
 	bool IsAbilityInstancePendingCancel(const UAbleAbilityInstance* AbilityInstance) const;
 
 protected:
@@ -667,13 +940,17 @@ protected:
 	UPROPERTY(Transient)
 	UAbleAbilityInstance* m_ActiveAbilityInstance;
 
+	/* Instances released this update. They aren't pooled until the update is done, so nothing can be handed a pointer we're still comparing against. */
+	UPROPERTY(Transient)
+	TArray<UAbleAbilityInstance*> m_RetiredInstances;
+
 	/* Our Active Ability Instance Result. */
 	UPROPERTY(Transient)
 	TEnumAsByte<EAbleAbilityTaskResult> m_ActiveAbilityResult;
 
 	/* Our Passive Ability Instances */
 	UPROPERTY(Transient)
-	TArray<UAbleAbilityInstance*> m_PassiveAbilityInstances;
+	FAblePassiveAbilityInstanceArray m_PassiveAbilityInstances;
 
     UPROPERTY(Transient)
     bool m_PassivesDirty = false;
@@ -681,8 +958,22 @@ protected:
 	/* Cached Settings Object for log reporting. */
 	UPROPERTY(Transient)
 	TWeakObjectPtr<const USPAbleSettings> m_Settings;
+
+	/* World Tick Manager, if we're using the batched update instead of our own tick function. */
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UAbleAbilityTickManager> m_TickManager;
+
+	/* Our slot in the Tick Manager's update list, INDEX_NONE if we aren't in it. */
+	int32 m_BatchedTickIndex = INDEX_NONE;
+
+	/* True while we have nothing that needs a per frame update, and so aren't ticking at all. */
+	bool m_IsDormant = true;
+
+	/* World Cooldown Manager, schedules our Cooldown expiries. */
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UAbleCooldownManager> m_CooldownManager;
 	
-	/* Active Cooldowns. */
+	/* Active Cooldowns. Only ever touched on the Game Thread. */
 	UPROPERTY(Transient)
 	TMap<uint32, FAbleAbilityCooldown> m_ActiveCooldowns;
 
@@ -712,10 +1003,20 @@ protected:
 	UPROPERTY(Transient)
 	FGameplayTagContainer m_TagContainer;
 
+	/* Our tags combined with our running Abilities' tags, rebuilt lazily (on the Game Thread) after it's invalidated. */
+	mutable FGameplayTagContainer m_CombinedTags;
+
+	/* Whether m_CombinedTags needs to be rebuilt. */
+	mutable bool m_CombinedTagsDirty;
+
 	/* These tags are automatically added to the Ability Component Tag container when the game starts.*/
 	UPROPERTY(EditDefaultsOnly, Category = "Able|Tags", meta = (DisplayName = "Auto Apply Tags"))
 	FGameplayTagContainer m_AutoApplyTags;
 
+	/* If true, our owner is added to the world Targeting Index (if it's enabled) on BeginPlay, root included even if it isn't one of the indexed object types yet, so Targeting can find it without a physics query. */
+	UPROPERTY(EditDefaultsOnly, Category = "Able|Targeting", meta = (DisplayName = "Add To Targeting Index"))
+	bool m_AddToTargetingIndex = true;
+
 	/* Boolean to track our update processing. */
 	UPROPERTY(Transient)
 	bool m_IsProcessingUpdate = false;
@@ -744,6 +1045,8 @@ protected:
 	
 	FOnAbilityIteration m_AbilityIterationDelegate;
 
+	FOnAbilityCooldownExpired m_AbilityCooldownExpiredDelegate;
+
 	const FAnimNode_SPAbilityAnimPlayer* m_AbilityAnimationNode;
 
 	FCriticalSection m_AbilityAnimNodeCS;
@@ -754,8 +1057,8 @@ protected:
 	FAbleAbilityNetworkContext m_ServerActive;
 
 	// The Active Passive Abilities being played on the server.
-	UPROPERTY(Transient, ReplicatedUsing = OnServerPassiveAbilitiesChanged)
-	TArray<FAbleAbilityNetworkContext> m_ServerPassiveAbilities;
+	UPROPERTY(Transient, Replicated)
+	FAbleReplicatedPassiveAbilityArray m_ServerPassiveAbilities;
 
 	/*UPROPERTY(Transient, ReplicatedUsing = OnServerPredictiveKeyChanged)
 	uint16 m_ServerPredictionKey;*/
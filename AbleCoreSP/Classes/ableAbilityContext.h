@@ -149,7 +149,19 @@ public:
 	const TMap<FName, FVector>& GetVectorParameters() const { return m_VectorParameters; }
 
 	static FAbleAbilityNetworkContext UpdateNetworkContext(const UAbleAbilityContext& UpdatedContext, const FAbleAbilityNetworkContext& Source);
+
+	/* Custom serialization, this goes out with every activation so we quantize what we can, skip anything that's empty, and keep parameters declared as local off the wire. */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 private:
+	/* Writes/Reads the Ability's Network Relevant parameters, followed by any parameters the Ability never declared. */
+	void NetSerializeParameters(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	/* Returns true if we have a parameter of the given Type and Name. */
+	bool HasParameter(EAbleContextParameterType Type, FName Name) const;
+
+	/* Writes/Reads a single parameter value. When loading, a None Name reads the value and drops it. Returns false for an unknown Type. */
+	bool NetSerializeParameterValue(FArchive& Ar, class UPackageMap* Map, EAbleContextParameterType Type, FName Name);
+
 	/* The Ability for this Context. */
 	UPROPERTY()
 	TWeakObjectPtr<const UAbleAbility> m_Ability;
@@ -224,6 +236,15 @@ private:
 	int32 m_AbilityUniqueID;
 };
 
+template<>
+struct TStructOpsTypeTraits<FAbleAbilityNetworkContext> : public TStructOpsTypeTraitsBase2<FAbleAbilityNetworkContext>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
 class AbleRWScopeLock
 {
 public:
@@ -500,6 +521,51 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
 	FVector GetVectorParameter(FName Id) const;
 
+	/**
+	* Returns a handle to a parameter the Ability declared, or an invalid handle if it isn't declared. Resolve this once, then use the ByHandle methods
+	* which skip the name lookup entirely. Handles are only valid for Contexts of the same Ability.
+	*/
+	UFUNCTION(BlueprintPure, Category = "Able|Ability|Context")
+	FAbleContextParameterHandle FindParameterHandle(FName Id) const;
+
+	/* Set a declared parameter using a handle from FindParameterHandle. */
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	void SetIntParameterByHandle(const FAbleContextParameterHandle& Handle, int Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	void SetFloatParameterByHandle(const FAbleContextParameterHandle& Handle, float Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	void SetStringParameterByHandle(const FAbleContextParameterHandle& Handle, const FString& Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	void SetUObjectParameterByHandle(const FAbleContextParameterHandle& Handle, UObject* Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	void SetVectorParameterByHandle(const FAbleContextParameterHandle& Handle, FVector Value);
+
+	/* Returns a declared parameter using a handle from FindParameterHandle, or the default value if the handle doesn't fit this Context. */
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	int GetIntParameterByHandle(const FAbleContextParameterHandle& Handle) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	float GetFloatParameterByHandle(const FAbleContextParameterHandle& Handle) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	const FString& GetStringParameterByHandle(const FAbleContextParameterHandle& Handle) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	UObject* GetUObjectParameterByHandle(const FAbleContextParameterHandle& Handle) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Able|Ability|Context")
+	FVector GetVectorParameterByHandle(const FAbleContextParameterHandle& Handle) const;
+
+	/* Copies our declared parameters in to name keyed maps (used by the Network Context). */
+	void ExportDeclaredParameters(TMap<FName, int>& OutInts, TMap<FName, float>& OutFloats, TMap<FName, FString>& OutStrings, TMap<FName, UObject*>& OutUObjects, TMap<FName, FVector>& OutVectors) const;
+
+	/* Copies name keyed parameters in to this Context, using our declared slots where we have them. */
+	void ImportParameters(const TMap<FName, int>& Ints, const TMap<FName, float>& Floats, const TMap<FName, FString>& Strings, const TMap<FName, UObject*>& UObjects, const TMap<FName, FVector>& Vectors);
+
 	/**
 	* Returns the Ability contained in this Context.
 	*
@@ -539,6 +605,30 @@ public:
 	
 	/* Returns the Async Targeting Transform. */
 	const FTransform& GetAsyncQueryTransform() const { return m_AsyncQueryTransform; }
+
+	/* Returns true if one of our Targeting filters is waiting on async work. See UAbleTargetingBase::ResumeFilterTargets. */
+	bool HasPendingTargetFilter() const { return m_PendingTargetFilterIndex != INDEX_NONE; }
+
+	/* Returns the index of the Targeting filter we're waiting on. */
+	int32 GetPendingTargetFilterIndex() const { return m_PendingTargetFilterIndex; }
+
+	/* Sets the Targeting filter we're waiting on. */
+	void SetPendingTargetFilterIndex(int32 FilterIndex) { m_PendingTargetFilterIndex = FilterIndex; }
+
+	/* Returns the traces a Targeting filter is waiting on, one per Target Actor (unset for any Target that didn't need one). */
+	TArray<FTraceHandle>& GetMutablePendingTargetTraces() { return m_PendingTargetTraces; }
+
+	/* Returns true if a Targeting filter has traces in flight. */
+	bool HasPendingTargetTraces() const { return m_PendingTargetTraces.Num() > 0; }
+
+	/* Stops waiting on any Targeting filter. */
+	void ClearPendingTargetFilter() { m_PendingTargetFilterIndex = INDEX_NONE; m_PendingTargetTraces.Reset(); }
+
+	/* Returns true if whoever is running Targeting can't wait on async work, so filters shouldn't start any. */
+	bool AreTargetFiltersBlocking() const { return m_BlockingTargetFilters; }
+
+	/* Sets whether whoever is running Targeting can wait on async work. */
+	void SetTargetFiltersBlocking(bool Blocking) { m_BlockingTargetFilters = Blocking; }
 	//////
 
     /* Set the Origin Location. */
@@ -625,6 +715,9 @@ public:
 	/* Resets the Context to it's default state, and returns it to the pool if pooling is enabled.*/
 	void Reset();
 
+	/* Sizes our parameter slots for the current Ability's declared parameters. */
+	void InitializeParameterSlots();
+
 	UFUNCTION(BlueprintCallable)
 	int32 GetAbilityId() const { return m_AbilityId; }
 	void SetAbilityId(const int32 AbilityId);
@@ -706,6 +799,15 @@ protected:
 	/* Used if our targeting call uses Async instead of Sync queries. */
 	FTraceHandle m_AsyncHandle;
 
+	/* Targeting filter that is waiting on async work, INDEX_NONE if there isn't one. */
+	int32 m_PendingTargetFilterIndex = INDEX_NONE;
+
+	/* Traces the pending Targeting filter is waiting on, parallel to m_TargetActors. */
+	TArray<FTraceHandle> m_PendingTargetTraces;
+
+	/* If true, Targeting filters must finish their work on the spot rather than go async. */
+	bool m_BlockingTargetFilters = false;
+
 	/* Cached Transform used for our Async transform in case we need to do extra processing once our results come in. Currently only Cone check uses this. */
 	UPROPERTY(Transient)
 	FTransform m_AsyncQueryTransform;
@@ -738,6 +840,31 @@ protected:
 	UPROPERTY(Transient)
 	TMap<FName, FVector> m_VectorParameters;
 
+	/* Declared parameter layout of our Ability, if it has one. */
+	const FAbleContextParameterLayout* m_ParameterLayout = nullptr;
+
+	/* Declared Int/Float/Vector parameters, packed. Zeroed on Reset. */
+	TArray<uint8> m_ParameterBlock;
+
+	/* Declared String parameters. */
+	TArray<FString> m_StringSlots;
+
+	/* Declared UObject parameters. */
+	UPROPERTY(Transient)
+	TArray<UObject*> m_UObjectSlots;
+
+	/* Returns the declared Int/Float/Vector value the handle points at, or nullptr if it doesn't fit. */
+	template <typename T>
+	FORCEINLINE T* GetParameterBlockValue(const FAbleContextParameterHandle& Handle, EAbleContextParameterType Type) const
+	{
+		if (Handle.Type != Type || Handle.Slot < 0 || Handle.Slot + (int32)sizeof(T) > m_ParameterBlock.Num())
+		{
+			return nullptr;
+		}
+
+		return reinterpret_cast<T*>(const_cast<uint8*>(m_ParameterBlock.GetData()) + Handle.Slot);
+	}
+
 	/* ReadWrite Lock for Context Variables. */
 	mutable FRWLock m_ContextVariablesLock;
 	
@@ -16,6 +16,14 @@ struct FSyncTaskAdditionInfo
 	bool IsValidForNetwork = true;
 };
 
+/* A single Task that has work to do on a worker thread this frame (see UAbleAbilityTask::HasThreadSafeTick). */
+struct FAbleThreadSafeTaskTick
+{
+	const UAbleAbilityTask* Task = nullptr;
+	const UAbleAbilityContext* Context = nullptr;
+	float DeltaTime = 0.0f;
+};
+
 /* This class stores/controls all the variables needed during the execution of an Ability. 
  * It's not networked since the Context is the publicly exposed class and any variables that need to be kept
  * in sync with the Server/Queried by the user should be done there. This class is meant to be Fire & Forget. */
@@ -70,6 +78,9 @@ public:
 	/* Synchronous update entry point. */
 	void SyncUpdate(float DeltaTime);
 
+	/* Appends any running Tasks that want a worker thread tick this frame. Must be called on the Game Thread. */
+	void GatherThreadSafeTasks(float DeltaTime, TArray<FAbleThreadSafeTaskTick>& OutTasks) const;
+
 	/* Sets this Ability's current stack count. */
 	void SetStackCount(int32 TotalStacks);
 
@@ -134,9 +145,12 @@ public:
 	/* Sets the iteration (loop) counter of the Ability. */
 	void SetCurrentIteration(uint32 NewIteration);
 
-	/* Reset our structure to it's default state. */
+	/* Reset our structure to it's default state. Keeps our allocations, so the Instance can be pooled. */
 	void Reset();
 
+	/* Makes sure we have room for the busiest Segment of the provided Ability. */
+	void ReserveForAbility(const UAbleAbility& Ability);
+
 	/* Check if we're valid or not. */
 	bool IsValid() const { return m_Context != nullptr && m_Ability != nullptr; }
 
@@ -148,8 +162,14 @@ public:
 	bool IsPendingPassed() const { return m_PendingPassed; }
 	
 protected:
-	/* Shared code used by both Update versions (Async/Sync). */
-	void InternalUpdateTasks(TArray<UAbleAbilityTask*>& InTasks, TArray<const UAbleAbilityTask*>& InActiveTasks, TArray<const UAbleAbilityTask*>& InFinishedTasks, float CurrentTime, float DeltaTime);
+	/* Starts any pending Tasks in m_SyncTasks that are ready, and updates the active ones. */
+	void InternalUpdateTasks(TArray<const UAbleAbilityTask*>& InActiveTasks, TArray<const UAbleAbilityTask*>& InFinishedTasks, float CurrentTime, float DeltaTime);
+
+	/* Resets our cursor over m_SyncTasks. Must be called any time m_SyncTasks is rebuilt. */
+	void ResetSyncTaskCursor();
+
+	/* Returns the number of Tasks in m_SyncTasks that are still waiting to start. */
+	FORCEINLINE int32 GetNumPendingSyncTasks() const { return m_SyncTasks.Num() - m_NumRetiredSyncTasks; }
 	
 	/* Safely calls the appropriate OnTaskEnd for all running tasks. */
 	void InternalStopRunningTasks(EAbleAbilityTaskResult Reason, bool ResetForLoop = false);
@@ -161,6 +181,12 @@ protected:
 	void ResetTaskDependencyStatus();
 
 	bool CanStartTask(const UAbleAbilityTask* Task) const;
+
+	/* Marks the Task as completed, for any Tasks that depend on it. */
+	void MarkTaskCompleted(const UAbleAbilityTask* Task);
+
+	/* Returns true if every Task the provided Task depends on has completed. */
+	bool AreDependenciesCompleted(const UAbleAbilityTask* Task) const;
 	
     /* Our stack decay time, if any. */
     UPROPERTY(Transient)
@@ -172,10 +198,25 @@ protected:
 	//UPROPERTY(Transient)
 	//TArray<const UAbleAbilityTask*> m_FinishedAyncTasks;
 	
-	/* Array of all Synchronous Tasks in this Ability. */
+	/* Array of all Synchronous Tasks in this Segment, sorted by start time. We walk this with a cursor rather than removing Tasks as they start. */
 	UPROPERTY(Transient)
 	TArray<UAbleAbilityTask*> m_SyncTasks;
 
+	/* Index of the first Task in m_SyncTasks whose start time we haven't reached yet. */
+	int32 m_SyncTaskCursor = 0;
+
+	/* The time our cursor was last advanced to, so we can tell when time has moved backwards (loops, restarts, preview). */
+	float m_SyncTaskCursorTime = 0.0f;
+
+	/* Indices of Tasks behind the cursor that are still waiting to start (conditions, dependencies, etc), in start order. */
+	TArray<int32> m_DueSyncTasks;
+
+	/* Tasks in m_SyncTasks that have started and won't be considered again until m_SyncTasks is rebuilt. */
+	TBitArray<> m_RetiredSyncTasks;
+
+	/* Number of bits set in m_RetiredSyncTasks. */
+	int32 m_NumRetiredSyncTasks = 0;
+
 	UPROPERTY(Transient)
 	TArray<UAbleAbilityTask*> m_AcrossTasks;
 	
@@ -208,9 +249,9 @@ protected:
 	UPROPERTY(Transient)
 	TArray<TWeakObjectPtr<AActor>> m_AdditionalTargets;
 
-	/* Tasks we need to keep track of, for dependency purposes. */
-	UPROPERTY(Transient)
-	TMap<const UAbleAbilityTask*, bool> m_TaskDependencyMap;
+	/* Completion state of every Task in our Segment's timeline (see UAbleAbilityTask::GetTimelineIndex), for dependency purposes.
+	 * Only touched on the Game Thread, so no lock is needed. */
+	TBitArray<> m_CompletedTimelineTasks;
 
 	UPROPERTY(Transient)
 	TMap<const UAbleAbilityTask*, uint32> m_TaskIterationMap;
@@ -227,9 +268,6 @@ protected:
 	/* Critical Section for AddAdditionalTargets. */
 	FCriticalSection m_AddTargetCS;
 
-	/* Critical Section for Task Dependency Map. */
-	FCriticalSection m_DependencyMapCS;
-	
 	/* Note we only store pointers to our tasks. The tasks themselves are stateless/purely functional (State is stored inside Scratch Pads as needed). */
 	int m_ActiveSegmentIndex = 0;
 
@@ -0,0 +1,72 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#pragma once
+
+#include "ableAbilityInstance.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "UObject/ObjectMacros.h"
+
+#include "ableAbilityTickManager.generated.h"
+
+class UAbleAbilityComponent;
+class USPAbleSettings;
+
+/**
+* World level manager that updates every registered Ability Component in a single batched pass each frame,
+* rather than each Component dispatching its own tick function. Components only register while they have
+* work to do (see UAbleAbilityComponent::CheckNeedsTick), so idle Components cost nothing.
+*/
+UCLASS()
+class ABLECORESP_API UAbleAbilityTickManager : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+public:
+	UAbleAbilityTickManager();
+	virtual ~UAbleAbilityTickManager();
+
+	// USubsystem Overrides
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	////
+
+	// FTickableGameObject Overrides
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override { return false; }
+	virtual bool IsTickableInEditor() const override { return false; }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	virtual TStatId GetStatId() const override;
+	////
+
+	/* Returns the Tick Manager for the provided World, if batched ticking is enabled and the World supports it. */
+	static UAbleAbilityTickManager* Get(const UWorld* World);
+
+	/* Adds or removes the Component from the batched update. Safe to call during the batched update itself. */
+	void SetComponentTickEnabled(UAbleAbilityComponent& Component, bool Enabled);
+
+	/* Returns the number of Components currently in the batched update. */
+	FORCEINLINE int32 GetNumTickingComponents() const { return m_TickingComponents.Num() - m_NumStaleEntries; }
+
+private:
+	/* Removes any entries that were cleared during the batched update. */
+	void CompactTickingComponents();
+
+	/* Runs OnTaskTickThreadSafe for every Task that wants it, across all our Components, and waits for them to finish. */
+	void UpdateThreadSafeTasks(int32 NumComponents, float DeltaTime);
+
+	/* Components we are currently updating. Order is stable between frames, entries are swap-removed. */
+	UPROPERTY(Transient)
+	TArray<UAbleAbilityComponent*> m_TickingComponents;
+
+	/* Number of null entries left behind by Components that stopped ticking mid-update. */
+	int32 m_NumStaleEntries;
+
+	/* Worker thread Task ticks for this frame, kept around to avoid re-allocating every frame. */
+	TArray<FAbleThreadSafeTaskTick> m_ThreadSafeTasks;
+
+	/* True while we are in the middle of the batched update. */
+	bool m_IsUpdating;
+};
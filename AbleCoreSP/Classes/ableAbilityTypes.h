@@ -8,9 +8,12 @@
 #include "Sound/SoundAttenuation.h"
 #include "Sound/SoundConcurrency.h"
 #include "Engine/DataTable.h"
+#include "CollisionQueryParams.h"
+#include "UObject/ObjectKey.h"
 
 #include "ableAbilityTypes.generated.h"
 
+class UAbleAbilityContext;
 class UAbleCollisionFilter;
 class UAbleAbilityTargetingFilter;
 UENUM(BlueprintType)
@@ -288,6 +291,93 @@ struct FAbleChannelPresent : public FTableRowBase
 	TArray<TEnumAsByte<ESPAbleTraceType>> Channels;
 };
 
+/* Resolves what a Channel Present and list of Trace Types come to, so queries don't have to hit the Channel Present table every time they run.
+ * Results are shared by everything in the world through the Utility Subsystem, keyed by the Ability Component class (which maps Trace Types to channels).
+ * Only the Game Thread uses the shared results, anything else resolves from scratch. */
+struct ABLECORESP_API FAbleCollisionChannelCache
+{
+public:
+	/* Returns the object query for Present plus TraceTypes, as seen by the Context's Ability Component. */
+	static FCollisionObjectQueryParams GetObjectQueryParams(const UAbleAbilityContext* Context, EAbleChannelPresent Present, const TArray<TEnumAsByte<ESPAbleTraceType>>& TraceTypes);
+
+	/* Resolves the object query from the Channel Present table, skipping the cache. */
+	static FCollisionObjectQueryParams Resolve(const UAbleAbilityContext* Context, EAbleChannelPresent Present, const TArray<TEnumAsByte<ESPAbleTraceType>>& TraceTypes);
+};
+
+UENUM(BlueprintType)
+enum class EAbleContextParameterType : uint8
+{
+	Int UMETA(DisplayName = "Int"),
+	Float UMETA(DisplayName = "Float"),
+	String UMETA(DisplayName = "String"),
+	UObject UMETA(DisplayName = "UObject"),
+	Vector UMETA(DisplayName = "Vector"),
+};
+
+/* A Context Parameter an Ability declares up front, so it gets a fixed slot in the Context rather than living in a map. */
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FAbleContextParameterDeclaration
+{
+	GENERATED_BODY()
+public:
+	FAbleContextParameterDeclaration() : Name(NAME_None), Type(EAbleContextParameterType::Int), NetworkRelevant(false) {}
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parameter")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parameter")
+	EAbleContextParameterType Type;
+
+	/* If true, this parameter is sent along with the Ability when it's activated over the network. Declared parameters without it stay local, undeclared ones are sent by name. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Parameter")
+	bool NetworkRelevant;
+};
+
+/* Resolved slot of a declared Context Parameter. Only valid for Contexts of the Ability it was found on. */
+USTRUCT(BlueprintType)
+struct ABLECORESP_API FAbleContextParameterHandle
+{
+	GENERATED_BODY()
+public:
+	FAbleContextParameterHandle() : Slot(INDEX_NONE), Type(EAbleContextParameterType::Int) {}
+	FAbleContextParameterHandle(int32 InSlot, EAbleContextParameterType InType) : Slot(InSlot), Type(InType) {}
+
+	FORCEINLINE bool IsValid() const { return Slot != INDEX_NONE; }
+
+	/* Byte offset in to the Context's parameter block for Int/Float/Vector, index in to the String/UObject slots otherwise. */
+	UPROPERTY()
+	int32 Slot;
+
+	UPROPERTY()
+	EAbleContextParameterType Type;
+};
+
+/* Where each declared parameter of an Ability lives inside a Context. Built once when the Ability loads. */
+struct ABLECORESP_API FAbleContextParameterLayout
+{
+	FAbleContextParameterLayout() : BlockSize(0), NumStrings(0), NumObjects(0) {}
+
+	void Build(const TArray<FAbleContextParameterDeclaration>& Declarations);
+
+	FORCEINLINE FAbleContextParameterHandle Find(FName Name) const
+	{
+		const FAbleContextParameterHandle* Handle = Handles.Num() ? Handles.Find(Name) : nullptr;
+		return Handle ? *Handle : FAbleContextParameterHandle();
+	}
+
+	TMap<FName, FAbleContextParameterHandle> Handles;
+
+	/* Declared parameters flagged as Network Relevant, in declaration order. Sent by index rather than by name. */
+	TArray<FAbleContextParameterDeclaration> NetworkRelevant;
+
+	/* Size, in bytes, of the Int/Float/Vector block. */
+	int32 BlockSize;
+
+	int32 NumStrings;
+
+	int32 NumObjects;
+};
+
 #define ABL_DECLARE_DYNAMIC_PROPERTY(Type, Property) TAttribute<Type> Property##Binding;
 #define ABL_GET_DYNAMIC_PROPERTY_VALUE(Context, Property) (Property##Delegate.IsBound() ? Property##Delegate.Execute(Context.Get(), Property) : Property)
 #define ABL_GET_DYNAMIC_PROPERTY_VALUE_ENUM(Context, Property) (Property##Delegate.IsBound() ? Property##Delegate.Execute(Context.Get(), Property.GetValue()) : Property.GetValue())
@@ -49,44 +49,6 @@ private:
 	float m_DeltaTime;
 };
 
-class FAsyncAbilityCooldownUpdaterTask
-{
-public:
-	// We make a copy of the Current time since it is written to during the sync update.
-	FAsyncAbilityCooldownUpdaterTask(UAbleAbilityComponent* InComponent, float InDeltaTime)
-		: m_AbilityComponent(InComponent),
-		m_DeltaTime(InDeltaTime)
-	{ }
-
-	/* Update all Cooldowns. */
-	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
-	{
-		if (m_AbilityComponent.IsValid())
-		{
-			m_AbilityComponent->UpdateCooldowns(m_DeltaTime);
-		}
-	}
-
-	/* Returns the mode of this Task. */
-	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::FireAndForget; }
-	
-	/* Returns the desired thread of this Task. */
-	ENamedThreads::Type GetDesiredThread() { return ENamedThreads::GameThread; }
-	
-	/* Returns the Profiler Stat ID for this Task. */
-	FORCEINLINE TStatId GetStatId() const
-	{
-		RETURN_QUICK_DECLARE_CYCLE_STAT(FAsyncAbilityInstanceUpdaterTask, STATGROUP_TaskGraphTasks);
-	}
-
-private:
-	/* The Ability Component to update Cooldowns on. */
-	TWeakObjectPtr<UAbleAbilityComponent> m_AbilityComponent;
-
-	/* The Delta Time to apply. */
-	float m_DeltaTime;
-};
-
 struct FAbleFindAbilityInstanceByHash
 {
 	FAbleFindAbilityInstanceByHash(uint32 InAbilityHash)
@@ -193,6 +155,48 @@ struct FAbleAbilityResultSortByDistance
 	}
 };
 
+/* Orders candidate indices best first, optionally keeping only the best few. Used by the distance sorts, which cache their keys up front. */
+struct FAbleTopKSelector
+{
+	/**
+	* Fills OutOrder with the indices [0, Num) sorted by IsBetter(A, B). If Keep is between 0 and Num, only the best Keep indices are returned:
+	* they're found with a bounded heap (worst of the kept on top) so we only ever sort Keep entries rather than all Num of them.
+	*/
+	template <typename AllocatorType, typename PredicateType>
+	static void SelectIndices(int32 Num, int32 Keep, TArray<int32, AllocatorType>& OutOrder, const PredicateType& IsBetter)
+	{
+		OutOrder.Reset();
+
+		if (Keep > 0 && Keep < Num)
+		{
+			auto IsWorse = [&IsBetter](int32 A, int32 B) { return IsBetter(B, A); };
+			OutOrder.Reserve(Keep);
+			for (int32 i = 0; i < Num; ++i)
+			{
+				if (OutOrder.Num() < Keep)
+				{
+					OutOrder.HeapPush(i, IsWorse);
+				}
+				else if (IsBetter(i, OutOrder.HeapTop()))
+				{
+					OutOrder.HeapPopDiscard(IsWorse, false);
+					OutOrder.HeapPush(i, IsWorse);
+				}
+			}
+		}
+		else
+		{
+			OutOrder.SetNumUninitialized(Num);
+			for (int32 i = 0; i < Num; ++i)
+			{
+				OutOrder[i] = i;
+			}
+		}
+
+		OutOrder.Sort(IsBetter);
+	}
+};
+
 struct FAbleSPLogHelper
 {
 	/* Returns the provided Result as a human readable string. */
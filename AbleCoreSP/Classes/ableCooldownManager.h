@@ -0,0 +1,116 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "ableCooldownManager.generated.h"
+
+class UAbleAbilityComponent;
+
+/* A scheduled Cooldown expiry, keyed by Component + Ability Name Hash. */
+struct FAbleCooldownTimer
+{
+	FAbleCooldownTimer()
+		: AbilityNameHash(0U),
+		ExpiryTick(0),
+		ExpiryTime(0.0f)
+	{ }
+
+	/* Component that owns the Cooldown. */
+	TWeakObjectPtr<UAbleAbilityComponent> Component;
+
+	/* Name Hash of the Ability on Cooldown. */
+	uint32 AbilityNameHash;
+
+	/* Wheel tick this timer fires on. */
+	int64 ExpiryTick;
+
+	/* World time (in seconds) the Cooldown expires at. */
+	float ExpiryTime;
+};
+
+/**
+* World level Cooldown scheduler. Cooldowns store their absolute expiry time, so nothing needs to count them down each frame,
+* this just tells the owning Component when one is done. Timers live in a hierarchical timing wheel (64 slots a level), so
+* scheduling is O(1) and each frame only touches the slots that have come due.
+*
+* Timers are never removed early: if a Cooldown is cleared or re-scheduled the Component simply ignores the stale expiry.
+*/
+UCLASS()
+class ABLECORESP_API UAbleCooldownManager : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+public:
+	UAbleCooldownManager();
+	virtual ~UAbleCooldownManager();
+
+	// USubsystem Overrides
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	////
+
+	// FTickableGameObject Overrides
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override { return false; }
+	virtual bool IsTickableInEditor() const override { return true; }
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+	virtual TStatId GetStatId() const override;
+	////
+
+	/* Returns the Cooldown Manager for the provided World. */
+	static UAbleCooldownManager* Get(const UWorld* World);
+
+	/* Schedules the Component to be told when this Ability's Cooldown expires. ExpiryTime is in World time seconds. */
+	void ScheduleCooldown(UAbleAbilityComponent& Component, uint32 AbilityNameHash, float ExpiryTime);
+
+	/* Returns the number of timers in the wheel, including any stale ones that haven't come due yet. */
+	FORCEINLINE int32 GetNumTimers() const { return m_NumTimers; }
+
+private:
+	enum
+	{
+		SlotBits = 6,
+		NumSlots = 1 << SlotBits,
+		SlotMask = NumSlots - 1,
+		NumLevels = 4,
+	};
+
+	/* Places the timer in the right level/slot for our current tick (or the expired list, if it is already due). */
+	void InsertTimer(const FAbleCooldownTimer& Timer);
+
+	/* Moves every timer in the given slot back through InsertTimer, so they land in a finer level. */
+	void CascadeSlot(int32 Level, int32 Slot);
+
+	/* Advances the wheel up to (and including) the provided tick, collecting expired timers as it goes. */
+	void AdvanceTo(int64 TargetTick);
+
+	/* Returns the tick a World time falls on. */
+	FORCEINLINE int64 TimeToTick(float Time) const { return FMath::FloorToInt(Time / m_Resolution); }
+
+	/* Returns the slot array for a level. */
+	FORCEINLINE TArray<FAbleCooldownTimer>& GetSlot(int32 Level, int32 Slot) { return m_Slots[Level * NumSlots + Slot]; }
+
+	/* Wheel slots, NumLevels * NumSlots of them. Level 0 is one tick per slot, each level above is 64x coarser. */
+	TArray<TArray<FAbleCooldownTimer>> m_Slots;
+
+	/* Timers too far out for the wheel, re-examined each time the top level wraps. */
+	TArray<FAbleCooldownTimer> m_Overflow;
+
+	/* Timers that have come due this frame. */
+	TArray<FAbleCooldownTimer> m_Expired;
+
+	/* Last tick we processed. */
+	int64 m_CurrentTick;
+
+	/* Length of a tick, in seconds. */
+	float m_Resolution;
+
+	/* Number of timers in the wheel and overflow. */
+	int32 m_NumTimers;
+};
@@ -2,10 +2,26 @@
 
 #pragma once
 
+#include "Engine/EngineTypes.h"
 #include "UObject/Object.h"
 #include "UObject/ObjectMacros.h"
 
 #include "ableSettings.generated.h"
+
+/* What to do when an Ability is activated before its Tasks' soft assets have streamed in. */
+UENUM()
+enum class EAbleAssetPreloadPolicy : uint8
+{
+	// Don't preload, Tasks load their assets synchronously when they need them.
+	Disabled UMETA(DisplayName = "Disabled"),
+	// Hold the activation (as Async Processing) until everything is loaded.
+	BlockActivation UMETA(DisplayName = "Block Activation"),
+	// Activate right away, Tasks whose assets aren't loaded yet just skip them.
+	ActivateWithoutAsset UMETA(DisplayName = "Activate Without Asset"),
+	// Activate right away, Tasks load anything missing synchronously and log a warning.
+	Warn UMETA(DisplayName = "Warn"),
+};
+
 /**
 * Implements the settings for the Able Toolkit
 */
@@ -27,9 +43,15 @@ public:
 	/* Returns true if the Async Update for Abilities is allowed. */
 	FORCEINLINE bool GetAllowAbilityAsyncUpdate() const { return m_AllowAsyncAbilityUpdate; }
 	
-	/* Returns true if the Async Cooldown Update is allowed. */
+	/* Returns true if the Async Cooldown Update is allowed. No longer used, Cooldowns are expired by the world Cooldown Manager. */
 	FORCEINLINE bool GetAllowAsyncCooldownUpdate() const { return m_AllowAsyncCooldownUpdate; }
 
+	/* Returns the length, in seconds, of a Cooldown Manager tick. Cooldowns expire at most this late. */
+	FORCEINLINE float GetCooldownTimerResolution() const { return m_CooldownTimerResolution; }
+
+	/* Returns how many frames, after the one it was traced on, a Line of Sight result can be reused for. */
+	FORCEINLINE uint32 GetLineOfSightCacheFrames() const { return m_LineOfSightCacheFrames; }
+
 	/* Returns true if we should log all Ability failures. */
 	FORCEINLINE bool GetLogAbilityFailures() const { return m_LogAbilityFailues; }
 	
@@ -66,9 +88,33 @@ public:
 	/* Returns the Max Context pool size. */
 	FORCEINLINE uint32 GetMaxContextPoolSize() const { return m_MaxPooledContextsSize; }
 
+	/* Returns how often, in seconds, the Context pool releases Contexts that went unused. */
+	FORCEINLINE float GetContextPoolTrimInterval() const { return m_ContextPoolTrimInterval; }
+
+	/* Returns how long, in seconds, a Context can be checked out of the pool before we report it as a possible leak. */
+	FORCEINLINE float GetContextLeakWarningTime() const { return m_ContextLeakWarningTime; }
+
 	/* Returns the Max ScratchPad pool size. */
 	FORCEINLINE uint32 GetMaxScratchPadPoolSize() const { return m_MaxPooledScratchPadsSize; }
 
+	/* Returns the Max Ability Instance pool size. */
+	FORCEINLINE uint32 GetMaxInstancePoolSize() const { return m_MaxPooledInstancesSize; }
+
+	/* Returns whether or not Ability Components are updated in a single batch by the world Tick Manager. */
+	FORCEINLINE bool GetUseBatchedAbilityTick() const { return m_UseBatchedAbilityTick; }
+
+	/* Returns how Abilities handle Task assets that haven't streamed in yet. */
+	FORCEINLINE EAbleAssetPreloadPolicy GetAssetPreloadPolicy() const { return m_AssetPreloadPolicy; }
+
+	/* Returns whether or not each World keeps a Targeting Index of targetable Actors. */
+	FORCEINLINE bool GetUseTargetingIndex() const { return m_UseTargetingIndex; }
+
+	/* Returns the size, in world units, of a Targeting Index cell. */
+	FORCEINLINE float GetTargetingIndexCellSize() const { return m_TargetingIndexCellSize; }
+
+	/* Returns the object types the Targeting Index answers for. */
+	FORCEINLINE const TArray<TEnumAsByte<ECollisionChannel>>& GetTargetingIndexObjectTypes() const { return m_TargetingIndexObjectTypes; }
+
 	void SetLogVerbose(bool bNewVal) { m_LogVerbose = bNewVal; }
 	
 private:
@@ -80,7 +126,7 @@ private:
 	UPROPERTY(config, EditAnywhere, Category = Ability, meta=(DisplayName="Allow Async Ability Update", EditCondition=m_EnableAsync))
 	bool m_AllowAsyncAbilityUpdate;
 
-	/* If true, Ability components will launch a separate task to update their active cooldowns. This can increase performance during heavy ability usage. */
+	/* Deprecated, Cooldowns store their expiry time and are expired by the world Cooldown Manager so there is nothing left to update asynchronously. */
 	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Allow Async Cooldown Update", EditCondition = m_EnableAsync))
 	bool m_AllowAsyncCooldownUpdate;
 
@@ -132,7 +178,47 @@ private:
 	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Max Context Pool Size"))
 	uint32 m_MaxPooledContextsSize;
 
+	/* How often, in seconds, we release pooled Contexts that weren't needed since the last trim (never going below the Initial Context Pool Size). 0 = Never trim.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Context Pool Trim Interval", EditCondition = m_AllowAbilityContextReuse))
+	float m_ContextPoolTrimInterval;
+
+	/* If a Context has been checked out of the pool longer than this many seconds, it's reported (per Ability) as a possible leak each time the pool is trimmed. 0 = Disabled.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Context Leak Warning Time", EditCondition = m_AllowAbilityContextReuse))
+	float m_ContextLeakWarningTime;
+
 	/* The maximum number of Scratchpads to pool. You can use this value to prevent Able from holding on to too many Scratchpads if there's a sudden spike of Abilities. 0 = No limit. Only enable this if you see memory being an issue.*/
 	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Max Scratchpad Pool Size"))
 	uint32 m_MaxPooledScratchPadsSize;
+
+	/* The maximum number of Ability Instances to pool. Instances are reused along with their allocations, so this mostly bounds memory held after a spike of Abilities. 0 = No limit.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Max Ability Instance Pool Size"))
+	uint32 m_MaxPooledInstancesSize;
+
+	/* If true, Ability Components don't use their own tick function. Instead, a world level Tick Manager updates every Component that has work to do in one batched pass. This can help with performance if you have lots of Ability Components in a level.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Use Batched Ability Tick"))
+	bool m_UseBatchedAbilityTick;
+
+	/* Granularity, in seconds, of the world Cooldown Manager. Cooldown checks are always exact, this only controls how late the expiry event (and removal) can be.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Cooldown Timer Resolution", ClampMin = 0.001))
+	float m_CooldownTimerResolution;
+
+	/* Targeting Line of Sight results are shared between everything tracing the same source and target. Results are always reused within the frame they were traced on, this allows reusing them for this many frames after that as well.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Line of Sight Cache Frames"))
+	uint32 m_LineOfSightCacheFrames;
+
+	/* Abilities stream in every soft asset their Tasks reference the first time they're queried (or when asked to preload), rather than each Task loading its asset synchronously on start. This decides what happens if an Ability is activated before that's finished.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Asset Preload Policy"))
+	EAbleAssetPreloadPolicy m_AssetPreloadPolicy;
+
+	/* If true, each World keeps an index of every Actor with a primitive of the object types below, which Targeting marked "Use Targeting Index" checks instead of running a physics overlap for those types. Helpful with lots of AI.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Use Targeting Index"))
+	bool m_UseTargetingIndex;
+
+	/* Size, in world units, of a Targeting Index cell. Somewhere around your common Targeting range is a good start.*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Targeting Index Cell Size", ClampMin = 100.0, EditCondition = m_UseTargetingIndex))
+	float m_TargetingIndexCellSize;
+
+	/* Object types the Targeting Index answers for, anything else still goes through physics. Actors are indexed by the primitives of these types they have when spawned or streamed in, so an Actor that only switches a primitive to one of them later won't be found unless it's added again (Ability Components re-add their owner on BeginPlay).*/
+	UPROPERTY(config, EditAnywhere, Category = Ability, meta = (DisplayName = "Targeting Index Object Types", EditCondition = m_UseTargetingIndex))
+	TArray<TEnumAsByte<ECollisionChannel>> m_TargetingIndexObjectTypes;
 };
@@ -5,6 +5,7 @@
 #include "UnLuaInterface.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Tasks/IAbleAbilityTask.h"
+#include "UObject/ObjectKey.h"
 #include <Core/GameFeatureSystem/GameFeatureSystem.h>
 
 #include "ableSubSystem.generated.h"
@@ -37,6 +38,61 @@ public:
 	TArray<UAbleAbilityScratchPad*> Instances;
 };
 
+/* Identifies a Line of Sight trace so casters looking at the same Target from the same spot can share the result. */
+struct FAbleLineOfSightKey
+{
+	FAbleLineOfSightKey() : Source(ForceInitToZero), TargetLocation(ForceInitToZero), Target(), ObjectTypes(0) {}
+	FAbleLineOfSightKey(const FVector& InSource, const FVector& InTargetLocation, const AActor* InTarget, int32 InObjectTypes)
+		: Source(RoundLocation(InSource)), TargetLocation(RoundLocation(InTargetLocation)), Target(InTarget), ObjectTypes(InObjectTypes) {}
+
+	bool operator==(const FAbleLineOfSightKey& Other) const { return Source == Other.Source && TargetLocation == Other.TargetLocation && Target == Other.Target && ObjectTypes == Other.ObjectTypes; }
+
+	friend uint32 GetTypeHash(const FAbleLineOfSightKey& Key)
+	{
+		return HashCombine(HashCombine(HashCombine(GetTypeHash(Key.Source), GetTypeHash(Key.TargetLocation)), GetTypeHash(Key.Target)), GetTypeHash(Key.ObjectTypes));
+	}
+
+	static FIntVector RoundLocation(const FVector& Location) { return FIntVector(FMath::RoundToInt(Location.X), FMath::RoundToInt(Location.Y), FMath::RoundToInt(Location.Z)); }
+
+	/* Trace start, rounded to the nearest unit. */
+	FIntVector Source;
+
+	/* Trace end (where the Target was), rounded to the nearest unit. A Target that moved needs a new trace. */
+	FIntVector TargetLocation;
+
+	/* Actor being traced to. */
+	FObjectKey Target;
+
+	/* Object types the trace can be blocked by. */
+	int32 ObjectTypes;
+};
+
+/* Identifies a Channel Present lookup. Trace Types are mapped to channels by the Ability Component, so the Component class is part of the key. */
+struct FAbleChannelPresentKey
+{
+	FAbleChannelPresentKey(EAbleChannelPresent InPresent, const TArray<TEnumAsByte<ESPAbleTraceType>>& InTraceTypes, const UClass* InComponentClass)
+		: Present(InPresent), TraceTypes(InTraceTypes), ComponentClass(InComponentClass) {}
+
+	bool operator==(const FAbleChannelPresentKey& Other) const { return Present == Other.Present && ComponentClass == Other.ComponentClass && TraceTypes == Other.TraceTypes; }
+
+	friend uint32 GetTypeHash(const FAbleChannelPresentKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash((uint8)Key.Present.GetValue()), GetTypeHash(Key.ComponentClass));
+		for (const TEnumAsByte<ESPAbleTraceType>& TraceType : Key.TraceTypes)
+		{
+			Hash = HashCombine(Hash, GetTypeHash((uint8)TraceType.GetValue()));
+		}
+		return Hash;
+	}
+
+	TEnumAsByte<EAbleChannelPresent> Present;
+
+	/* Usually only a couple, so keep them inline and lookups don't allocate. */
+	TArray<TEnumAsByte<ESPAbleTraceType>, TInlineAllocator<8>> TraceTypes;
+
+	FObjectKey ComponentClass;
+};
+
 UCLASS(BlueprintType)
 class ABLECORESP_API UAbleAbilityUtilitySubsystem : public UGameFeatureSystem, public IUnLuaInterface
 {
@@ -52,38 +108,117 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Able")
 	UAbleAbilityContext* FindOrConstructContext();
 
+	/* Returns a reset Ability Instance, reusing a pooled one if we have it. Hand it back with ReturnInstance. */
+	UAbleAbilityInstance* FindOrConstructInstance();
+
 	UFUNCTION(BlueprintCallable, Category = "Able")
 	UAbleAbilityTaskScratchPad* FindOrConstructTaskScratchPad(TSubclassOf<UAbleAbilityTaskScratchPad>& Class);
 
 	UFUNCTION(BlueprintCallable, Category = "Able")
 	UAbleAbilityScratchPad* FindOrConstructAbilityScratchPad(TSubclassOf<UAbleAbilityScratchPad>& Class);
 	
+	/* Fills the pools with Count Scratch Pads for the Ability and each of its Tasks, so activating it later doesn't have to allocate. Call this when the Ability is granted. */
+	UFUNCTION(BlueprintCallable, Category = "Able")
+	void PrewarmScratchPads(UAbleAbilityComponent* AbilityComponent, const UAbleAbility* Ability, int32 Count);
+
 	UFUNCTION(BlueprintCallable, Category = "Able")
 	void ClearAllCachePools();
 
+	/* Writes every Context that's been checked out of the pool for at least MinAge seconds to the log, grouped by Ability. Useful for tracking down leaks. */
+	UFUNCTION(BlueprintCallable, Category = "Able")
+	void LogOutstandingContexts(float MinAge = 0.0f) const;
+
 	// Return methods
 	void ReturnContext(UAbleAbilityContext* Context);
+	void ReturnInstance(UAbleAbilityInstance* Instance);
 	void ReturnTaskScratchPad(UAbleAbilityTaskScratchPad* Scratchpad);
 	void ReturnAbilityScratchPad(UAbleAbilityScratchPad* Scratchpad);
 	
 	UDataTable* TryGetChannelPresentDataTable();
+
+	/* Returns true if we have a recent Line of Sight result for this trace, and whether it was blocked. */
+	bool FindLineOfSight(const FAbleLineOfSightKey& Key, bool& OutBlocked) const;
+
+	/* Records a Line of Sight result so other casters can skip the trace. */
+	void CacheLineOfSight(const FAbleLineOfSightKey& Key, bool bBlocked);
+
+	/* Returns true if we've already resolved this Channel Present lookup. */
+	bool FindChannelPresent(const FAbleChannelPresentKey& Key, FCollisionObjectQueryParams& OutObjectQuery) const;
+
+	/* Records a resolved Channel Present lookup, kept until the Channel Present table changes or the pools are cleared. */
+	void CacheChannelPresent(const FAbleChannelPresentKey& Key, const FCollisionObjectQueryParams& ObjectQuery);
 private:
 	// Helper methods
 	FAbleTaskScratchPadBucket* GetTaskBucketByClass(TSubclassOf<UAbleAbilityTaskScratchPad>& Class);
 	FAbleAbilityScratchPadBucket* GetAbilityBucketByClass(TSubclassOf<UAbleAbilityScratchPad>& Class);
-	uint32 GetTotalScratchPads() const;
+	uint32 GetTotalScratchPads() const { return m_NumPooledScratchPads; }
 
-	UPROPERTY(Transient)
-	TArray<UAbleAbilityContext*> m_AllocatedContexts;
+	/* Returns true if the pool has room for another Scratch Pad. */
+	bool CanPoolScratchPad() const;
+
+	/* Keeps our counters (and stats) in sync as Scratch Pads go in and out of the pools. */
+	void OnScratchPadPooled();
+	void OnScratchPadUnpooled();
+
+	/* Releases any pooled Contexts that weren't needed since the last trim, and reports possible leaks. */
+	void TrimContextPool(double CurrentTime);
+
+#if WITH_EDITOR
+	/* Throws away any cached Channel Present results. */
+	void OnChannelPresentDataTableChanged();
+#endif
+
+	/* Drops any Line of Sight results that are too old to be used. */
+	void PruneLineOfSightCache();
+
+	/* Returns true if a Line of Sight result traced on Frame can still be used. */
+	bool IsLineOfSightFresh(uint64 Frame) const;
 
+	/* Contexts ready to be handed out. The oldest (least recently used) are at the front. */
 	UPROPERTY(Transient)
 	TArray<UAbleAbilityContext*> m_AvailableContexts;
 
+	/* Contexts we've handed out that haven't come back yet, and the time they were handed out. Whoever checked them out owns them (and keeps
+	 * them alive), so these are weak - a Context that's never returned is collected with its owner instead of being pinned here. */
+	TMap<TWeakObjectPtr<UAbleAbilityContext>, double> m_OutstandingContexts;
+
+	/* Fewest Contexts we've had available since the last trim. Anything under this was never needed. */
+	int32 m_AvailableContextsLowWater;
+
+	/* Last time we trimmed the Context pool. */
+	double m_LastContextTrimTime;
+
+	/* Reset Ability Instances ready to be handed out. */
 	UPROPERTY(Transient)
-	TArray<FAbleTaskScratchPadBucket> m_TaskBuckets;
+	TArray<UAbleAbilityInstance*> m_AvailableInstances;
 
+	/* Scratch Pad pools, keyed by Scratch Pad class. */
 	UPROPERTY(Transient)
-	TArray<FAbleAbilityScratchPadBucket> m_AbilityBuckets;
+	TMap<UClass*, FAbleTaskScratchPadBucket> m_TaskBuckets;
+
+	UPROPERTY(Transient)
+	TMap<UClass*, FAbleAbilityScratchPadBucket> m_AbilityBuckets;
+
+	/* Number of Scratch Pads sitting in our pools, across every bucket. */
+	uint32 m_NumPooledScratchPads;
+
+	/* Most Scratch Pads we've had pooled at once. */
+	uint32 m_PooledScratchPadsHighWater;
+
+	struct FLineOfSightResult
+	{
+		bool bBlocked;
+		uint64 Frame;
+	};
+
+	/* Recent Line of Sight results, shared by every Targeting filter in the world. */
+	TMap<FAbleLineOfSightKey, FLineOfSightResult> m_LineOfSightCache;
+
+	/* Last frame we pruned the Line of Sight cache. */
+	uint64 m_LineOfSightPruneFrame;
+
+	/* Resolved Channel Present lookups, shared by every Task and Targeting in the world. */
+	TMap<FAbleChannelPresentKey, FCollisionObjectQueryParams> m_ChannelPresentCache;
 
 	UPROPERTY(Transient)
 	const USPAbleSettings* m_Settings;
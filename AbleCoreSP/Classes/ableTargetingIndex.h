@@ -0,0 +1,161 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#pragma once
+
+#include "Components/SceneComponent.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/World.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/ObjectMacros.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include "ableTargetingIndex.generated.h"
+
+class AActor;
+class ULevel;
+class UPrimitiveComponent;
+
+/* A primitive of an Actor in the Targeting Index, along with the bounds we last saw it at. */
+struct FAbleTargetingIndexEntry
+{
+	FAbleTargetingIndexEntry()
+		: BoundsOrigin(ForceInitToZero),
+		BoundsExtent(ForceInitToZero),
+		Cell(0, 0)
+	{ }
+
+	/* The Actor that owns Component. */
+	TWeakObjectPtr<AActor> Actor;
+
+	/* Key we're looked up by, kept so we can still find the entry once the Component is gone. */
+	FObjectKey ComponentKey;
+
+	/* The indexed primitive, we listen to it for movement. Its collision is checked at query time, since it can change after we're added. */
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	/* Our binding to Component's TransformUpdated. */
+	FDelegateHandle MovedHandle;
+
+	/* World space bounds of the Component. */
+	FVector BoundsOrigin;
+	FVector BoundsExtent;
+
+	/* Grid cell we're filed under. */
+	FIntPoint Cell;
+};
+
+/**
+* World level index of targetable Actors (usually pawns), kept in a uniform XY grid so Targeting can find them without a physics overlap.
+* Actors are re-filed as their root moves, so queries only ever look at the handful of cells they touch.
+*
+* Each primitive component of one of our object types is indexed by its bounds, the same as a physics overlap would find it. The index only answers for the
+* object types listed in the settings, so it picks up every Actor with such a primitive as it's spawned or streamed in, and drops it again at EndPlay.
+* The object type is checked when the Actor is added, Actors that only switch a primitive into one of our types later have to be added again
+* (Ability Components add their owner, root included, on BeginPlay).
+*/
+UCLASS()
+class ABLECORESP_API UAbleTargetingIndex : public UWorldSubsystem
+{
+	GENERATED_BODY()
+public:
+	UAbleTargetingIndex();
+	virtual ~UAbleTargetingIndex();
+
+	// USubsystem Overrides
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	////
+
+	/* Returns the Targeting Index for the provided World, if it's enabled. */
+	static UAbleTargetingIndex* Get(const UWorld* World);
+
+	/* Adds the Actor's primitives of our object types to the index, and its root primitive whatever its type if bIncludeRoot. Returns false if none of its primitives are in the index. Only primitives currently of one of our object types (with query collision) are ever returned. */
+	bool AddActor(AActor& Actor, bool bIncludeRoot = true);
+
+	/* Removes the Actor from the index. */
+	void RemoveActor(AActor& Actor);
+
+	/* Returns the object types (as a query bitfield) the index answers for. */
+	FORCEINLINE int32 GetIndexedObjectTypes() const { return m_IndexedObjectTypes; }
+
+	/* Returns the number of primitives in the index. */
+	FORCEINLINE int32 GetNumEntries() const { return m_Entries.Num(); }
+
+	/* Adds the Actor of every primitive of ObjectTypes whose bounds touch the sphere. Like a physics overlap, an Actor is added once per primitive. */
+	void QuerySphere(const FVector& Center, float Radius, int32 ObjectTypes, TArray<TWeakObjectPtr<AActor>>& OutActors) const;
+
+	/* Adds the Actor of every primitive of ObjectTypes whose bounds touch the box. Only the box and world axes are tested, so Actors just off an edge can slip in. */
+	void QueryBox(const FTransform& Transform, const FVector& HalfExtents, int32 ObjectTypes, TArray<TWeakObjectPtr<AActor>>& OutActors) const;
+
+	/* Adds the Actor of every primitive of ObjectTypes whose bounds touch the capsule, tested as a sphere at the nearest point on the capsule's segment to each primitive. */
+	void QueryCapsule(const FTransform& Transform, float Radius, float HalfHeight, int32 ObjectTypes, TArray<TWeakObjectPtr<AActor>>& OutActors) const;
+
+private:
+	/* Adds a single primitive of the Actor. */
+	void AddComponent(AActor& Actor, UPrimitiveComponent& Component);
+
+	/* Takes an entry out of the index, moving our last entry into its place. */
+	void RemoveEntry(int32 EntryIndex);
+
+	/* Adds every Actor in the Level that has a primitive of our object types. */
+	void AddLevelActors(const ULevel* Level);
+
+	/* Called whenever an Actor is spawned into our World. */
+	void OnActorSpawned(AActor* Actor);
+
+	/* Called once our World's Actors are initialized, to pick up the Actors placed in its Levels. */
+	void OnActorsInitialized(const UWorld::FActorsInitializedParams& Params);
+
+	/* Called whenever a Level is streamed into a World. */
+	void OnLevelAdded(ULevel* Level, UWorld* World);
+
+	/* Called when an indexed Actor leaves play. */
+	UFUNCTION()
+	void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	/* Called whenever an indexed primitive moves. */
+	void OnComponentMoved(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/* Refreshes the bounds of an entry, re-filing it if it crossed into a new cell. */
+	void UpdateEntry(int32 EntryIndex);
+
+	/* Returns the cell a location falls in. */
+	FORCEINLINE FIntPoint GetCell(const FVector& InLocation) const { return FIntPoint(FMath::FloorToInt(InLocation.X * m_InvCellSize), FMath::FloorToInt(InLocation.Y * m_InvCellSize)); }
+
+	/* Files an entry under its cell, or takes it back out. */
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+
+	/* Calls Visitor with every valid entry filed under a cell the (XY) bounds touch, whose Component currently has query collision and is one of ObjectTypes. */
+	template <typename VisitorType>
+	void ForEachCandidate(const FBox& QueryBounds, int32 ObjectTypes, VisitorType Visitor) const;
+
+	/* Indexed primitives, packed. */
+	TArray<FAbleTargetingIndexEntry> m_Entries;
+
+	/* Where each primitive lives in m_Entries. */
+	TMap<FObjectKey, int32> m_EntryLookup;
+
+	/* Indexed primitives, by Actor. */
+	TMultiMap<FObjectKey, FObjectKey> m_ActorComponents;
+
+	/* Our bindings to the World's spawn, Actor initialization and Level streaming events. */
+	FDelegateHandle m_ActorSpawnedHandle;
+	FDelegateHandle m_ActorsInitializedHandle;
+	FDelegateHandle m_LevelAddedHandle;
+
+	/* Entry indices, by cell. */
+	TMap<FIntPoint, TArray<int32>> m_Cells;
+
+	/* Size of a cell, in world units. */
+	float m_CellSize;
+	float m_InvCellSize;
+
+	/* Largest XY bounds extent we've indexed. Entries are filed by their center, so queries reach this far past their own bounds. */
+	float m_MaxExtent;
+
+	/* Object types we answer for, as a query bitfield. */
+	int32 m_IndexedObjectTypes;
+};
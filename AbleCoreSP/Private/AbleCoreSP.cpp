@@ -14,6 +14,12 @@ class FAbleCoreSP : public IAbleCoreSP
 IMPLEMENT_MODULE(FAbleCoreSP, AbleCoreSP)
 DEFINE_LOG_CATEGORY(LogAbleSP);
 
+DEFINE_STAT(STAT_AbleNameHashesComputed);
+DEFINE_STAT(STAT_AbleSegmentNameScans);
+DEFINE_STAT(STAT_AbleAssetLoadHitches);
+DEFINE_STAT(STAT_AbleAssetPreloadsRequested);
+DEFINE_STAT(STAT_AbleAssetPreloadLatency);
+
 void FAbleCoreSP::StartupModule()
 {
 
@@ -11,4 +11,12 @@ DECLARE_LOG_CATEGORY_EXTERN(LogAbleSP, Log, All);
 DECLARE_LOG_CATEGORY_EXTERN(LogSPAbility, Log, All);
 
 
-DECLARE_STATS_GROUP(TEXT("AbleSP"), STATGROUP_Able, STATCAT_Advanced);
\ No newline at end of file
+DECLARE_STATS_GROUP(TEXT("AbleSP"), STATGROUP_Able, STATCAT_Advanced);
+
+// Anything that hashes or scans by name. These should stay at zero during gameplay, everything is resolved at load time.
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Name Hashes Computed"), STAT_AbleNameHashesComputed, STATGROUP_Able, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Segment Name Scans"), STAT_AbleSegmentNameScans, STATGROUP_Able, );
+// Soft asset streaming. Hitches should stay at zero once Abilities have preloaded.
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Asset Load Hitches"), STAT_AbleAssetLoadHitches, STATGROUP_Able, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Asset Preloads Requested"), STAT_AbleAssetPreloadsRequested, STATGROUP_Able, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Last Asset Preload Latency (ms)"), STAT_AbleAssetPreloadLatency, STATGROUP_Able, );
\ No newline at end of file
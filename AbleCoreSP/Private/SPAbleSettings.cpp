@@ -21,9 +21,18 @@ USPAbleSettings::USPAbleSettings(const FObjectInitializer& ObjectInitializer)
 	m_AllowAbilityContextReuse(true),
 	m_InitialPooledContextsSize(0),
 	m_MaxPooledContextsSize(0),
-	m_MaxPooledScratchPadsSize(0)
+	m_ContextPoolTrimInterval(30.0f),
+	m_ContextLeakWarningTime(0.0f),
+	m_MaxPooledScratchPadsSize(0),
+	m_MaxPooledInstancesSize(0),
+	m_UseBatchedAbilityTick(false),
+	m_CooldownTimerResolution(0.05f),
+	m_LineOfSightCacheFrames(0),
+	m_AssetPreloadPolicy(EAbleAssetPreloadPolicy::Warn),
+	m_UseTargetingIndex(false),
+	m_TargetingIndexCellSize(1000.0f)
 {
-
+	m_TargetingIndexObjectTypes.Add(ECC_Pawn);
 }
 
 USPAbleSettings::~USPAbleSettings()
@@ -10,6 +10,7 @@
 #include "ableAbility.h"
 #include "ableAbilityBlueprintLibrary.h"
 #include "ableAbilityComponent.h"
+#include "ableTargetingIndex.h"
 
 #define LOCTEXT_NAMESPACE "AbleAbilityTargeting"
 
@@ -21,6 +22,7 @@ UAbleTargetingBase::UAbleTargetingBase(const FObjectInitializer& ObjectInitializ
 	  m_Location(),
 	  m_ChannelPresent(ACP_Default),
 	  m_UseAsync(false),
+	  m_UseTargetingIndex(false),
 	  m_bSaveTargetLocation(false)
 {
 }
@@ -58,13 +60,31 @@ void UAbleTargetingBase::CleanUp()
 
 void UAbleTargetingBase::GetCollisionObjectParams(const UAbleAbilityContext* Context, FCollisionObjectQueryParams& outParams) const
 {
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context, m_ChannelPresent, m_CollisionChannels);
-	
-	for (TEnumAsByte<ECollisionChannel> Channel : Channels)
+	outParams = FAbleCollisionChannelCache::GetObjectQueryParams(Context, m_ChannelPresent, m_CollisionChannels);
+}
+
+const UAbleTargetingIndex* UAbleTargetingBase::GetTargetingIndex(const UAbleAbilityContext& Context, FCollisionObjectQueryParams& ObjectQuery, int32& OutIndexedObjectTypes) const
+{
+	OutIndexedObjectTypes = 0;
+	if (!m_UseTargetingIndex)
 	{
-		outParams.AddObjectTypesToQuery(Channel.GetValue());
+		return nullptr;
 	}
+
+	const UAbleTargetingIndex* TargetingIndex = UAbleTargetingIndex::Get(Context.GetWorld());
+	if (!TargetingIndex)
+	{
+		return nullptr;
+	}
+
+	OutIndexedObjectTypes = ObjectQuery.GetQueryBitfield() & TargetingIndex->GetIndexedObjectTypes();
+	if (!OutIndexedObjectTypes)
+	{
+		return nullptr;
+	}
+
+	ObjectQuery.ObjectTypesToQuery &= ~OutIndexedObjectTypes;
+	return TargetingIndex;
 }
 
 void UAbleTargetingBase::FilterTargets(UAbleAbilityContext& Context) const
@@ -93,13 +113,63 @@ void UAbleTargetingBase::FilterTargets(UAbleAbilityContext& Context) const
 		AbilityComponent->FilterTargets(Context);
 	}
 
-	for (UAbleAbilityTargetingFilter* TargetFilter : m_Filters)
+	Context.ClearPendingTargetFilter();
+	RunFilters(Context, 0);
+}
+
+void UAbleTargetingBase::ResumeFilterTargets(UAbleAbilityContext& Context, bool bWait) const
+{
+	const int32 FilterIndex = Context.GetPendingTargetFilterIndex();
+	if (!m_Filters.IsValidIndex(FilterIndex) || !IsValid(m_Filters[FilterIndex]))
+	{
+		Context.ClearPendingTargetFilter();
+		return;
+	}
+
+	m_Filters[FilterIndex]->ResumeFilter(Context, *this, bWait);
+	if (Context.HasPendingTargetTraces())
 	{
-		if (IsValid(TargetFilter))
+		// Still waiting.
+		return;
+	}
+
+	Context.ClearPendingTargetFilter();
+	RunFilters(Context, FilterIndex + 1);
+}
+
+void UAbleTargetingBase::RunFilters(UAbleAbilityContext& Context, int32 StartIndex) const
+{
+	for (int32 FilterIndex = StartIndex; FilterIndex < m_Filters.Num(); ++FilterIndex)
+	{
+		UAbleAbilityTargetingFilter* TargetFilter = m_Filters[FilterIndex];
+		if (!IsValid(TargetFilter))
+		{
+			continue;
+		}
+
+		// Sort by Distance straight into Max Targets only needs the nearest (or furthest) few sorted, so let the sort do the trim.
+		// Exact classes only, in case a subclass has its own idea of what these do.
+		if (TargetFilter->GetClass() == UAbleAbilityTargetingFilterSortByDistance::StaticClass() && m_Filters.IsValidIndex(FilterIndex + 1))
+		{
+			const UAbleAbilityTargetingFilterMaxTargets* MaxTargetsFilter = Cast<UAbleAbilityTargetingFilterMaxTargets>(m_Filters[FilterIndex + 1]);
+			if (IsValid(MaxTargetsFilter) && MaxTargetsFilter->GetClass() == UAbleAbilityTargetingFilterMaxTargets::StaticClass())
+			{
+				CastChecked<UAbleAbilityTargetingFilterSortByDistance>(TargetFilter)->SortTargets(Context, *this, MaxTargetsFilter->GetMaxTargets());
+				++FilterIndex;
+				continue;
+			}
+		}
+
+		TargetFilter->Filter(Context, *this);
+
+		if (Context.HasPendingTargetTraces())
 		{
-			TargetFilter->Filter(Context, *this);	
+			// The rest of the filters (and the Target Location) have to wait for this one, see ResumeFilterTargets.
+			Context.SetPendingTargetFilterIndex(FilterIndex);
+			return;
 		}
 	}
+
 	if (m_bSaveTargetLocation && Context.HasAnyTargets())
 	{
 		TWeakObjectPtr<AActor> TargetActor = nullptr;
@@ -5,6 +5,7 @@
 #include "ableAbility.h"
 #include "ableAbilityDebug.h"
 #include "ableSettings.h"
+#include "ableTargetingIndex.h"
 #include "Engine/World.h"
 
 UAbleTargetingBox::UAbleTargetingBox(const FObjectInitializer& ObjectInitializer)
@@ -37,7 +38,23 @@ void UAbleTargetingBox::FindTargets(UAbleAbilityContext& Context) const
 	FCollisionObjectQueryParams ObjectQuery;
 	GetCollisionObjectParams(&Context, ObjectQuery);
 
-	if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
+	int32 IndexedObjectTypes = 0;
+	const UAbleTargetingIndex* TargetingIndex = GetTargetingIndex(Context, ObjectQuery, IndexedObjectTypes);
+
+	if (TargetingIndex && !ObjectQuery.IsValid()) // The index covers everything we're after, no need for physics.
+	{
+		Location.GetTransform(Context, QueryTransform);
+
+		// Push our query out by our half extents so we aren't centered in the box.
+		FVector HalfExtentsOffset = QueryTransform.GetRotation().GetForwardVector() * HalfExtents.X;
+
+		QueryTransform *= FTransform(HalfExtentsOffset);
+
+		TargetingIndex->QueryBox(QueryTransform, HalfExtents, IndexedObjectTypes, Context.GetMutableTargetActors());
+
+		FilterTargets(Context);
+	}
+	else if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
 	{
 		// Check if we have a valid Async handle already. 
 		if (!Context.HasValidAsyncHandle())
@@ -53,6 +70,11 @@ void UAbleTargetingBox::FindTargets(UAbleAbilityContext& Context) const
 
 			QueryTransform *= FTransform(HalfExtentsOffset);
 
+			if (TargetingIndex)
+			{
+				TargetingIndex->QueryBox(QueryTransform, HalfExtents, IndexedObjectTypes, Context.GetMutableTargetActors());
+			}
+
 			FTraceHandle AsyncHandle = World->AsyncOverlapByObjectType(QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, BoxShape);
 			Context.SetAsyncHandle(AsyncHandle);
 		}
@@ -83,8 +105,13 @@ void UAbleTargetingBox::FindTargets(UAbleAbilityContext& Context) const
 
 		QueryTransform *= FTransform(HalfExtentsOffset);
 
+		if (TargetingIndex)
+		{
+			TargetingIndex->QueryBox(QueryTransform, HalfExtents, IndexedObjectTypes, Context.GetMutableTargetActors());
+		}
+
 		TArray<FOverlapResult> Results;
-		if (World->OverlapMultiByObjectType(Results, QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, BoxShape))
+		if (World->OverlapMultiByObjectType(Results, QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, BoxShape) || TargetingIndex)
 		{
 			ProcessResults(Context, Results);
 		}
@@ -5,6 +5,7 @@
 #include "ableAbility.h"
 #include "ableAbilityDebug.h"
 #include "ableSettings.h"
+#include "ableTargetingIndex.h"
 #include "Engine/World.h"
 
 UAbleTargetingCapsule::UAbleTargetingCapsule(const FObjectInitializer& ObjectInitializer)
@@ -38,12 +39,28 @@ void UAbleTargetingCapsule::FindTargets(UAbleAbilityContext& Context) const
 	FCollisionObjectQueryParams ObjectQuery;
 	GetCollisionObjectParams(&Context, ObjectQuery);
 
-	if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
+	int32 IndexedObjectTypes = 0;
+	const UAbleTargetingIndex* TargetingIndex = GetTargetingIndex(Context, ObjectQuery, IndexedObjectTypes);
+
+	if (TargetingIndex && !ObjectQuery.IsValid()) // The index covers everything we're after, no need for physics.
+	{
+		Location.GetTransform(Context, QueryTransform);
+
+		TargetingIndex->QueryCapsule(QueryTransform, Radius, Height * 0.5f, IndexedObjectTypes, Context.GetMutableTargetActors());
+
+		FilterTargets(Context);
+	}
+	else if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
 	{
 		if (!Context.HasValidAsyncHandle()) // If we don't have a handle, create our query.
 		{
 			Location.GetTransform(Context, QueryTransform);
 
+			if (TargetingIndex)
+			{
+				TargetingIndex->QueryCapsule(QueryTransform, Radius, Height * 0.5f, IndexedObjectTypes, Context.GetMutableTargetActors());
+			}
+
 			FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(Radius, Height * 0.5f);
 
 			FTraceHandle AsyncHandle = World->AsyncOverlapByObjectType(QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, CapsuleShape);
@@ -68,8 +85,13 @@ void UAbleTargetingCapsule::FindTargets(UAbleAbilityContext& Context) const
 
 		FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(Radius, Height * 0.5f);
 
+		if (TargetingIndex)
+		{
+			TargetingIndex->QueryCapsule(QueryTransform, Radius, Height * 0.5f, IndexedObjectTypes, Context.GetMutableTargetActors());
+		}
+
 		TArray<FOverlapResult> Results;
-		if (World->OverlapMultiByObjectType(Results, QueryTransform.GetTranslation(), QueryTransform.GetRotation(), ObjectQuery, CapsuleShape))
+		if (World->OverlapMultiByObjectType(Results, QueryTransform.GetTranslation(), QueryTransform.GetRotation(), ObjectQuery, CapsuleShape) || TargetingIndex)
 		{
 			ProcessResults(Context, Results);
 		}
@@ -5,6 +5,7 @@
 #include "ableAbility.h"
 #include "ableAbilityDebug.h"
 #include "ableSettings.h"
+#include "ableTargetingIndex.h"
 #include "Engine/World.h"
 
 UAbleTargetingCone::UAbleTargetingCone(const FObjectInitializer& ObjectInitializer)
@@ -26,6 +27,89 @@ UAbleTargetingCone::~UAbleTargetingCone()
 // For a Cone, we simply do a Sphere query pushed out to cover the entire cone, and then check if any entities are within a certain angle
 // from our source. If our FOV is > 180, we take the inverse results (the cone represents a hole so we want nothing in it).
 
+/* The per target half of our cone query, shared by physics results and the Targeting Index. */
+struct FAbleConeTest
+{
+	FAbleConeTest(const FTransform& QueryTransform, float FOV, float Height, float Length, bool b2DQuery, bool b3DSlice)
+		: QueryLocation(QueryTransform.GetLocation()),
+		QueryForward(QueryTransform.GetRotation().GetForwardVector()),
+		GreaterThanOneEighty(FOV > 180.0f),
+		HalfAngle(FMath::DegreesToRadians((GreaterThanOneEighty ? 360.0f - FOV : FOV) * 0.5f)),
+		LengthSqr(Length * Length),
+		HeightSqr(Height * Height),
+		HeightAngle(b2DQuery ? 0.0f : FMath::Atan2(Height * 0.5f, Length)),
+		Is2DQuery(b2DQuery),
+		Is3DSlice(b3DSlice)
+	{
+		// If we're great than 180, we take the angle of the "hole" and compare against that (which requires flipping our forward around).
+		if (GreaterThanOneEighty)
+		{
+			QueryForward = -QueryForward;
+		}
+
+		XYForward.Set(QueryForward.X, QueryForward.Y); // Horiz Plane
+	}
+
+	bool Passes(const FVector& ResultLocation) const
+	{
+		FVector ToTarget = ResultLocation - QueryLocation;
+		ToTarget.Normalize();
+		const FVector2D ToTargetXY(ToTarget.X, ToTarget.Y);
+
+		bool ValidEntry = true;
+
+		// If we're a 3D query, we base our initial sphere query on whichever is largest (height or length),
+		// so do a quick distance check here, if those pass - go ahead and do our vertical angle check.
+		if (!Is2DQuery)
+		{
+			const float DistSqr = FVector::DistSquared(ResultLocation, QueryLocation);
+			if (DistSqr > HeightSqr || DistSqr > LengthSqr)
+			{
+				ValidEntry = false;
+			}
+			else if (Is3DSlice)
+			{
+				ValidEntry = DistSqr < HeightSqr;
+			}
+			else
+			{
+				ValidEntry = FMath::Acos(FVector::DotProduct(QueryForward, ToTarget)) < HeightAngle;
+			}
+		}
+		else
+		{
+			ValidEntry = FVector::DistSquared2D(ResultLocation, QueryLocation) <= LengthSqr;
+		}
+
+		// Move on to our Dot product checks
+		if (ValidEntry)
+		{
+			// Check our Horizontal angle.
+			const float QueryToTargetDotProduct = FVector2D::DotProduct(XYForward, ToTargetXY);
+
+			ValidEntry = FMath::Acos(QueryToTargetDotProduct) < HalfAngle && QueryToTargetDotProduct > 0.0f;
+
+			if (GreaterThanOneEighty) // If our FOV > 180 degrees, we want everything not in the angle check.
+			{
+				ValidEntry = !ValidEntry;
+			}
+		}
+
+		return ValidEntry;
+	}
+
+	FVector QueryLocation;
+	FVector QueryForward;
+	FVector2D XYForward;
+	bool GreaterThanOneEighty;
+	float HalfAngle;
+	float LengthSqr;
+	float HeightSqr;
+	float HeightAngle;
+	bool Is2DQuery;
+	bool Is3DSlice;
+};
+
 void UAbleTargetingCone::FindTargets(UAbleAbilityContext& Context) const
 {
 	FAbleAbilityTargetTypeLocation Location = ABL_GET_DYNAMIC_PROPERTY_VALUE_RAW(&Context, m_Location);
@@ -46,7 +130,23 @@ void UAbleTargetingCone::FindTargets(UAbleAbilityContext& Context) const
 	FCollisionObjectQueryParams ObjectQuery;
 	GetCollisionObjectParams(&Context, ObjectQuery);
 
-	if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
+	int32 IndexedObjectTypes = 0;
+	const UAbleTargetingIndex* TargetingIndex = GetTargetingIndex(Context, ObjectQuery, IndexedObjectTypes);
+
+	if (TargetingIndex && !ObjectQuery.IsValid()) // The index covers everything we're after, no need for physics.
+	{
+		const float Radius = (Is2DQuery() ? Length : FMath::Max(Height, Length)) * 0.5f;
+
+		Location.GetTransform(Context, QueryTransform);
+
+		const FVector OffsetVector = QueryTransform.GetRotation().GetForwardVector() * Radius;
+		const FVector QueryLocation = FOV > 180.0f ? QueryTransform.GetTranslation() : QueryTransform.GetTranslation() + OffsetVector;
+
+		AddIndexedTargets(Context, *TargetingIndex, IndexedObjectTypes, QueryTransform, QueryLocation, FOV < 180.0f ? Radius : Radius * 2.0f, FOV, Height, Length);
+
+		FilterTargets(Context);
+	}
+	else if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
 	{
 		if (!Context.HasValidAsyncHandle()) // Populate our Async query
 		{
@@ -61,6 +161,11 @@ void UAbleTargetingCone::FindTargets(UAbleAbilityContext& Context) const
 			const FVector OffsetVector = QueryForward * Radius;
 			const FVector QueryLocation = FOV > 180.0f ? QueryTransform.GetTranslation() : QueryTransform.GetTranslation() + OffsetVector;
 
+			if (TargetingIndex)
+			{
+				AddIndexedTargets(Context, *TargetingIndex, IndexedObjectTypes, QueryTransform, QueryLocation, SphereShape.GetSphereRadius(), FOV, Height, Length);
+			}
+
 			FTraceHandle AsyncHandle = World->AsyncOverlapByObjectType(QueryLocation, QueryTransform.GetRotation(), ObjectQuery, SphereShape);
 			Context.SetAsyncHandle(AsyncHandle);
 			Context.SetAsyncQueryTransform(QueryTransform);
@@ -91,8 +196,13 @@ void UAbleTargetingCone::FindTargets(UAbleAbilityContext& Context) const
 		const FVector OffsetVector = QueryForward * Radius;
 		const FVector QueryLocation = FOV > 180.0f ? QueryTransform.GetTranslation() : QueryTransform.GetTranslation() + OffsetVector;
 
+		if (TargetingIndex)
+		{
+			AddIndexedTargets(Context, *TargetingIndex, IndexedObjectTypes, QueryTransform, QueryLocation, SphereShape.GetSphereRadius(), FOV, Height, Length);
+		}
+
 		TArray<FOverlapResult> Results;
-		if (World->OverlapMultiByObjectType(Results, QueryLocation, QueryTransform.GetRotation(), ObjectQuery, SphereShape))
+		if (World->OverlapMultiByObjectType(Results, QueryLocation, QueryTransform.GetRotation(), ObjectQuery, SphereShape) || TargetingIndex)
 		{
 			Context.SetAsyncQueryTransform(QueryTransform); // Bit of a misnomer, but cache our transform here since ProcessResults will need it.
 			ProcessResults(Context, Results, FOV, Height, Length);
@@ -147,45 +257,9 @@ void UAbleTargetingCone::ProcessResults(UAbleAbilityContext& Context, const TArr
 	TArray<TWeakObjectPtr<AActor>>& TargetActors = Context.GetMutableTargetActors();
 
 	// Grab the Transform we used.
-	const FTransform& QueryTransform = Context.GetAsyncQueryTransform();
-	FVector QueryLocation = QueryTransform.GetLocation();
-
-	// Cache off various values we use in our cone test.
-	const bool GreaterThanOneEighty = _FOV > 180.0f;
-	const float QueryAngle = GreaterThanOneEighty ? 360.0f - _FOV : _FOV;
-	const float HalfAngle = FMath::DegreesToRadians(QueryAngle * 0.5f);
-	const float LengthSqr = _Length * _Length;
-	const float HeightSqr = _Height * _Height;
-	const float HeightAngle = Is2DQuery() ? 0.0f : FMath::Atan2(_Height * 0.5f, _Length);
-
-	FVector QueryForward = QueryTransform.GetRotation().GetForwardVector();
-
-	// If we're great than 180, we take the angle of the "hole" and compare against that (which requires flipping our forward around).
-	if (GreaterThanOneEighty)
-	{
-		// Flip it around.
-		QueryForward = -QueryForward;
-	}
-
-	// Store all our Vectors to test against.
-	const FVector QueryRight = QueryTransform.GetRotation().GetRightVector();
-	const FVector2D XYForward(QueryForward.X, QueryForward.Y); // Horiz Plane
-	const FVector2D XZForward(QueryForward.X, QueryForward.Z); // Vert Plane
+	const FAbleConeTest ConeTest(Context.GetAsyncQueryTransform(), _FOV, _Height, _Length, Is2DQuery(), Is3DSlice());
 
-	// Various Parameters that will be written each check, declared here so we don't thrash the cache. 
 	FTransform ResultTransform; // Our Overlap Result Transform.
-	FVector ResultLocation; // Our Overlap Result Location (from our Transform).
-
-	FVector ToTarget; // Vector from our Query Location to our Result. 
-	FVector2D ToTargetXZ; // 2D Vector (XZ Plane) from our Query Location to our Result.
-	FVector2D ToTargetXY; // 2D Vector (XY Plane) from our Query Location to our Result.
-
-	bool ValidEntry = false; // Whether we've passed all checks or not.
-	bool WithInAngle = false; // Whether we're within our Cone Angle 
-	bool HalfSpace = false; // Half space check.
-
-	float QueryToTargetDotProduct = 0.0f; // Dot product of our XYForward and ToTargetXY.
-	float VerticalAngle = 0.0f;  // Angle, in radians, of our XZForward and ToTarget XZ.
 
 	for (const FOverlapResult& Result : Results)
 	{
@@ -193,63 +267,8 @@ void UAbleTargetingCone::ProcessResults(UAbleAbilityContext& Context, const TArr
 
 		TempTarget.GetTransform(ResultTransform);
 
-		ResultLocation = ResultTransform.GetTranslation();
-
-		ToTarget = ResultLocation - QueryLocation;
-		ToTarget.Normalize();
-		ToTargetXZ.Set(ToTarget.X, ToTarget.Z);
-		ToTargetXY.Set(ToTarget.X, ToTarget.Y);
-
-		ValidEntry = true;
-
-		// If we're a 3D query, we base our initial sphere query on whichever is largest (height or length),
-		// so do a quick distance check here, if those pass - go ahead and do our vertical angle check.
-		if (!Is2DQuery())
-		{
-			if (FVector::DistSquared(ResultLocation, QueryLocation) > HeightSqr ||
-				FVector::DistSquared(ResultLocation, QueryLocation) > LengthSqr)
-			{
-				ValidEntry = false;
-			}
-			else
-			{
-				if (Is3DSlice())
-				{
-					ValidEntry = FVector::DistSquared(ResultLocation, QueryLocation) < HeightSqr;
-				}
-				else
-				{
-					VerticalAngle = FMath::Acos(FVector::DotProduct(QueryForward, ToTarget));
-
-					ValidEntry = VerticalAngle < HeightAngle;
-				}
-			}
-		}
-		else
-		{
-			ValidEntry = FVector::DistSquared2D(ResultLocation, QueryLocation) <= LengthSqr;
-		}
-
-		// Move on to our Dot product checks
-		if (ValidEntry)
-		{
-			// Check our Horizontal angle.
-			QueryToTargetDotProduct = FVector2D::DotProduct(XYForward, ToTargetXY);
-
-			WithInAngle = FMath::Acos(QueryToTargetDotProduct) < HalfAngle;
-
-			HalfSpace = QueryToTargetDotProduct > 0.0f;
-
-			ValidEntry = WithInAngle && HalfSpace;
-
-			if (GreaterThanOneEighty) // If our FOV > 180 degrees, we want everything not in the angle check.
-			{
-				ValidEntry = !ValidEntry;
-			}
-		}
-
 		// Save our success
-		if (ValidEntry)
+		if (ConeTest.Passes(ResultTransform.GetTranslation()))
 		{
 			if (TempTarget.Actor.IsValid())
 			{
@@ -262,6 +281,23 @@ void UAbleTargetingCone::ProcessResults(UAbleAbilityContext& Context, const TArr
 	FilterTargets(Context);
 }
 
+void UAbleTargetingCone::AddIndexedTargets(UAbleAbilityContext& Context, const UAbleTargetingIndex& TargetingIndex, int32 ObjectTypes, const FTransform& QueryTransform, const FVector& QueryLocation, float QueryRadius, float _FOV, float _Height, float _Length) const
+{
+	TArray<TWeakObjectPtr<AActor>> Candidates;
+	TargetingIndex.QuerySphere(QueryLocation, QueryRadius, ObjectTypes, Candidates);
+
+	const FAbleConeTest ConeTest(QueryTransform, _FOV, _Height, _Length, Is2DQuery(), Is3DSlice());
+
+	TArray<TWeakObjectPtr<AActor>>& TargetActors = Context.GetMutableTargetActors();
+	for (const TWeakObjectPtr<AActor>& Candidate : Candidates)
+	{
+		if (ConeTest.Passes(Candidate->GetActorLocation()))
+		{
+			TargetActors.Add(Candidate);
+		}
+	}
+}
+
 #if WITH_EDITOR
 void UAbleTargetingCone::OnAbilityEditorTick(const UAbleAbilityContext& Context, float DeltaTime) const
 {
@@ -9,7 +9,9 @@
 #include "ableAbilityContext.h"
 #include "ableAbilityDebug.h"
 #include "ableAbilityTypes.h"
+#include "ableAbilityUtilities.h"
 #include "ableSettings.h"
+#include "ableSubSystem.h"
 
 #include "Async/Future.h"
 #include "Async/Async.h"
@@ -18,6 +20,10 @@
 #include "Logging/LogMacros.h"
 #include "Targeting/ableTargetingBase.h"
 
+DECLARE_CYCLE_STAT(TEXT("AbleTargetingFilter::SortByDistance"), STAT_AbleTargetingFilter_SortByDistance, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Sort Candidates"), STAT_AbleTargetingSortCandidates, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Top-K Sorts"), STAT_AbleTargetingTopKSorts, STATGROUP_Able);
+
 UAbleAbilityTargetingFilter::UAbleAbilityTargetingFilter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -53,45 +59,6 @@ bool UAbleAbilityTargetingFilter::FixUpObjectFlags()
 
 #endif
 
-// Sorter helpers
-struct FAbleAbilityActorLocationTargetSorter
-{
-	FVector SourceLocation;
-	bool XYOnly;
-	bool Ascending; // Ascending for Nearest to Farthest, descending for the opposite.
-	FAbleAbilityActorLocationTargetSorter(FVector& InSourceLocation, bool InXYOnly, bool InAscending)
-		: SourceLocation(InSourceLocation), XYOnly(InXYOnly), Ascending(InAscending) {}
-
-	FORCEINLINE bool operator()(const TWeakObjectPtr<AActor>& A, const TWeakObjectPtr<AActor>& B) const
-	{
-		if (XYOnly)
-		{
-			// I could probably ditch this if branch: (return DistanceCheck || !Ascending)
-			// but I'd rather keep things explicit and branch prediction should take care of things anyway since its constant.
-			if (Ascending) // We want nearest
-			{
-				return FVector::DistSquaredXY(A->GetActorLocation(), SourceLocation) < FVector::DistSquaredXY(B->GetActorLocation(), SourceLocation);
-			}
-			else
-			{
-				return FVector::DistSquaredXY(A->GetActorLocation(), SourceLocation) > FVector::DistSquaredXY(B->GetActorLocation(), SourceLocation);
-			}
-		}
-		else
-		{
-			if (Ascending) // We want nearest
-			{
-				return FVector::DistSquared(A->GetActorLocation(), SourceLocation) < FVector::DistSquared(B->GetActorLocation(), SourceLocation);
-			}
-			else
-			{
-				return FVector::DistSquared(A->GetActorLocation(), SourceLocation) > FVector::DistSquared(B->GetActorLocation(), SourceLocation);
-			}
-		}
-	}
-};
-/////
-
 UAbleAbilityTargetingFilterSortByDistance::UAbleAbilityTargetingFilterSortByDistance(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer),
 	m_Use2DDistance(true),
@@ -107,6 +74,13 @@ UAbleAbilityTargetingFilterSortByDistance::~UAbleAbilityTargetingFilterSortByDis
 
 void UAbleAbilityTargetingFilterSortByDistance::Filter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase) const
 {
+	SortTargets(Context, TargetBase, 0);
+}
+
+void UAbleAbilityTargetingFilterSortByDistance::SortTargets(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase, int32 MaxTargets) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbleTargetingFilter_SortByDistance);
+
 	FVector SourceLocation = GetSourceLocation(Context, TargetBase.GetSource());
 	TArray<TWeakObjectPtr<AActor>>& TargetActors = Context.GetMutableTargetActors();
 	const int32 Count = TargetActors.RemoveAll([](const TWeakObjectPtr<AActor> Actor)
@@ -117,7 +91,44 @@ void UAbleAbilityTargetingFilterSortByDistance::Filter(UAbleAbilityContext& Cont
 	{
 		UE_LOG(LogAbleSP, Warning, TEXT("UAbleAbilityTargetingFilterSortByDistance::Filter TargetActor is not Valid Count = %d"), Count);
 	}
-	TargetActors.Sort(FAbleAbilityActorLocationTargetSorter(SourceLocation, m_Use2DDistance, m_SortDirection.GetValue() == EAbleTargetingFilterSort::AbleTargetFilterSort_Ascending));
+
+	const int32 NumTargets = TargetActors.Num();
+	INC_DWORD_STAT_BY(STAT_AbleTargetingSortCandidates, NumTargets);
+	if (NumTargets <= 1)
+	{
+		return;
+	}
+
+	// Resolve each Target and measure it once, rather than twice per comparison.
+	TArray<float, TInlineAllocator<64>> Distances;
+	Distances.SetNumUninitialized(NumTargets);
+	for (int32 i = 0; i < NumTargets; ++i)
+	{
+		const FVector TargetLocation = TargetActors[i]->GetActorLocation();
+		Distances[i] = m_Use2DDistance ? FVector::DistSquaredXY(TargetLocation, SourceLocation) : FVector::DistSquared(TargetLocation, SourceLocation);
+	}
+
+	const bool Ascending = m_SortDirection.GetValue() == EAbleTargetingFilterSort::AbleTargetFilterSort_Ascending;
+	auto IsBetter = [&Distances, Ascending](int32 A, int32 B)
+	{
+		return Ascending ? Distances[A] < Distances[B] : Distances[A] > Distances[B];
+	};
+
+	if (MaxTargets > 0 && MaxTargets < NumTargets)
+	{
+		INC_DWORD_STAT(STAT_AbleTargetingTopKSorts);
+	}
+
+	TArray<int32, TInlineAllocator<64>> Order;
+	FAbleTopKSelector::SelectIndices(NumTargets, MaxTargets, Order, IsBetter);
+
+	TArray<TWeakObjectPtr<AActor>> SortedTargets;
+	SortedTargets.Reserve(Order.Num());
+	for (int32 Index : Order)
+	{
+		SortedTargets.Add(TargetActors[Index]);
+	}
+	TargetActors = MoveTemp(SortedTargets);
 }
 
 FVector UAbleAbilityTargetingFilterSortByDistance::GetSourceLocation(const UAbleAbilityContext& Context, EAbleAbilityTargetType SourceType) const
@@ -349,7 +360,8 @@ void UAbleAbilityTargetingFilterCustom::Filter(UAbleAbilityContext& Context, con
 }
 
 UAbleAbilityTargetingFilterLineOfSight::UAbleAbilityTargetingFilterLineOfSight(const FObjectInitializer& ObjectInitializer)
-: Super(ObjectInitializer)
+: Super(ObjectInitializer),
+m_UseAsync(false)
 {
 
 }
@@ -369,35 +381,53 @@ void UAbleAbilityTargetingFilterLineOfSight::Filter(UAbleAbilityContext& Context
 	}
 
 	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		&Context, m_ChannelPresent, m_CollisionChannels);
-	for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-		ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
-	
-	FCollisionQueryParams CollisionParams;
+	FVector RaySource;
+	GetTraceParams(Context, ObjectQuery, RaySource);
 
 	AActor* SelfActor = Context.GetSelfActor();
-	FHitResult Hit;
-	FTransform SourceTransform;
-	m_SourceLocation.GetTransform(Context, SourceTransform);
-
-	FVector RaySource = SourceTransform.GetTranslation();
-	FVector RayEnd;
+	UAbleAbilityUtilitySubsystem* UtilitySubsystem = Context.GetUtilitySubsystem();
+	const bool bBatch = m_UseAsync && TargetBase.IsUsingAsync() && USPAbleSettings::IsAsyncEnabled() && !Context.AreTargetFiltersBlocking();
 
 	TArray<TWeakObjectPtr<AActor>>& MutableTargets = Context.GetMutableTargetActors();
+	TArray<FTraceHandle>& PendingTraces = Context.GetMutablePendingTargetTraces();
+	PendingTraces.Reset();
+
+	bool bAnyPending = false;
 	for (int i = 0; i < MutableTargets.Num();)
 	{
-		Hit.Reset(1.0f, false);
+		AActor* Target = MutableTargets[i].Get();
+		if (!Target)
+		{
+			MutableTargets.RemoveAt(i, 1, false);
+			continue;
+		}
 
-		CollisionParams.ClearIgnoredActors();
-		CollisionParams.AddIgnoredActor(SelfActor);
-		CollisionParams.AddIgnoredActor(MutableTargets[i].Get());
+		const FAbleLineOfSightKey Key(RaySource, Target->GetActorLocation(), Target, ObjectQuery.GetQueryBitfield());
+		bool bBlocked = false;
+		if (!UtilitySubsystem || !UtilitySubsystem->FindLineOfSight(Key, bBlocked))
+		{
+			if (bBatch)
+			{
+				FCollisionQueryParams CollisionParams;
+				CollisionParams.AddIgnoredActor(SelfActor);
+				CollisionParams.AddIgnoredActor(Target);
+
+				// Keep the handles lined up with the Targets, we'll sort out the results in ResumeFilter.
+				PendingTraces.SetNum(i);
+				PendingTraces.Add(CurrentWorld->AsyncLineTraceByObjectType(EAsyncTraceType::Test, RaySource, Target->GetActorLocation(), ObjectQuery, CollisionParams));
+				bAnyPending = true;
+				++i;
+				continue;
+			}
 
-		RayEnd = MutableTargets[i]->GetActorLocation();
+			bBlocked = TraceLineOfSight(CurrentWorld, RaySource, Target, SelfActor, ObjectQuery);
+			if (UtilitySubsystem)
+			{
+				UtilitySubsystem->CacheLineOfSight(Key, bBlocked);
+			}
+		}
 
-		if (CurrentWorld->LineTraceSingleByObjectType(Hit, RaySource, RayEnd, ObjectQuery, CollisionParams))
+		if (bBlocked)
 		{
 			MutableTargets.RemoveAt(i, 1, false);
 		}
@@ -405,16 +435,145 @@ void UAbleAbilityTargetingFilterLineOfSight::Filter(UAbleAbilityContext& Context
 		{
 			++i;
 		}
+	}
 
-#if !UE_BUILD_SHIPPING
-		if (FAbleAbilityDebug::ShouldDrawQueries())
+	if (bAnyPending)
+	{
+		PendingTraces.SetNum(MutableTargets.Num());
+	}
+	else
+	{
+		PendingTraces.Reset();
+		MutableTargets.Shrink();
+	}
+}
+
+void UAbleAbilityTargetingFilterLineOfSight::ResumeFilter(UAbleAbilityContext& Context, const UAbleTargetingBase& TargetBase, bool bWait) const
+{
+	UWorld* CurrentWorld = Context.GetWorld();
+	TArray<TWeakObjectPtr<AActor>>& MutableTargets = Context.GetMutableTargetActors();
+	TArray<FTraceHandle>& PendingTraces = Context.GetMutablePendingTargetTraces();
+
+	if (!CurrentWorld)
+	{
+		PendingTraces.Reset();
+		return;
+	}
+
+	FCollisionObjectQueryParams ObjectQuery;
+	FVector RaySource;
+	GetTraceParams(Context, ObjectQuery, RaySource);
+
+	if (PendingTraces.Num() != MutableTargets.Num())
+	{
+		// Someone changed the Targets out from under us, start over with blocking traces.
+		PendingTraces.Reset();
+		Filter(Context, TargetBase);
+		return;
+	}
+
+	AActor* SelfActor = Context.GetSelfActor();
+	UAbleAbilityUtilitySubsystem* UtilitySubsystem = Context.GetUtilitySubsystem();
+
+	bool bAnyPending = false;
+	for (int i = 0; i < MutableTargets.Num();)
+	{
+		FTraceHandle& Handle = PendingTraces[i];
+		if (!Handle.IsValid())
 		{
-			DrawDebugLine(CurrentWorld, RaySource, RayEnd, Hit.bBlockingHit ? FColor::Red : FColor::Green, FAbleAbilityDebug::ShouldDrawInEditor(), FAbleAbilityDebug::GetDebugQueryLifetime());
+			++i;
+			continue;
 		}
+
+		AActor* Target = MutableTargets[i].Get();
+		if (!Target)
+		{
+			MutableTargets.RemoveAt(i, 1, false);
+			PendingTraces.RemoveAt(i, 1, false);
+			continue;
+		}
+
+		bool bBlocked = false;
+		FVector RayStart = RaySource;
+		FVector RayEnd = Target->GetActorLocation();
+		FTraceDatum Datum;
+		if (CurrentWorld->QueryTraceData(Handle, Datum))
+		{
+			bBlocked = Datum.OutHits.Num() > 0;
+
+			// Either end may have moved since we issued the trace, so record the ray we actually traced.
+			RayStart = Datum.Start;
+			RayEnd = Datum.End;
+
+#if !UE_BUILD_SHIPPING
+			if (FAbleAbilityDebug::ShouldDrawQueries())
+			{
+				DrawDebugLine(CurrentWorld, Datum.Start, Datum.End, bBlocked ? FColor::Red : FColor::Green, FAbleAbilityDebug::ShouldDrawInEditor(), FAbleAbilityDebug::GetDebugQueryLifetime());
+			}
 #endif
+		}
+		else if (bWait || !CurrentWorld->IsTraceHandleValid(Handle, false))
+		{
+			// Either we can't wait, or the trace was dropped. Do it ourselves.
+			bBlocked = TraceLineOfSight(CurrentWorld, RaySource, Target, SelfActor, ObjectQuery);
+		}
+		else
+		{
+			bAnyPending = true;
+			++i;
+			continue;
+		}
+
+		if (UtilitySubsystem)
+		{
+			UtilitySubsystem->CacheLineOfSight(FAbleLineOfSightKey(RayStart, RayEnd, Target, ObjectQuery.GetQueryBitfield()), bBlocked);
+		}
+
+		if (bBlocked)
+		{
+			MutableTargets.RemoveAt(i, 1, false);
+			PendingTraces.RemoveAt(i, 1, false);
+		}
+		else
+		{
+			Handle._Handle = 0;
+			++i;
+		}
+	}
+
+	if (!bAnyPending)
+	{
+		PendingTraces.Reset();
+		MutableTargets.Shrink();
 	}
+}
+
+void UAbleAbilityTargetingFilterLineOfSight::GetTraceParams(const UAbleAbilityContext& Context, FCollisionObjectQueryParams& OutObjectQuery, FVector& OutRaySource) const
+{
+	OutObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(&Context, m_ChannelPresent, m_CollisionChannels);
+
+	FTransform SourceTransform;
+	m_SourceLocation.GetTransform(Context, SourceTransform);
+	OutRaySource = SourceTransform.GetTranslation();
+}
+
+bool UAbleAbilityTargetingFilterLineOfSight::TraceLineOfSight(UWorld* World, const FVector& RaySource, AActor* Target, AActor* SelfActor, const FCollisionObjectQueryParams& ObjectQuery) const
+{
+	FCollisionQueryParams CollisionParams;
+	CollisionParams.AddIgnoredActor(SelfActor);
+	CollisionParams.AddIgnoredActor(Target);
+
+	const FVector RayEnd = Target->GetActorLocation();
+	const bool bBlocked = World->LineTraceTestByObjectType(RaySource, RayEnd, ObjectQuery, CollisionParams);
+
+#if !UE_BUILD_SHIPPING
+	if (FAbleAbilityDebug::ShouldDrawQueries())
+	{
+		DrawDebugLine(World, RaySource, RayEnd, bBlocked ? FColor::Red : FColor::Green, FAbleAbilityDebug::ShouldDrawInEditor(), FAbleAbilityDebug::GetDebugQueryLifetime());
+	}
+#endif
 
-	MutableTargets.Shrink();
+	return bBlocked;
 }
 
 UAbleAbilityTargetingFilterUniqueActors::UAbleAbilityTargetingFilterUniqueActors(const FObjectInitializer& ObjectInitializer)
@@ -5,6 +5,7 @@
 #include "ableAbility.h"
 #include "ableAbilityDebug.h"
 #include "ableSettings.h"
+#include "ableTargetingIndex.h"
 #include "Engine/World.h"
 
 UAbleTargetingSphere::UAbleTargetingSphere(const FObjectInitializer& ObjectInitializer)
@@ -36,12 +37,28 @@ void UAbleTargetingSphere::FindTargets(UAbleAbilityContext& Context) const
 	FCollisionObjectQueryParams ObjectQuery;
 	GetCollisionObjectParams(&Context, ObjectQuery);
 
-	if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
+	int32 IndexedObjectTypes = 0;
+	const UAbleTargetingIndex* TargetingIndex = GetTargetingIndex(Context, ObjectQuery, IndexedObjectTypes);
+
+	if (TargetingIndex && !ObjectQuery.IsValid()) // The index covers everything we're after, no need for physics.
+	{
+		Location.GetTransform(Context, QueryTransform);
+
+		TargetingIndex->QuerySphere(QueryTransform.GetLocation(), Radius, IndexedObjectTypes, Context.GetMutableTargetActors());
+
+		FilterTargets(Context);
+	}
+	else if (IsUsingAsync() && USPAbleSettings::IsAsyncEnabled())
 	{
 		if (!Context.HasValidAsyncHandle()) // If we don't have a handle, create our query.
 		{
 			Location.GetTransform(Context, QueryTransform);
 
+			if (TargetingIndex)
+			{
+				TargetingIndex->QuerySphere(QueryTransform.GetLocation(), Radius, IndexedObjectTypes, Context.GetMutableTargetActors());
+			}
+
 			FCollisionShape SphereShape = FCollisionShape::MakeSphere(Radius);
 
 			FTraceHandle AsyncHandle = World->AsyncOverlapByObjectType(QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, SphereShape);
@@ -66,8 +83,13 @@ void UAbleTargetingSphere::FindTargets(UAbleAbilityContext& Context) const
 
 		FCollisionShape SphereShape = FCollisionShape::MakeSphere(Radius);
 
+		if (TargetingIndex)
+		{
+			TargetingIndex->QuerySphere(QueryTransform.GetLocation(), Radius, IndexedObjectTypes, Context.GetMutableTargetActors());
+		}
+
 		TArray<FOverlapResult> Results;
-		if (World->OverlapMultiByObjectType(Results, QueryTransform.GetTranslation(), QueryTransform.GetRotation(), ObjectQuery, SphereShape))
+		if (World->OverlapMultiByObjectType(Results, QueryTransform.GetTranslation(), QueryTransform.GetRotation(), ObjectQuery, SphereShape) || TargetingIndex)
 		{
 			ProcessResults(Context, Results);
 		}
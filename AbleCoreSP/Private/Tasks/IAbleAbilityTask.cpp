@@ -12,8 +12,8 @@
 #include "Serialization/ObjectReader.h"
 #include "Targeting/ableTargetingBase.h"
 
-#if !(UE_BUILD_SHIPPING)
 #include "ableSettings.h"
+#if !(UE_BUILD_SHIPPING)
 #include "ableAbilityUtilities.h"
 #endif
 #if WITH_EDITOR
@@ -27,6 +27,10 @@
 #include "Engine/LocalPlayer.h"
 #include "Engine/NetDriver.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "UObject/ObjectKey.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Task Events (Reflected)"), STAT_AbleTaskEventsReflected, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Task Events (Direct)"), STAT_AbleTaskEventsDirect, STATGROUP_Able);
 
 
 #define LOCTEXT_NAMESPACE "AbleAbilityTask"
@@ -199,6 +203,17 @@ void UAbleAbilityTask::PostLoad()
     {
         UE_LOG(LogAbleSP, Warning, TEXT("UAbleAbilityTask.PostLoad() %s had %d NULL Dependencies."), *GetClass()->GetName(), m_Dependencies.Num() - numDependencies);
     }
+
+	m_TaskNameHash = FCrc::StrCrc32(*GetName());
+	INC_DWORD_STAT(STAT_AbleNameHashesComputed);
+}
+
+void UAbleAbilityTask::PostRename(UObject* OldOuter, const FName OldName)
+{
+	Super::PostRename(OldOuter, OldName);
+
+	m_TaskNameHash = FCrc::StrCrc32(*GetName());
+	INC_DWORD_STAT(STAT_AbleNameHashesComputed);
 }
 
 void UAbleAbilityTask::PostInitProperties()
@@ -209,6 +224,18 @@ void UAbleAbilityTask::PostInitProperties()
 	{
 		m_TaskTargets.Add(EAbleAbilityTargetType::ATT_Self);
 	}
+
+	// Per-activation copies are instanced from the template's Task under the same name, so take its hash rather than hashing the name again.
+	const UAbleAbilityTask* Archetype = Cast<UAbleAbilityTask>(GetArchetype());
+	if (Archetype && Archetype != this && Archetype->m_TaskNameHash && Archetype->GetFName() == GetFName())
+	{
+		m_TaskNameHash = Archetype->m_TaskNameHash;
+	}
+	else
+	{
+		m_TaskNameHash = FCrc::StrCrc32(*GetName());
+		INC_DWORD_STAT(STAT_AbleNameHashesComputed);
+	}
 }
 
 UWorld* UAbleAbilityTask::GetWorld() const
@@ -221,6 +248,104 @@ UWorld* UAbleAbilityTask::GetWorld() const
 	return GetOuter()->GetWorld();
 }
 
+namespace AbleTaskEventUtils
+{
+	/* BlueprintNativeEvent names, indexed by EAbleTaskEvent. */
+	static const TCHAR* EventFunctionNames[] = { TEXT("OnTaskStartBP"), TEXT("OnTaskTickBP"), TEXT("OnTaskEndBP"), TEXT("IsDoneBP"), TEXT("OnTaskTickBatchedBP") };
+	static_assert(UE_ARRAY_COUNT(EventFunctionNames) == (int32)EAbleTaskEvent::Count, "EventFunctionNames is out of sync with EAbleTaskEvent.");
+
+	/* Bit mask of overridden events for each Task Class we've seen. Only ever touched on the Game Thread. */
+	static TMap<FObjectKey, uint8> ClassOverrides;
+
+	/* Bumped any time ClassOverrides is flushed, so Tasks know their copy is stale. Never 0. */
+	static uint32 Serial = 1U;
+
+	static bool IsFunctionOverridden(const UClass& Class, FName FunctionName)
+	{
+		const UFunction* Function = Class.FindFunctionByName(FunctionName);
+		if (!Function)
+		{
+			return false;
+		}
+
+		// Blueprint overrides live on a non-native Class (or are script functions).
+		const UClass* OwnerClass = Function->GetOwnerClass();
+		if (!OwnerClass || !OwnerClass->HasAnyClassFlags(CLASS_Native) || !Function->HasAnyFunctionFlags(FUNC_Native))
+		{
+			return true;
+		}
+
+		// Lua overrides either add their own copy of the function to the Class, or swap out the native thunk on the original.
+		for (const FNativeFunctionLookup& Lookup : OwnerClass->NativeFunctionLookupTable)
+		{
+			if (Lookup.Name == FunctionName)
+			{
+				return Lookup.Pointer != Function->GetNativeFunc();
+			}
+		}
+
+		return true;
+	}
+
+	static uint8 GetClassOverrides(const UClass& Class)
+	{
+		if (const uint8* Found = ClassOverrides.Find(FObjectKey(&Class)))
+		{
+			return *Found;
+		}
+
+		uint8 Mask = 0U;
+		for (int32 i = 0; i < (int32)EAbleTaskEvent::Count; ++i)
+		{
+			if (IsFunctionOverridden(Class, FName(EventFunctionNames[i])))
+			{
+				Mask |= 1 << i;
+			}
+		}
+
+		ClassOverrides.Add(FObjectKey(&Class), Mask);
+		return Mask;
+	}
+
+#if WITH_EDITOR
+	/* Lua modules are re-bound (and can change) between PIE sessions, so start each session with a clean slate. */
+	static void FlushClassOverrides(const bool /*bIsSimulating*/)
+	{
+		ClassOverrides.Empty();
+		++Serial;
+	}
+#endif
+}
+
+bool UAbleAbilityTask::HasTaskEventOverride(EAbleTaskEvent Event) const
+{
+	check(IsInGameThread());
+
+#if WITH_EDITOR
+	static const FDelegateHandle BeginPIEHandle = FEditorDelegates::BeginPIE.AddStatic(&AbleTaskEventUtils::FlushClassOverrides);
+#endif
+
+	if (m_OverriddenTaskEventsSerial != AbleTaskEventUtils::Serial)
+	{
+		m_OverriddenTaskEvents = AbleTaskEventUtils::GetClassOverrides(*GetClass());
+		m_OverriddenTaskEventsSerial = AbleTaskEventUtils::Serial;
+	}
+
+	return (m_OverriddenTaskEvents & (1 << (uint8)Event)) != 0;
+}
+
+bool UAbleAbilityTask::IsTaskEventOverridden(EAbleTaskEvent Event) const
+{
+	if (HasTaskEventOverride(Event))
+	{
+		INC_DWORD_STAT(STAT_AbleTaskEventsReflected);
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_AbleTaskEventsDirect);
+	return false;
+}
+
 int32 UAbleAbilityTask::GetFunctionCallspace(UFunction* Function, FFrame* Stack)
 {
 	if (HasAnyFlags(RF_ClassDefaultObject) || !IsSupportedForNetworking())
@@ -395,6 +520,73 @@ void UAbleAbilityTask::BindDynamicDelegates(UAbleAbility* Ability)
 	ABL_BIND_DYNAMIC_PROPERTY(Ability, m_Disabled, TEXT("Disabled"));
 }
 
+void UAbleAbilityTask::GatherSoftAssetReferences(TArray<FSoftObjectPath>& OutPaths) const
+{
+	// Dynamic properties fall back to the value we hold here, so this also covers their defaults.
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		if (const FSoftObjectProperty* SoftProperty = CastField<FSoftObjectProperty>(*It))
+		{
+			const FSoftObjectPath& Path = SoftProperty->GetPropertyValue_InContainer(this).ToSoftObjectPath();
+			if (!Path.IsNull())
+			{
+				OutPaths.AddUnique(Path);
+			}
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*It))
+		{
+			const FSoftObjectProperty* InnerProperty = CastField<FSoftObjectProperty>(ArrayProperty->Inner);
+			if (!InnerProperty)
+			{
+				continue;
+			}
+
+			FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(this));
+			for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+			{
+				const FSoftObjectPath& Path = InnerProperty->GetPropertyValue(ArrayHelper.GetRawPtr(i)).ToSoftObjectPath();
+				if (!Path.IsNull())
+				{
+					OutPaths.AddUnique(Path);
+				}
+			}
+		}
+	}
+}
+
+UObject* UAbleAbilityTask::ResolveSoftAssetPath(const FSoftObjectPath& Path, const UAbleAbilityContext* Context) const
+{
+	if (Path.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (UObject* Loaded = Path.ResolveObject())
+	{
+		return Loaded;
+	}
+
+	// Anything past here is a hitch, the Ability should have streamed this in already.
+	INC_DWORD_STAT(STAT_AbleAssetLoadHitches);
+
+	const USPAbleSettings* Settings = GetDefault<USPAbleSettings>();
+	const EAbleAssetPreloadPolicy Policy = Settings ? Settings->GetAssetPreloadPolicy() : EAbleAssetPreloadPolicy::Disabled;
+	const FString AbilityName = Context && Context->GetAbility() ? Context->GetAbility()->GetAbilityName() : FString();
+
+	if (Policy == EAbleAssetPreloadPolicy::ActivateWithoutAsset)
+	{
+		UE_LOG(LogAbleSP, Verbose, TEXT("Task [%s] in Ability [%s] skipping [%s], it hasn't streamed in yet."), *GetName(), *AbilityName, *Path.ToString());
+		return nullptr;
+	}
+
+	if (Policy != EAbleAssetPreloadPolicy::Disabled)
+	{
+		UE_LOG(LogAbleSP, Warning, TEXT("Task [%s] in Ability [%s] loading [%s] synchronously, it hasn't streamed in yet."), *GetName(), *AbilityName, *Path.ToString());
+	}
+
+	return Path.TryLoad();
+}
+
 #if WITH_EDITOR
 
 FText UAbleAbilityTask::GetRichTextTaskSummary() const
@@ -595,7 +787,8 @@ void UAbleAbilityTask::GetActorsForTask(const TWeakObjectPtr<const UAbleAbilityC
 {
 	verify(m_TaskTargets.Num() != 0 && Context.IsValid());
 
-	OutActorArray.Empty();
+	// Reset rather than Empty, callers may be reusing the array.
+	OutActorArray.Reset();
 	for (TEnumAsByte<EAbleAbilityTargetType> target : m_TaskTargets)
 	{
 		switch (target)
@@ -0,0 +1,567 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#include "Tasks/SPAbilityCollisionDamageTask.h"
+
+#include "ableAbility.h"
+#include "ableAbilityBlueprintLibrary.h"
+#include "ableAbilityComponent.h"
+#include "ableAbilityDebug.h"
+#include "AbleCoreSPPrivate.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+#define LOCTEXT_NAMESPACE "AbleAbilityTask"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Collision Damage Queries"), STAT_SPAbilityCollisionDamage_Queries, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Collision Damage Hits"), STAT_SPAbilityCollisionDamage_Hits, STATGROUP_Able);
+
+namespace SPAbilityCollisionDamageTaskUtils
+{
+	static const FName DamageCountName(TEXT("DamageCount"));
+	static const FName SuperimposedDamageCountName(TEXT("SuperimposedDamageCount"));
+}
+
+USPAbilityCollisionDamageTaskScratchPad::USPAbilityCollisionDamageTaskScratchPad()
+{
+
+}
+
+USPAbilityCollisionDamageTaskScratchPad::~USPAbilityCollisionDamageTaskScratchPad()
+{
+
+}
+
+void USPAbilityCollisionDamageTaskScratchPad::Reset()
+{
+	BaseRange = FSPAbilityShapeRange();
+	CurrentRange = FSPAbilityShapeRange();
+	QueryTransform = FTransform::Identity;
+	TaskTime = 0.0f;
+	TimeSinceRangeUpdate = 0.0f;
+	Interrupted = false;
+	DamageStopped = false;
+	PreviousQueryLocation = FVector::ZeroVector;
+	HasPreviousQuery = false;
+	CanTriggerPerfectDodge = true;
+	DamageRecords.Reset();
+	QueryResults.Reset();
+	DamageResults.Reset();
+}
+
+USPAbilityCollisionDamageTask::USPAbilityCollisionDamageTask(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer),
+	m_CollisionShape(ESPAbilityCollisionShape::Sphere),
+	m_TickCollisionChange(true),
+	m_ChannelPresent(EAbleChannelPresent::ACP_Default),
+	m_IgnoreSelf(true),
+	m_UseWorldStaticInTypes(false),
+	m_UseSweepInDetect(false),
+	m_AdaptOwnerScale(false),
+	m_UpdateRange(false),
+	m_RangeUpdateInterval(0.0f),
+	m_Damage(1.0f),
+	m_DamageId(-1),
+	m_DamageIndex(0),
+	m_DamageForceTrustServer(false),
+	m_SkipSummonAttachmentActorDamage(false),
+	m_DamageInterval(0.0f),
+	m_DamageMaxCount(0),
+	m_InterruptOnCollision(false),
+	m_ComboAbilityId(0),
+	m_ObstacleSegmentName(NAME_None),
+	m_HitAndBranchSegment(false),
+	m_SegmentName(NAME_None),
+	m_BranchWhenHitTarget(false),
+	m_SingleFrame(false),
+	m_TaskRealm(EAbleAbilityTaskRealm::ATR_Server)
+{
+
+}
+
+USPAbilityCollisionDamageTask::~USPAbilityCollisionDamageTask()
+{
+
+}
+
+FString USPAbilityCollisionDamageTask::GetModuleName_Implementation() const
+{
+	return TEXT("Feature.StarP.Script.System.Ability.Task.SPAbilityCollisionDamageTask");
+}
+
+void USPAbilityCollisionDamageTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
+{
+	USPAbilityCollisionDamageTaskScratchPad* ScratchPad = Cast<USPAbilityCollisionDamageTaskScratchPad>(Context->GetScratchPadForTask(this));
+	if (!ScratchPad)
+	{
+		return;
+	}
+
+	ScratchPad->Reset();
+	const_cast<UAbleAbilityContext*>(Context)->SetIntParameter(SPAbilityCollisionDamageTaskUtils::DamageCountName, 0);
+
+	InitShapeRange(*Context, *ScratchPad);
+	CollisionAndDamage(*Context, *ScratchPad, true);
+}
+
+void USPAbilityCollisionDamageTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float DeltaTime) const
+{
+	USPAbilityCollisionDamageTaskScratchPad* ScratchPad = Cast<USPAbilityCollisionDamageTaskScratchPad>(Context->GetScratchPadForTask(this));
+	if (!ScratchPad)
+	{
+		return;
+	}
+
+	ScratchPad->TaskTime += DeltaTime;
+	ScratchPad->TimeSinceRangeUpdate += DeltaTime;
+
+	CollisionAndDamage(*Context, *ScratchPad, false);
+}
+
+void USPAbilityCollisionDamageTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
+{
+	USPAbilityCollisionDamageTaskScratchPad* ScratchPad = Cast<USPAbilityCollisionDamageTaskScratchPad>(Context->GetScratchPadForTask(this));
+	if (!ScratchPad)
+	{
+		return;
+	}
+
+	// Catch anything that happened between our last tick and the end of the Task.
+	ScratchPad->TaskTime = GetEndTime() - GetStartTime();
+	if (!m_SingleFrame && result == EAbleAbilityTaskResult::Successful)
+	{
+		CollisionAndDamage(*Context, *ScratchPad, false);
+	}
+}
+
+TSubclassOf<UAbleAbilityTaskScratchPad> USPAbilityCollisionDamageTask::GetTaskScratchPadClassBP_Implementation(const UAbleAbilityContext* Context) const
+{
+	return USPAbilityCollisionDamageTaskScratchPad::StaticClass();
+}
+
+void USPAbilityCollisionDamageTask::ResetScratchPadBP_Implementation(UAbleAbilityTaskScratchPad* ScratchPad) const
+{
+	if (USPAbilityCollisionDamageTaskScratchPad* DamageScratchPad = Cast<USPAbilityCollisionDamageTaskScratchPad>(ScratchPad))
+	{
+		DamageScratchPad->Reset();
+	}
+}
+
+TStatId USPAbilityCollisionDamageTask::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USPAbilityCollisionDamageTask, STATGROUP_Able);
+}
+
+void USPAbilityCollisionDamageTask::OnDamageTargetsBP_Implementation(const UAbleAbilityContext* Context, const TArray<FAbleQueryResult>& DamageTargets) const
+{
+	TArray<FSPAbilityTaskDamageCommand> Commands;
+	Commands.Reserve(DamageTargets.Num());
+	for (const FAbleQueryResult& Target : DamageTargets)
+	{
+		FSPAbilityTaskDamageCommand& Command = Commands.AddDefaulted_GetRef();
+		Command.Target = Target.Actor.Get();
+		Command.Damage = m_Damage;
+		Command.HitLocation = Target.GetLocation();
+	}
+
+	ApplyDamageCommands(*Context, Commands);
+}
+
+void USPAbilityCollisionDamageTask::OnInterruptBP_Implementation(const UAbleAbilityContext* Context) const
+{
+	if (UAbleAbilityComponent* AbilityComponent = Context->GetSelfAbilityComponent())
+	{
+		AbilityComponent->CancelAbility(Context->GetAbility(), EAbleAbilityTaskResult::Interrupted);
+	}
+}
+
+void USPAbilityCollisionDamageTask::CollisionAndDamage(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad, bool IsStart) const
+{
+	UpdateShapeRange(ScratchPad);
+	DoCollision(Context, ScratchPad, IsStart);
+
+	// Whatever we hit this update still takes damage, even if we interrupt or branch because of it.
+	if (ScratchPad.QueryResults.Num())
+	{
+		ApplyCollisionEffects(Context, ScratchPad);
+	}
+
+	if (ScratchPad.DamageStopped)
+	{
+		return;
+	}
+
+	FilterDamage(Context, ScratchPad);
+
+	const int32 DamageCount = ScratchPad.DamageResults.Num();
+	if (!DamageCount)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_SPAbilityCollisionDamage_Hits, DamageCount);
+
+	for (const FAbleQueryResult& Result : ScratchPad.DamageResults)
+	{
+		FSPAbilityDamageTargetRecord& Record = ScratchPad.DamageRecords.FindOrAdd(Result.Actor.Get());
+		Record.LastDamageTime = ScratchPad.TaskTime;
+		++Record.DamageCount;
+	}
+
+	OnDamageTargetsBP(&Context, ScratchPad.DamageResults);
+
+	UAbleAbilityContext& MutableContext = const_cast<UAbleAbilityContext&>(Context);
+	MutableContext.SetIntParameter(SPAbilityCollisionDamageTaskUtils::SuperimposedDamageCountName, Context.GetIntParameter(SPAbilityCollisionDamageTaskUtils::SuperimposedDamageCountName) + DamageCount);
+	MutableContext.SetIntParameter(SPAbilityCollisionDamageTaskUtils::DamageCountName, DamageCount);
+
+	ApplyDamageEffects(Context, ScratchPad);
+}
+
+void USPAbilityCollisionDamageTask::InitShapeRange(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const
+{
+	FSPAbilityShapeRange& Range = ScratchPad.BaseRange;
+	Range = m_ShapeRange;
+
+	const AActor* Owner = Context.GetSelfActor();
+	if (m_AdaptOwnerScale && Owner)
+	{
+		const FVector OwnerScale = Owner->GetActorScale3D();
+		switch (m_CollisionShape)
+		{
+		case ESPAbilityCollisionShape::Box:
+			Range.HalfExtents *= OwnerScale;
+			break;
+		case ESPAbilityCollisionShape::Sphere:
+			Range.Radius *= OwnerScale.GetMax();
+			break;
+		case ESPAbilityCollisionShape::Capsule:
+			Range.Radius *= FMath::Max(OwnerScale.X, OwnerScale.Y);
+			Range.HalfHeight *= OwnerScale.Z;
+			break;
+		case ESPAbilityCollisionShape::Cone:
+			// Matches the editor preview, XZ drive the Radius and Y the Length.
+			Range.ConeRadius *= FMath::Max(OwnerScale.X, OwnerScale.Z);
+			Range.ConeLength *= OwnerScale.Y;
+			break;
+		case ESPAbilityCollisionShape::Cylinder:
+			Range.CylinderInnerRadius *= FMath::Max(OwnerScale.X, OwnerScale.Y);
+			Range.CylinderOuterRadius *= FMath::Max(OwnerScale.X, OwnerScale.Y);
+			Range.CylinderHeight *= OwnerScale.Z;
+			break;
+		default:
+			break;
+		}
+	}
+
+	ScratchPad.CurrentRange = Range;
+}
+
+void USPAbilityCollisionDamageTask::UpdateShapeRange(USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const
+{
+	if (!m_UpdateRange || ScratchPad.TaskTime <= 0.0f)
+	{
+		return;
+	}
+
+	if (m_RangeUpdateInterval > 0.0f)
+	{
+		if (ScratchPad.TimeSinceRangeUpdate < m_RangeUpdateInterval)
+		{
+			return;
+		}
+		ScratchPad.TimeSinceRangeUpdate = 0.0f;
+	}
+
+	// Grow towards Base + Velocity over Time, or by Velocity every update if there's no Time.
+	const float TaskTime = ScratchPad.TaskTime;
+	auto Grow = [TaskTime](float Base, float Velocity, float Time)
+	{
+		return Time > 0.0f ? Base + FMath::Min(TaskTime / Time, 1.0f) * Velocity : Base + Velocity;
+	};
+
+	const FSPAbilityShapeRange& Base = ScratchPad.BaseRange;
+	FSPAbilityShapeRange& Range = ScratchPad.CurrentRange;
+	const FSPAbilityShapeRangeGrowth& Growth = m_RangeGrowth;
+
+	switch (m_CollisionShape)
+	{
+	case ESPAbilityCollisionShape::Box:
+		Range.HalfExtents.X = Grow(Base.HalfExtents.X, Growth.ExtentsVelocity.X, Growth.ExtentsTime.X);
+		Range.HalfExtents.Y = Grow(Base.HalfExtents.Y, Growth.ExtentsVelocity.Y, Growth.ExtentsTime.Y);
+		Range.HalfExtents.Z = Grow(Base.HalfExtents.Z, Growth.ExtentsVelocity.Z, Growth.ExtentsTime.Z);
+		break;
+	case ESPAbilityCollisionShape::Sphere:
+		Range.Radius = Grow(Base.Radius, Growth.RadiusVelocity, Growth.RadiusTime);
+		break;
+	case ESPAbilityCollisionShape::Capsule:
+		Range.Radius = Grow(Base.Radius, Growth.RadiusVelocity, Growth.RadiusTime);
+		Range.HalfHeight = Grow(Base.HalfHeight, Growth.HeightVelocity, Growth.HeightTime);
+		break;
+	case ESPAbilityCollisionShape::Cylinder:
+		if (Growth.CylinderRadiusTime > 0.0f)
+		{
+			// The ring starts where it was last update, so fast growth doesn't skip over anything.
+			const float Change = Growth.CylinderMaxOuterRadius < 0.0f ? -Base.CylinderOuterRadius : Growth.CylinderMaxOuterRadius - Base.CylinderOuterRadius;
+			Range.CylinderInnerRadius = Range.CylinderOuterRadius;
+			Range.CylinderOuterRadius = Grow(Base.CylinderOuterRadius, Change, Growth.CylinderRadiusTime);
+		}
+		else
+		{
+			Range.CylinderInnerRadius += Growth.CylinderRadiusVelocity;
+			Range.CylinderOuterRadius += Growth.CylinderRadiusVelocity;
+		}
+		Range.CylinderHeight = Grow(Base.CylinderHeight, Growth.CylinderHeightVelocity, Growth.CylinderHeightTime);
+		break;
+	default:
+		break;
+	}
+}
+
+void USPAbilityCollisionDamageTask::DoCollision(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad, bool IsStart) const
+{
+	ScratchPad.QueryResults.Reset();
+
+	AActor* Owner = Context.GetSelfActor();
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	if (IsStart || m_TickCollisionChange)
+	{
+		m_QueryLocation.GetTransform(Context, ScratchPad.QueryTransform);
+	}
+
+	INC_DWORD_STAT(STAT_SPAbilityCollisionDamage_Queries);
+
+	const FSPAbilityShapeRange& Range = ScratchPad.CurrentRange;
+	const FTransform& QueryTransform = ScratchPad.QueryTransform;
+	const FVector Forward = QueryTransform.GetRotation().GetForwardVector();
+
+	// Cones and Cylinders query their bounds and are trimmed down below.
+	FCollisionShape Shape;
+	FVector QueryLocation = QueryTransform.GetLocation();
+	switch (m_CollisionShape)
+	{
+	case ESPAbilityCollisionShape::Box:
+		Shape = FCollisionShape::MakeBox(Range.HalfExtents);
+		QueryLocation += Forward * Range.HalfExtents.X;
+		break;
+	case ESPAbilityCollisionShape::Sphere:
+		Shape = FCollisionShape::MakeSphere(Range.Radius);
+		break;
+	case ESPAbilityCollisionShape::Capsule:
+		Shape = FCollisionShape::MakeCapsule(Range.Radius, Range.HalfHeight);
+		break;
+	case ESPAbilityCollisionShape::Cone:
+		Shape = FCollisionShape::MakeSphere(FMath::Sqrt(FMath::Square(Range.ConeLength) + FMath::Square(Range.ConeRadius)));
+		break;
+	case ESPAbilityCollisionShape::Cylinder:
+		Shape = FCollisionShape::MakeBox(FVector(Range.CylinderOuterRadius, Range.CylinderOuterRadius, Range.CylinderHeight * 0.5f));
+		break;
+	default:
+		return;
+	}
+
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(&Context, m_ChannelPresent, m_CollisionChannels);
+	if (m_UseWorldStaticInTypes)
+	{
+		ObjectQuery.AddObjectTypesToQuery(ECC_WorldStatic);
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SPAbilityCollisionDamage), false);
+	if (m_IgnoreSelf)
+	{
+		QueryParams.AddIgnoredActor(Owner);
+	}
+
+	TArray<FAbleQueryResult> Candidates;
+	if (m_UseSweepInDetect && ScratchPad.HasPreviousQuery && !ScratchPad.PreviousQueryLocation.Equals(QueryLocation))
+	{
+		TArray<FHitResult> Hits;
+		World->SweepMultiByObjectType(Hits, ScratchPad.PreviousQueryLocation, QueryLocation, QueryTransform.GetRotation(), ObjectQuery, Shape, QueryParams);
+		Candidates.Append(Hits);
+	}
+	else
+	{
+		TArray<FOverlapResult> Overlaps;
+		World->OverlapMultiByObjectType(Overlaps, QueryLocation, QueryTransform.GetRotation(), ObjectQuery, Shape, QueryParams);
+		Candidates.Append(Overlaps);
+	}
+
+	ScratchPad.PreviousQueryLocation = QueryLocation;
+	ScratchPad.HasPreviousQuery = true;
+
+	const float ConeCosAngle = FMath::Cos(FMath::Atan2(Range.ConeRadius, Range.ConeLength));
+	const float CylinderCosHalfAngle = FMath::Cos(FMath::DegreesToRadians(Range.CylinderAngle * 0.5f));
+	const FVector Origin = QueryTransform.GetLocation();
+
+	for (const FAbleQueryResult& Result : Candidates)
+	{
+		if (!Result.Actor.IsValid())
+		{
+			continue;
+		}
+
+		if (m_CollisionShape == ESPAbilityCollisionShape::Cone)
+		{
+			const FVector ToTarget = Result.GetLocation() - Origin;
+			const float AlongAxis = FVector::DotProduct(ToTarget, Forward);
+			if (AlongAxis < 0.0f || AlongAxis > Range.ConeLength || FVector::DotProduct(ToTarget.GetSafeNormal(), Forward) < ConeCosAngle)
+			{
+				continue;
+			}
+		}
+		else if (m_CollisionShape == ESPAbilityCollisionShape::Cylinder)
+		{
+			const FVector ToTarget2D = (Result.GetLocation() - Origin) * FVector(1.0f, 1.0f, 0.0f);
+			const float DistanceSqr = ToTarget2D.SizeSquared();
+			if (DistanceSqr < FMath::Square(Range.CylinderInnerRadius) || DistanceSqr > FMath::Square(Range.CylinderOuterRadius))
+			{
+				continue;
+			}
+
+			if (Range.CylinderAngle < 360.0f && FVector::DotProduct(ToTarget2D.GetSafeNormal(), Forward.GetSafeNormal2D()) < CylinderCosHalfAngle)
+			{
+				continue;
+			}
+		}
+
+		ScratchPad.QueryResults.AddUnique(Result);
+	}
+
+	for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
+	{
+		if (CollisionFilter && ScratchPad.QueryResults.Num())
+		{
+			CollisionFilter->Filter(&Context, ScratchPad.QueryResults);
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (FAbleAbilityDebug::ShouldDrawQueries())
+	{
+		switch (m_CollisionShape)
+		{
+		case ESPAbilityCollisionShape::Box:
+			FAbleAbilityDebug::DrawBoxQuery(World, FTransform(QueryTransform.GetRotation(), QueryLocation), Range.HalfExtents);
+			break;
+		case ESPAbilityCollisionShape::Sphere:
+			FAbleAbilityDebug::DrawSphereQuery(World, QueryTransform, Range.Radius);
+			break;
+		case ESPAbilityCollisionShape::Capsule:
+			FAbleAbilityDebug::DrawCapsuleQuery(World, QueryTransform, Range.Radius, Range.HalfHeight * 2.0f);
+			break;
+		case ESPAbilityCollisionShape::Cone:
+			FAbleAbilityDebug::DrawConeQueryWithRadius(World, QueryTransform, Range.ConeRadius, Range.ConeLength);
+			break;
+		case ESPAbilityCollisionShape::Cylinder:
+			FAbleAbilityDebug::DrawCapsuleQuery(World, QueryTransform, Range.CylinderOuterRadius, Range.CylinderHeight);
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (IsVerbose())
+	{
+		PrintVerbose(&Context, FString::Printf(TEXT("Collision Damage query found %d results."), ScratchPad.QueryResults.Num()));
+	}
+#endif
+}
+
+void USPAbilityCollisionDamageTask::FilterDamage(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const
+{
+	ScratchPad.DamageResults.Reset();
+
+	const AActor* SelfActor = Context.GetSelfActor();
+	const AActor* AttachParent = m_SkipSummonAttachmentActorDamage && SelfActor ? SelfActor->GetAttachParentActor() : nullptr;
+
+	for (const FAbleQueryResult& Result : ScratchPad.QueryResults)
+	{
+		const AActor* Actor = Result.Actor.Get();
+		if (!Actor || Actor->IsPendingKill() || !Actor->CanBeDamaged() || IsActorDead(Actor))
+		{
+			continue;
+		}
+
+		if (AttachParent && Actor == AttachParent)
+		{
+			continue;
+		}
+
+		if (const FSPAbilityDamageTargetRecord* Record = ScratchPad.DamageRecords.Find(Actor))
+		{
+			if (m_DamageInterval > 0.0f && ScratchPad.TaskTime - Record->LastDamageTime < m_DamageInterval)
+			{
+				continue;
+			}
+
+			if (m_DamageMaxCount > 0 && Record->DamageCount >= m_DamageMaxCount)
+			{
+				continue;
+			}
+		}
+
+		// Only damage each Actor once per update, no matter how many of its components we overlapped.
+		if (!ScratchPad.DamageResults.ContainsByPredicate([Actor](const FAbleQueryResult& Existing) { return Existing.Actor.Get() == Actor; }))
+		{
+			ScratchPad.DamageResults.Add(Result);
+		}
+	}
+}
+
+void USPAbilityCollisionDamageTask::ApplyCollisionEffects(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const
+{
+	UAbleAbilityComponent* AbilityComponent = Context.GetSelfAbilityComponent();
+	if (!AbilityComponent || ScratchPad.Interrupted)
+	{
+		return;
+	}
+
+	if (m_InterruptOnCollision)
+	{
+		ScratchPad.Interrupted = true;
+		OnInterruptBP(&Context);
+		return;
+	}
+
+	if (m_ObstacleSegmentName != NAME_None)
+	{
+		for (const FAbleQueryResult& Result : ScratchPad.QueryResults)
+		{
+			const UPrimitiveComponent* Component = Result.PrimitiveComponent.Get();
+			if (Component && Component->GetCollisionObjectType() == ECC_WorldStatic && AbilityComponent->BranchSegmentWithName(&Context, m_ObstacleSegmentName))
+			{
+				ScratchPad.Interrupted = true;
+				return;
+			}
+		}
+	}
+}
+
+void USPAbilityCollisionDamageTask::ApplyDamageEffects(const UAbleAbilityContext& Context, USPAbilityCollisionDamageTaskScratchPad& ScratchPad) const
+{
+	if (!m_HitAndBranchSegment || ScratchPad.Interrupted)
+	{
+		return;
+	}
+
+	if (m_BranchWhenHitTarget)
+	{
+		const AActor* Target = GetSingleActorFromTargetType(&Context, EAbleAbilityTargetType::ATT_TargetActor);
+		if (!ScratchPad.DamageResults.ContainsByPredicate([Target](const FAbleQueryResult& Result) { return Result.Actor.Get() == Target; }))
+		{
+			return;
+		}
+	}
+
+	UAbleAbilityComponent* AbilityComponent = Context.GetSelfAbilityComponent();
+	if (AbilityComponent && AbilityComponent->BranchSegmentWithName(&Context, m_SegmentName))
+	{
+		ScratchPad.Interrupted = true;
+		ScratchPad.DamageStopped = true;
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,631 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#include "Tasks/SPAbilityLaserTask.h"
+
+#include "ableAbility.h"
+#include "ableAbilityBlueprintLibrary.h"
+#include "ableAbilityDebug.h"
+#include "AbleCoreSPPrivate.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+
+#define LOCTEXT_NAMESPACE "AbleAbilityTask"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Laser Queries"), STAT_SPAbilityLaser_Queries, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Laser Sweep Steps"), STAT_SPAbilityLaser_SweepSteps, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Laser Hits"), STAT_SPAbilityLaser_Hits, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Laser Effects Spawned"), STAT_SPAbilityLaser_EffectsSpawned, STATGROUP_Able);
+
+namespace SPAbilityLaserTaskUtils
+{
+	static const FName EmitterRateScaleName(TEXT("emitter_rate_scale"));
+	static const FName SizeScaleName(TEXT("size_scale"));
+	static const FName DamageCountName(TEXT("DamageCount"));
+	static const FName SuperimposedDamageCountName(TEXT("SuperimposedDamageCount"));
+
+	static void StopEffect(TWeakObjectPtr<UParticleSystemComponent>& Effect, bool Detach)
+	{
+		if (UParticleSystemComponent* Component = Effect.Get())
+		{
+			if (Detach)
+			{
+				Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+			}
+			Component->DeactivateSystem();
+		}
+		Effect.Reset();
+	}
+}
+
+USPAbilityLaserTaskScratchPad::USPAbilityLaserTaskScratchPad()
+{
+
+}
+
+USPAbilityLaserTaskScratchPad::~USPAbilityLaserTaskScratchPad()
+{
+
+}
+
+void USPAbilityLaserTaskScratchPad::Reset()
+{
+	QueryTransform = FTransform::Identity;
+	SweepStartRotation = FRotator::ZeroRotator;
+	SweepEndRotation = FRotator::ZeroRotator;
+	PreviousBeamStart = FVector::ZeroVector;
+	PreviousBeamRotation = FQuat::Identity;
+	HasPreviousBeam = false;
+	IsSweeping = false;
+	TaskTime = 0.0f;
+	HitPoint = FVector::ZeroVector;
+	HitNormal = FVector::ZeroVector;
+	HasHitPoint = false;
+	HitPointIsBody = false;
+	ParticleTransform = FTransform::Identity;
+	HasParticleTransform = false;
+	BeamEffect.Reset();
+	HitBodyEffect.Reset();
+	HitSceneEffect.Reset();
+	CanTriggerPerfectDodge = true;
+	DamageRecords.Reset();
+	QueryResults.Reset();
+	StepResults.Reset();
+	DamageResults.Reset();
+	StepHits.Reset();
+}
+
+USPAbilityLaserTask::USPAbilityLaserTask(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer),
+	m_TickCollisionChange(true),
+	m_BeamLength(2000.0f),
+	m_BeamRadius(0.0f),
+	m_MaxSweepSteps(8),
+	m_ChannelPresent(EAbleChannelPresent::ACP_Default),
+	m_IgnoreSelf(true),
+	m_IsSweeping(false),
+	m_SweepStartLength(0.0f),
+	m_SweepLength(1000.0f),
+	m_SweepChangeCurve(nullptr),
+	m_SweepRotatorOffset(ForceInitToZero),
+	m_Damage(1.0f),
+	m_DamageId(-1),
+	m_DamageIndex(0),
+	m_DamageForceTrustServer(false),
+	m_DamageInterval(0.5f),
+	m_EffectTemplate(nullptr),
+	m_TickParticleChange(true),
+	m_AttachToSocket(false),
+	m_Scale(1.0f),
+	m_CanEditScaleX(true),
+	m_CanEditScaleY(false),
+	m_CanEditScaleZ(false),
+	m_ParticleNormalizeLength(0.0f),
+	m_ParticleMaxLength(2000.0f),
+	m_RenderSortPriority(0),
+	m_DetachOnStop(false),
+	m_HitBodyEffectTemplate(nullptr),
+	m_HitSceneEffectTemplate(nullptr),
+	m_AlignHitEffectToNormal(true),
+	m_EndingEffectTemplate(nullptr)
+{
+
+}
+
+USPAbilityLaserTask::~USPAbilityLaserTask()
+{
+
+}
+
+FString USPAbilityLaserTask::GetModuleName_Implementation() const
+{
+	return TEXT("Feature.StarP.Script.System.Ability.Task.SPAbilityLaserTask");
+}
+
+void USPAbilityLaserTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
+{
+	USPAbilityLaserTaskScratchPad* ScratchPad = Cast<USPAbilityLaserTaskScratchPad>(Context->GetScratchPadForTask(this));
+	if (!ScratchPad)
+	{
+		return;
+	}
+
+	ScratchPad->Reset();
+	const_cast<UAbleAbilityContext*>(Context)->SetIntParameter(SPAbilityLaserTaskUtils::DamageCountName, 0);
+
+	CollisionAndDamage(*Context, *ScratchPad, true);
+}
+
+void USPAbilityLaserTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float DeltaTime) const
+{
+	USPAbilityLaserTaskScratchPad* ScratchPad = Cast<USPAbilityLaserTaskScratchPad>(Context->GetScratchPadForTask(this));
+	if (!ScratchPad)
+	{
+		return;
+	}
+
+	ScratchPad->TaskTime += DeltaTime;
+	CollisionAndDamage(*Context, *ScratchPad, false);
+}
+
+void USPAbilityLaserTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
+{
+	USPAbilityLaserTaskScratchPad* ScratchPad = Cast<USPAbilityLaserTaskScratchPad>(Context->GetScratchPadForTask(this));
+	if (!ScratchPad)
+	{
+		return;
+	}
+
+	StopEffects(*Context, *ScratchPad);
+}
+
+TSubclassOf<UAbleAbilityTaskScratchPad> USPAbilityLaserTask::GetTaskScratchPadClassBP_Implementation(const UAbleAbilityContext* Context) const
+{
+	return USPAbilityLaserTaskScratchPad::StaticClass();
+}
+
+void USPAbilityLaserTask::ResetScratchPadBP_Implementation(UAbleAbilityTaskScratchPad* ScratchPad) const
+{
+	if (USPAbilityLaserTaskScratchPad* LaserScratchPad = Cast<USPAbilityLaserTaskScratchPad>(ScratchPad))
+	{
+		LaserScratchPad->Reset();
+	}
+}
+
+TStatId USPAbilityLaserTask::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USPAbilityLaserTask, STATGROUP_Able);
+}
+
+void USPAbilityLaserTask::OnDamageTargetsBP_Implementation(const UAbleAbilityContext* Context, const TArray<FAbleQueryResult>& DamageTargets) const
+{
+	TArray<FSPAbilityTaskDamageCommand> Commands;
+	Commands.Reserve(DamageTargets.Num());
+	for (const FAbleQueryResult& Target : DamageTargets)
+	{
+		FSPAbilityTaskDamageCommand& Command = Commands.AddDefaulted_GetRef();
+		Command.Target = Target.Actor.Get();
+		Command.Damage = m_Damage;
+		Command.HitLocation = Target.GetLocation();
+	}
+
+	ApplyDamageCommands(*Context, Commands);
+}
+
+void USPAbilityLaserTask::CollisionAndDamage(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, bool IsStart) const
+{
+	const AActor* Owner = Context.GetSelfActor();
+	if (!Owner)
+	{
+		return;
+	}
+
+	UpdateBeamTransform(Context, ScratchPad, IsStart);
+
+	// Clients still query so the effects know where the beam stops, they just don't do damage.
+	DoQuery(Context, ScratchPad);
+
+	const ENetMode NetMode = Owner->GetNetMode();
+	if (NetMode != NM_Client)
+	{
+		FilterDamage(ScratchPad);
+
+		const int32 DamageCount = ScratchPad.DamageResults.Num();
+		if (DamageCount)
+		{
+			INC_DWORD_STAT_BY(STAT_SPAbilityLaser_Hits, DamageCount);
+
+			for (const FAbleQueryResult& Result : ScratchPad.DamageResults)
+			{
+				FSPAbilityDamageTargetRecord& Record = ScratchPad.DamageRecords.FindOrAdd(Result.Actor.Get());
+				Record.LastDamageTime = ScratchPad.TaskTime;
+				++Record.DamageCount;
+			}
+
+			OnDamageTargetsBP(&Context, ScratchPad.DamageResults);
+
+			UAbleAbilityContext& MutableContext = const_cast<UAbleAbilityContext&>(Context);
+			MutableContext.SetIntParameter(SPAbilityLaserTaskUtils::SuperimposedDamageCountName, Context.GetIntParameter(SPAbilityLaserTaskUtils::SuperimposedDamageCountName) + DamageCount);
+			MutableContext.SetIntParameter(SPAbilityLaserTaskUtils::DamageCountName, DamageCount);
+		}
+	}
+
+	if (NetMode != NM_DedicatedServer)
+	{
+		SpawnOrUpdateBeamEffect(Context, ScratchPad, IsStart);
+		SpawnOrUpdateHitEffect(Context, ScratchPad);
+	}
+}
+
+void USPAbilityLaserTask::InitSweep(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const
+{
+	ScratchPad.IsSweeping = false;
+
+	const AActor* Owner = Context.GetSelfActor();
+	const TArray<TWeakObjectPtr<AActor>>& TargetActors = Context.GetTargetActorsWeakPtr();
+	const AActor* FirstTarget = TargetActors.Num() ? TargetActors[0].Get() : nullptr;
+	if (!Owner || !FirstTarget)
+	{
+#if !UE_BUILD_SHIPPING
+		if (IsVerbose())
+		{
+			PrintVerbose(&Context, TEXT("Laser has no Target to sweep towards, falling back to a fixed beam."));
+		}
+#endif
+		return;
+	}
+
+	// Sweep from just in front of us to past the Target, along the line between us.
+	const FVector OwnerLocation = Owner->GetActorLocation();
+	const FVector OwnerToTarget = (FirstTarget->GetActorLocation() - OwnerLocation).GetSafeNormal();
+	const float StartDistance = Owner->GetSimpleCollisionRadius() + m_SweepStartLength;
+	const FVector StartLocation = OwnerLocation + OwnerToTarget * StartDistance;
+	const FVector EndLocation = OwnerLocation + OwnerToTarget * (StartDistance + m_SweepLength);
+
+	const FVector BeamStart = ScratchPad.QueryTransform.GetLocation();
+	ScratchPad.SweepStartRotation = (StartLocation - BeamStart).Rotation();
+	ScratchPad.SweepEndRotation = (EndLocation - BeamStart).Rotation();
+	ScratchPad.IsSweeping = true;
+}
+
+void USPAbilityLaserTask::UpdateBeamTransform(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, bool IsStart) const
+{
+	if (IsStart || m_TickCollisionChange)
+	{
+		m_QueryLocation.GetTransform(Context, ScratchPad.QueryTransform);
+	}
+
+	if (IsStart && m_IsSweeping)
+	{
+		InitSweep(Context, ScratchPad);
+	}
+
+	if (!ScratchPad.IsSweeping)
+	{
+		return;
+	}
+
+	const float Duration = GetEndTime() - GetStartTime();
+	float Progress = Duration > 0.0f ? FMath::Clamp(ScratchPad.TaskTime / Duration, 0.0f, 1.0f) : 0.0f;
+	if (m_SweepChangeCurve)
+	{
+		Progress = m_SweepChangeCurve->GetFloatValue(Progress);
+	}
+
+	// Straight component lerp rather than shortest path, same as the Lua version (RLerp).
+	const FRotator SweepRotation = ScratchPad.SweepStartRotation + (ScratchPad.SweepEndRotation - ScratchPad.SweepStartRotation) * Progress;
+	ScratchPad.QueryTransform.SetRotation(SweepRotation.Quaternion());
+}
+
+void USPAbilityLaserTask::DoQuery(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const
+{
+	ScratchPad.QueryResults.Reset();
+	ScratchPad.HasHitPoint = false;
+	ScratchPad.HitPointIsBody = false;
+
+	AActor* Owner = Context.GetSelfActor();
+	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+	if (!World)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_SPAbilityLaser_Queries);
+
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(&Context, m_ChannelPresent, m_CollisionChannels);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SPAbilityLaser), false);
+	if (m_IgnoreSelf)
+	{
+		QueryParams.AddIgnoredActor(Owner);
+	}
+
+	const FVector BeamStart = ScratchPad.QueryTransform.GetLocation();
+	const FQuat BeamRotation = ScratchPad.QueryTransform.GetRotation();
+
+	// Step from the previous pose to this one, far enough apart that the beam can't skip over anything its own width.
+	int32 NumSteps = 1;
+	if (ScratchPad.HasPreviousBeam)
+	{
+		const float TipTravel = ScratchPad.PreviousBeamRotation.AngularDistance(BeamRotation) * m_BeamLength + FVector::Dist(ScratchPad.PreviousBeamStart, BeamStart);
+		const float StepSpacing = FMath::Max(m_BeamRadius * 2.0f, 1.0f);
+		NumSteps = FMath::Clamp(FMath::CeilToInt(TipTravel / StepSpacing), 1, FMath::Max(m_MaxSweepSteps, 1));
+	}
+
+	INC_DWORD_STAT_BY(STAT_SPAbilityLaser_SweepSteps, NumSteps);
+
+	// Fixed beams stop at the first thing they hit, sweeping beams go through everything.
+	const bool Pierce = ScratchPad.IsSweeping;
+
+	for (int32 Step = 1; Step <= NumSteps; ++Step)
+	{
+		FVector StepStart = BeamStart;
+		FQuat StepRotation = BeamRotation;
+		if (Step < NumSteps)
+		{
+			const float Alpha = (float)Step / (float)NumSteps;
+			StepStart = FMath::Lerp(ScratchPad.PreviousBeamStart, BeamStart, Alpha);
+			StepRotation = FQuat::Slerp(ScratchPad.PreviousBeamRotation, BeamRotation, Alpha);
+		}
+
+		QueryBeam(Context, ScratchPad, *World, StepStart, StepRotation, ObjectQuery, QueryParams);
+		if (!ScratchPad.StepResults.Num())
+		{
+			continue;
+		}
+
+		if (Pierce)
+		{
+			for (const FAbleQueryResult& Result : ScratchPad.StepResults)
+			{
+				ScratchPad.QueryResults.AddUnique(Result);
+			}
+		}
+		else
+		{
+			ScratchPad.QueryResults.AddUnique(ScratchPad.StepResults[0]);
+		}
+
+		// The final step is our current pose, which is what the effects line up with.
+		if (Step == NumSteps)
+		{
+			const FAbleQueryResult& First = ScratchPad.StepResults[0];
+			const FHitResult* FirstHit = ScratchPad.StepHits.FindByPredicate([&First](const FHitResult& Hit) { return Hit.GetComponent() == First.PrimitiveComponent.Get(); });
+			if (FirstHit)
+			{
+				ScratchPad.HitPoint = FirstHit->ImpactPoint;
+				ScratchPad.HitNormal = FirstHit->ImpactNormal;
+				ScratchPad.HasHitPoint = true;
+				ScratchPad.HitPointIsBody = Cast<APawn>(First.Actor.Get()) != nullptr;
+			}
+		}
+	}
+
+	ScratchPad.PreviousBeamStart = BeamStart;
+	ScratchPad.PreviousBeamRotation = BeamRotation;
+	ScratchPad.HasPreviousBeam = true;
+
+#if !UE_BUILD_SHIPPING
+	if (FAbleAbilityDebug::ShouldDrawQueries())
+	{
+		const FVector BeamEnd = BeamStart + BeamRotation.GetForwardVector() * m_BeamLength;
+		if (m_BeamRadius > 0.0f)
+		{
+			FAbleAbilityDebug::DrawSphereSweep(World, FTransform(BeamRotation, BeamStart), FTransform(BeamRotation, BeamEnd), m_BeamRadius);
+		}
+		else
+		{
+			FAbleAbilityDebug::DrawRaycastQuery(World, BeamStart, BeamEnd);
+		}
+	}
+
+	if (IsVerbose())
+	{
+		PrintVerbose(&Context, FString::Printf(TEXT("Laser query found %d results over %d steps."), ScratchPad.QueryResults.Num(), NumSteps));
+	}
+#endif
+}
+
+void USPAbilityLaserTask::QueryBeam(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, UWorld& World, const FVector& Start, const FQuat& Rotation,
+	const FCollisionObjectQueryParams& ObjectQuery, const FCollisionQueryParams& QueryParams) const
+{
+	ScratchPad.StepHits.Reset();
+	ScratchPad.StepResults.Reset();
+
+	const FVector End = Start + Rotation.GetForwardVector() * m_BeamLength;
+	if (m_BeamRadius > 0.0f)
+	{
+		World.SweepMultiByObjectType(ScratchPad.StepHits, Start, End, Rotation, ObjectQuery, FCollisionShape::MakeSphere(m_BeamRadius), QueryParams);
+	}
+	else
+	{
+		World.LineTraceMultiByObjectType(ScratchPad.StepHits, Start, End, ObjectQuery, QueryParams);
+	}
+
+	if (!ScratchPad.StepHits.Num())
+	{
+		return;
+	}
+
+	// Closest first, so the first result is where the beam stops.
+	ScratchPad.StepHits.Sort([&Start](const FHitResult& A, const FHitResult& B)
+	{
+		return FVector::DistSquared(Start, A.ImpactPoint) < FVector::DistSquared(Start, B.ImpactPoint);
+	});
+
+	for (const FHitResult& Hit : ScratchPad.StepHits)
+	{
+		FAbleQueryResult Result(Hit);
+		if (Result.Actor.IsValid())
+		{
+			ScratchPad.StepResults.AddUnique(Result);
+		}
+	}
+
+	for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
+	{
+		if (CollisionFilter && ScratchPad.StepResults.Num())
+		{
+			CollisionFilter->Filter(&Context, ScratchPad.StepResults);
+		}
+	}
+}
+
+void USPAbilityLaserTask::FilterDamage(USPAbilityLaserTaskScratchPad& ScratchPad) const
+{
+	ScratchPad.DamageResults.Reset();
+
+	for (const FAbleQueryResult& Result : ScratchPad.QueryResults)
+	{
+		const AActor* Actor = Result.Actor.Get();
+		if (!Actor || Actor->IsPendingKill() || !Actor->CanBeDamaged() || IsActorDead(Actor))
+		{
+			continue;
+		}
+
+		if (const FSPAbilityDamageTargetRecord* Record = ScratchPad.DamageRecords.Find(Actor))
+		{
+			if (m_DamageInterval > 0.0f && ScratchPad.TaskTime - Record->LastDamageTime < m_DamageInterval)
+			{
+				continue;
+			}
+		}
+
+		// Only damage each Actor once per update, no matter how many of its components we hit.
+		if (!ScratchPad.DamageResults.ContainsByPredicate([Actor](const FAbleQueryResult& Existing) { return Existing.Actor.Get() == Actor; }))
+		{
+			ScratchPad.DamageResults.Add(Result);
+		}
+	}
+}
+
+FTransform USPAbilityLaserTask::GetParticleTransform(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, float& OutLengthScale) const
+{
+	if (!ScratchPad.HasParticleTransform || m_TickParticleChange)
+	{
+		m_ParticleLocation.GetTransform(Context, ScratchPad.ParticleTransform);
+		ScratchPad.HasParticleTransform = true;
+	}
+
+	FTransform Transform = ScratchPad.ParticleTransform;
+	if (ScratchPad.IsSweeping)
+	{
+		Transform = ScratchPad.QueryTransform;
+		Transform.SetRotation((m_SweepRotatorOffset + ScratchPad.QueryTransform.Rotator()).Quaternion());
+	}
+
+	// Stretch the effect to where the beam stops. Sweeping beams always use their full length.
+	OutLengthScale = 1.0f;
+	if (m_ParticleNormalizeLength > 0.0f)
+	{
+		const float MaxScale = m_ParticleMaxLength / m_ParticleNormalizeLength;
+		OutLengthScale = MaxScale;
+		if (ScratchPad.HasHitPoint && !ScratchPad.IsSweeping)
+		{
+			OutLengthScale = FMath::Min(FVector::Dist(Transform.GetLocation(), ScratchPad.HitPoint) / m_ParticleNormalizeLength, MaxScale);
+		}
+	}
+
+	Transform.SetScale3D(FVector(m_CanEditScaleX ? OutLengthScale : m_Scale, m_CanEditScaleY ? OutLengthScale : m_Scale, m_CanEditScaleZ ? OutLengthScale : m_Scale));
+	return Transform;
+}
+
+UParticleSystemComponent* USPAbilityLaserTask::SpawnBeamEmitter(const UAbleAbilityContext& Context, UParticleSystem* Template, const FTransform& Transform) const
+{
+	AActor* Owner = Context.GetSelfActor();
+	if (!Template || !Owner)
+	{
+		return nullptr;
+	}
+
+	UParticleSystemComponent* SpawnedEffect = nullptr;
+	if (m_AttachToSocket)
+	{
+		USceneComponent* AttachComponent = Owner->FindComponentByClass<USkeletalMeshComponent>();
+		if (!AttachComponent) AttachComponent = Owner->FindComponentByClass<USceneComponent>();
+
+		SpawnedEffect = UGameplayStatics::SpawnEmitterAttached(Template, AttachComponent, m_QueryLocation.GetSocketName(), Transform.GetLocation(), Transform.Rotator(), Transform.GetScale3D(), EAttachLocation::KeepWorldPosition);
+	}
+	else
+	{
+		SpawnedEffect = UGameplayStatics::SpawnEmitterAtLocation(Owner->GetWorld(), Template, Transform);
+	}
+
+	if (SpawnedEffect)
+	{
+		INC_DWORD_STAT(STAT_SPAbilityLaser_EffectsSpawned);
+		SpawnedEffect->TranslucencySortPriority = m_RenderSortPriority;
+	}
+
+	return SpawnedEffect;
+}
+
+void USPAbilityLaserTask::SpawnOrUpdateBeamEffect(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad, bool IsStart) const
+{
+	if (!m_EffectTemplate)
+	{
+		return;
+	}
+
+	float LengthScale = 1.0f;
+	const FTransform Transform = GetParticleTransform(Context, ScratchPad, LengthScale);
+
+	UParticleSystemComponent* BeamEffect = ScratchPad.BeamEffect.Get();
+	if (BeamEffect)
+	{
+		BeamEffect->SetWorldTransform(Transform);
+	}
+	else if (IsStart)
+	{
+		// Only spawn on start, if the effect goes away on its own we don't bring it back.
+		BeamEffect = SpawnBeamEmitter(Context, m_EffectTemplate, Transform);
+		ScratchPad.BeamEffect = BeamEffect;
+	}
+
+	if (BeamEffect)
+	{
+		// Some beams are authored to stretch through parameters rather than scale.
+		BeamEffect->SetFloatParameter(SPAbilityLaserTaskUtils::EmitterRateScaleName, LengthScale);
+		BeamEffect->SetVectorParameter(SPAbilityLaserTaskUtils::SizeScaleName, FVector(LengthScale, 1.0f, 1.0f));
+	}
+}
+
+void USPAbilityLaserTask::SpawnOrUpdateHitEffect(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const
+{
+	if (!m_HitBodyEffectTemplate && !m_HitSceneEffectTemplate)
+	{
+		return;
+	}
+
+	if (!ScratchPad.HasHitPoint)
+	{
+		SPAbilityLaserTaskUtils::StopEffect(ScratchPad.HitBodyEffect, false);
+		SPAbilityLaserTaskUtils::StopEffect(ScratchPad.HitSceneEffect, false);
+		return;
+	}
+
+	// Only one of the two is ever playing.
+	TWeakObjectPtr<UParticleSystemComponent>& ActiveEffect = ScratchPad.HitPointIsBody ? ScratchPad.HitBodyEffect : ScratchPad.HitSceneEffect;
+	TWeakObjectPtr<UParticleSystemComponent>& InactiveEffect = ScratchPad.HitPointIsBody ? ScratchPad.HitSceneEffect : ScratchPad.HitBodyEffect;
+	UParticleSystem* Template = ScratchPad.HitPointIsBody ? m_HitBodyEffectTemplate : m_HitSceneEffectTemplate;
+
+	SPAbilityLaserTaskUtils::StopEffect(InactiveEffect, false);
+
+	const FRotator HitRotation = m_AlignHitEffectToNormal ? ScratchPad.HitNormal.Rotation() : ScratchPad.QueryTransform.Rotator();
+	if (UParticleSystemComponent* HitEffect = ActiveEffect.Get())
+	{
+		HitEffect->SetWorldLocationAndRotation(ScratchPad.HitPoint, HitRotation);
+	}
+	else if (Template)
+	{
+		AActor* Owner = Context.GetSelfActor();
+		UParticleSystemComponent* SpawnedEffect = UGameplayStatics::SpawnEmitterAtLocation(Owner->GetWorld(), Template, ScratchPad.HitPoint, HitRotation);
+		if (SpawnedEffect)
+		{
+			INC_DWORD_STAT(STAT_SPAbilityLaser_EffectsSpawned);
+			SpawnedEffect->TranslucencySortPriority = m_RenderSortPriority;
+		}
+		ActiveEffect = SpawnedEffect;
+	}
+}
+
+void USPAbilityLaserTask::StopEffects(const UAbleAbilityContext& Context, USPAbilityLaserTaskScratchPad& ScratchPad) const
+{
+	SPAbilityLaserTaskUtils::StopEffect(ScratchPad.BeamEffect, m_DetachOnStop);
+	SPAbilityLaserTaskUtils::StopEffect(ScratchPad.HitBodyEffect, false);
+	SPAbilityLaserTaskUtils::StopEffect(ScratchPad.HitSceneEffect, false);
+
+	const AActor* Owner = Context.GetSelfActor();
+	if (m_EndingEffectTemplate && Owner && Owner->GetNetMode() != NM_DedicatedServer)
+	{
+		float LengthScale = 1.0f;
+		SpawnBeamEmitter(Context, m_EndingEffectTemplate, GetParticleTransform(Context, ScratchPad, LengthScale));
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -3,11 +3,63 @@
 #include "Tasks/SPAbilityTask.h"
 
 #include "ableAbility.h"
+#include "ableAbilityComponent.h"
 #include "ableSubSystem.h"
 #include "AbleCoreSPPrivate.h"
+#include "Engine/EngineTypes.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
 
 #define LOCTEXT_NAMESPACE "AbleAbilityTask"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("SP Task Batched Ticks"), STAT_SPAbilityTask_BatchedTicks, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("SP Task Batched Commands"), STAT_SPAbilityTask_BatchedCommands, STATGROUP_Able);
+
+void FSPAbilityTaskTickSnapshot::Reset()
+{
+	Owner = nullptr;
+	Instigator = nullptr;
+	OwnerTransform = FTransform::Identity;
+	Targets.Reset();
+	ScratchPad = nullptr;
+	DeltaTime = 0.0f;
+	AbilityTime = 0.0f;
+	TaskTime = 0.0f;
+	AbilityId = 0;
+	AbilityUniqueID = 0;
+	TargetBuffer.Reset();
+}
+
+void FSPAbilityTaskCommandBuffer::Reset()
+{
+	IntParameters.Reset();
+	FloatParameters.Reset();
+	Damage.Reset();
+	Effects.Reset();
+	BranchSegments.Reset();
+}
+
+FSPAbilityDamageTargetRecord& FSPAbilityDamageTargetRecords::FindOrAdd(AActor* Actor)
+{
+	for (FSPAbilityDamageTargetRecord& Record : Records)
+	{
+		if (Record.Actor.Get() == Actor)
+		{
+			return Record;
+		}
+	}
+
+	FSPAbilityDamageTargetRecord& NewRecord = Records.AddDefaulted_GetRef();
+	NewRecord.Actor = Actor;
+	return NewRecord;
+}
+
+const FSPAbilityDamageTargetRecord* FSPAbilityDamageTargetRecords::Find(const AActor* Actor) const
+{
+	return Records.FindByPredicate([Actor](const FSPAbilityDamageTargetRecord& Record) { return Record.Actor.Get() == Actor; });
+}
+
 USPAbilityTaskScratchPad::USPAbilityTaskScratchPad()
 {
 }
@@ -48,7 +100,7 @@ void USPAbilityTask::ClearBP_Implementation()
 void USPAbilityTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void USPAbilityTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -58,18 +110,190 @@ void USPAbilityTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Con
 void USPAbilityTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+
+	if (HasTaskEventOverride(EAbleTaskEvent::OnTaskTickBatched))
+	{
+		TickBatched(*Context.Get(), deltaTime);
+		return;
+	}
+
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void USPAbilityTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float DeltaTime) const
 {
 }
 
+void USPAbilityTask::OnTaskTickBatchedBP_Implementation(const UAbleAbilityContext* Context, const FSPAbilityTaskTickSnapshot& Snapshot, FSPAbilityTaskCommandBuffer& Commands) const
+{
+}
+
+void USPAbilityTask::TickBatched(const UAbleAbilityContext& Context, float DeltaTime) const
+{
+	INC_DWORD_STAT(STAT_SPAbilityTask_BatchedTicks);
+
+	// Use the Scratch Pad's copies if we can, since they keep their allocations from tick to tick.
+	USPAbilityTaskScratchPad* ScratchPad = Cast<USPAbilityTaskScratchPad>(Context.GetScratchPadForTask(this));
+	FSPAbilityTaskTickSnapshot LocalSnapshot;
+	FSPAbilityTaskCommandBuffer LocalCommands;
+	FSPAbilityTaskTickSnapshot& Snapshot = ScratchPad ? ScratchPad->TickSnapshot : LocalSnapshot;
+	FSPAbilityTaskCommandBuffer& Commands = ScratchPad ? ScratchPad->TickCommands : LocalCommands;
+
+	Snapshot.Reset();
+	Commands.Reset();
+
+	GatherTickSnapshot(Context, DeltaTime, Snapshot);
+	Snapshot.ScratchPad = ScratchPad;
+
+	OnTaskTickBatchedBP(&Context, Snapshot, Commands);
+
+	INC_DWORD_STAT_BY(STAT_SPAbilityTask_BatchedCommands, Commands.Num());
+	ApplyTickCommands(Context, Commands);
+
+	// Don't hold on to any Actors until next tick.
+	Snapshot.Reset();
+	Commands.Reset();
+}
+
+void USPAbilityTask::GatherTickSnapshot(const UAbleAbilityContext& Context, float DeltaTime, FSPAbilityTaskTickSnapshot& OutSnapshot) const
+{
+	OutSnapshot.Owner = Context.GetSelfActor();
+	OutSnapshot.Instigator = Context.GetInstigator() ? Context.GetInstigator() : OutSnapshot.Owner;
+	if (OutSnapshot.Owner)
+	{
+		OutSnapshot.OwnerTransform = OutSnapshot.Owner->GetActorTransform();
+	}
+
+	GetActorsForTask(&Context, OutSnapshot.TargetBuffer);
+	OutSnapshot.Targets.Reserve(OutSnapshot.TargetBuffer.Num());
+	for (const TWeakObjectPtr<AActor>& Target : OutSnapshot.TargetBuffer)
+	{
+		if (Target.IsValid())
+		{
+			OutSnapshot.Targets.Add(Target.Get());
+		}
+	}
+	OutSnapshot.TargetBuffer.Reset();
+
+	OutSnapshot.DeltaTime = DeltaTime;
+	OutSnapshot.AbilityTime = Context.GetCurrentTime();
+	OutSnapshot.TaskTime = Context.GetCurrentTime() - GetStartTime();
+	OutSnapshot.AbilityId = Context.GetAbilityId();
+	OutSnapshot.AbilityUniqueID = Context.GetAbilityUniqueID();
+}
+
+void USPAbilityTask::ApplyTickCommands(const UAbleAbilityContext& Context, const FSPAbilityTaskCommandBuffer& Commands) const
+{
+	// Commands are how script Tasks write back to the Context, same as calling the setters directly would.
+	UAbleAbilityContext& MutableContext = const_cast<UAbleAbilityContext&>(Context);
+	for (const FSPAbilityTaskIntParameterCommand& Command : Commands.IntParameters)
+	{
+		MutableContext.SetIntParameter(Command.Name, Command.Value);
+	}
+
+	for (const FSPAbilityTaskFloatParameterCommand& Command : Commands.FloatParameters)
+	{
+		MutableContext.SetFloatParameter(Command.Name, Command.Value);
+	}
+
+	if (Commands.Damage.Num())
+	{
+		ApplyDamageCommands(Context, Commands.Damage);
+	}
+
+	for (const FSPAbilityTaskEffectCommand& Command : Commands.Effects)
+	{
+		if (!Command.Template)
+		{
+			continue;
+		}
+
+		if (Command.AttachTo && Command.AttachTo->GetRootComponent())
+		{
+			UGameplayStatics::SpawnEmitterAttached(Command.Template, Command.AttachTo->GetRootComponent(), Command.SocketName, Command.Transform.GetLocation(), Command.Transform.Rotator(), Command.Transform.GetScale3D(), EAttachLocation::KeepRelativeOffset);
+		}
+		else if (AActor* SelfActor = Context.GetSelfActor())
+		{
+			UGameplayStatics::SpawnEmitterAtLocation(SelfActor->GetWorld(), Command.Template, Command.Transform);
+		}
+	}
+
+	if (Commands.BranchSegments.Num())
+	{
+		if (UAbleAbilityComponent* AbilityComponent = Context.GetSelfAbilityComponent())
+		{
+			for (const FName& SegmentName : Commands.BranchSegments)
+			{
+				if (AbilityComponent->BranchSegmentWithName(&Context, SegmentName))
+				{
+					break;
+				}
+			}
+		}
+	}
+}
+
+void USPAbilityTask::ApplyDamageCommands(const UAbleAbilityContext& Context, const TArray<FSPAbilityTaskDamageCommand>& Commands) const
+{
+	AActor* DamageSource = Context.GetSelfActor();
+
+	AController* InstigatorController = nullptr;
+	if (AActor* InstigatorActor = Context.GetInstigator())
+	{
+		if (AController* Controller = Cast<AController>(InstigatorActor))
+		{
+			InstigatorController = Controller;
+		}
+		else if (APawn* Pawn = Cast<APawn>(InstigatorActor))
+		{
+			InstigatorController = Pawn->GetController();
+		}
+	}
+
+	FPointDamageEvent PointEvent;
+	for (const FSPAbilityTaskDamageCommand& Command : Commands)
+	{
+		if (!Command.Target || Command.Target->IsPendingKill())
+		{
+			continue;
+		}
+
+		PointEvent.Damage = Command.Damage;
+		PointEvent.HitInfo.ImpactPoint = Command.HitLocation;
+		PointEvent.ShotDirection = DamageSource ? (Command.HitLocation - DamageSource->GetActorLocation()).GetSafeNormal() : FVector::ZeroVector;
+
+		Command.Target->TakeDamage(Command.Damage, PointEvent, InstigatorController, DamageSource);
+	}
+}
+
+bool USPAbilityTask::IsActorDead(const AActor* Actor)
+{
+	static const FName GetIsDeadName(TEXT("GetIsDead"));
+
+	UFunction* Function = Actor ? Actor->FindFunction(GetIsDeadName) : nullptr;
+	if (!Function || Function->NumParms != 1)
+	{
+		return false;
+	}
+
+	const FBoolProperty* ReturnProperty = CastField<FBoolProperty>(Function->GetReturnProperty());
+	if (!ReturnProperty)
+	{
+		return false;
+	}
+
+	uint8* Params = static_cast<uint8*>(FMemory_Alloca(Function->ParmsSize));
+	FMemory::Memzero(Params, Function->ParmsSize);
+	const_cast<AActor*>(Actor)->ProcessEvent(Function, Params);
+
+	return ReturnProperty->GetPropertyValue_InContainer(Params);
+}
+
 void USPAbilityTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context,
                                const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void USPAbilityTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context,
@@ -79,7 +303,7 @@ void USPAbilityTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Conte
 
 bool USPAbilityTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool USPAbilityTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
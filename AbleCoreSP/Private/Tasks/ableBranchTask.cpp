@@ -44,7 +44,7 @@ FString UAbleBranchTask::GetModuleName_Implementation() const
 void UAbleBranchTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleBranchTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -87,7 +87,7 @@ void UAbleBranchTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Co
 void UAbleBranchTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleBranchTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -132,7 +132,7 @@ void UAbleBranchTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Con
 void UAbleBranchTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
     Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleBranchTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -151,6 +151,11 @@ void UAbleBranchTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Cont
     }
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleBranchTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleBranchTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleBranchTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
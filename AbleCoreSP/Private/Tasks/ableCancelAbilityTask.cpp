@@ -36,7 +36,7 @@ void UAbleCancelAbilityTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbility
 	check(Context.IsValid());
 
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleCancelAbilityTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
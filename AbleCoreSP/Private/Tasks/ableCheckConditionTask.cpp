@@ -40,7 +40,7 @@ FString UAbleCheckConditionTask::GetModuleName_Implementation() const
 
 bool UAbleCheckConditionTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleCheckConditionTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
@@ -59,7 +59,7 @@ bool UAbleCheckConditionTask::IsDoneBP_Implementation(const UAbleAbilityContext*
 void UAbleCheckConditionTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleCheckConditionTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -83,7 +83,7 @@ void UAbleCheckConditionTask::OnTaskStartBP_Implementation(const UAbleAbilityCon
 void UAbleCheckConditionTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleCheckConditionTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -110,6 +110,11 @@ void UAbleCheckConditionTask::OnTaskTickBP_Implementation(const UAbleAbilityCont
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleCheckConditionTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleCheckConditionTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleCheckConditionTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -142,22 +142,22 @@ UAbleCollisionFilterByClass::~UAbleCollisionFilterByClass()
 
 }
 
+bool UAbleCollisionFilterByClass::ShouldRemove(const AActor* Actor) const
+{
+	if (Actor)
+	{
+		const bool IsClass = Actor->GetClass()->IsChildOf(m_Class);
+		return m_Negate ? !IsClass : IsClass;
+	}
+
+	return true;
+}
+
 void UAbleCollisionFilterByClass::Filter(const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const
 {
-	bool Remove = false;
 	for (int i = 0; i < InOutArray.Num(); )
 	{
-		if (AActor* Actor = InOutArray[i].Actor.Get())
-		{
-			Remove = Actor->GetClass()->IsChildOf(m_Class);
-			Remove = m_Negate ? !Remove : Remove;
-		}
-		else
-		{
-			Remove = true;
-		}
-
-		if (Remove)
+		if (ShouldRemove(InOutArray[i].Actor.Get()))
 		{
 			InOutArray.RemoveAt(i, 1, false);
 		}
@@ -194,11 +194,16 @@ UAbleCollisionFilterSortByDistance::~UAbleCollisionFilterSortByDistance()
 }
 
 void UAbleCollisionFilterSortByDistance::Filter(const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const
+{
+	InOutArray.Sort(FAbleAbilityResultSortByDistance(GetSourceLocation(Context), m_Use2DDistance, IsAscending()));
+}
+
+FVector UAbleCollisionFilterSortByDistance::GetSourceLocation(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	FTransform SourceTransform;
 	FAbleAbilityTargetTypeLocation Location = ABL_GET_DYNAMIC_PROPERTY_VALUE(Context, m_Location);
 	Location.GetTransform(*Context.Get(), SourceTransform);
-	InOutArray.Sort(FAbleAbilityResultSortByDistance(SourceTransform.GetLocation(), m_Use2DDistance, m_SortDirection == EAbleCollisionFilterSort::AbleFitlerSort_Ascending));
+	return SourceTransform.GetLocation();
 }
 
 void UAbleCollisionFilterSortByDistance::BindDynamicDelegates(class UAbleAbility* Ability)
@@ -355,16 +360,16 @@ void UAbleCollisionFilterTeamAttitude::Filter(const TWeakObjectPtr<const UAbleAb
 
 	InOutArray.RemoveAll([&](const FAbleQueryResult& LHS)
 	{
-		ETeamAttitude::Type Attitude = FGenericTeamId::GetAttitude(SelfActor, LHS.Actor.Get());
-
-		if (((1 << (int32)Attitude) & m_IgnoreAttitude) != 0)
-		{
-			return true;
-		}
-		return false;
+		return ShouldRemove(SelfActor, LHS.Actor.Get());
 	});
 }
 
+bool UAbleCollisionFilterTeamAttitude::ShouldRemove(const AActor* SelfActor, const AActor* Target) const
+{
+	const ETeamAttitude::Type Attitude = FGenericTeamId::GetAttitude(SelfActor, Target);
+	return ((1 << (int32)Attitude) & m_IgnoreAttitude) != 0;
+}
+
 #if WITH_EDITOR
 EDataValidationResult UAbleCollisionFilterTeamAttitude::IsAbilityDataValid(const UAbleAbility* AbilityContext, TArray<FText>& ValidationErrors)
 {
@@ -400,13 +405,7 @@ void UAbleCollisionFilterLineOfSight::Filter(const TWeakObjectPtr<const UAbleAbi
 		return;
 	}
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-	for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-		ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	FCollisionQueryParams CollisionParams;
 
@@ -510,4 +509,267 @@ EDataValidationResult UAbleCollisionFilterUniqueActors::IsAbilityDataValid(const
 {
 	return EDataValidationResult::Valid;
 }
-#endif
\ No newline at end of file
+#endif
+DECLARE_DWORD_COUNTER_STAT(TEXT("Collision Filter Passes"), STAT_AbleCollisionFilterPasses, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Collision Filter Opaque Passes"), STAT_AbleCollisionFilterOpaquePasses, STATGROUP_Able);
+
+void FAbleCollisionFilterProgram::Compile(const TArray<UAbleCollisionFilter*>& Filters)
+{
+	m_Passes.Reset();
+	m_Predicates.Reset();
+	m_Source = Filters;
+	m_IsCompiled = true;
+
+	for (const UAbleCollisionFilter* Filter : Filters)
+	{
+		if (!Filter)
+		{
+			continue;
+		}
+
+		// Exact class checks, a subclass could override Filter and we'd silently skip its logic.
+		const UClass* FilterClass = Filter->GetClass();
+		EAbleCollisionFilterPredicate PredicateType = EAbleCollisionFilterPredicate::Self;
+		bool IsPredicate = true;
+		if (FilterClass == UAbleCollisionFilterSelf::StaticClass())
+		{
+			PredicateType = EAbleCollisionFilterPredicate::Self;
+		}
+		else if (FilterClass == UAbleCollisionFilterOwner::StaticClass())
+		{
+			PredicateType = EAbleCollisionFilterPredicate::Owner;
+		}
+		else if (FilterClass == UAbleCollisionFilterInstigator::StaticClass())
+		{
+			PredicateType = EAbleCollisionFilterPredicate::Instigator;
+		}
+		else if (FilterClass == UAbleCollisionFilterByClass::StaticClass())
+		{
+			PredicateType = EAbleCollisionFilterPredicate::ByClass;
+		}
+		else if (FilterClass == UAbleCollisionFilterTeamAttitude::StaticClass())
+		{
+			PredicateType = EAbleCollisionFilterPredicate::TeamAttitude;
+		}
+		else
+		{
+			IsPredicate = false;
+		}
+
+		if (IsPredicate)
+		{
+			// Removal order doesn't matter, so fold this into the previous pass if we can.
+			if (m_Passes.Num() == 0 || m_Passes.Last().Type != EAbleCollisionFilterPass::Predicates)
+			{
+				FPass& NewPass = m_Passes.AddDefaulted_GetRef();
+				NewPass.Type = EAbleCollisionFilterPass::Predicates;
+				NewPass.Filter = nullptr;
+				NewPass.FirstPredicate = m_Predicates.Num();
+				NewPass.NumPredicates = 0;
+				NewPass.Limit = 0;
+			}
+
+			m_Predicates.Add(FPredicate{ PredicateType, Filter });
+			++m_Passes.Last().NumPredicates;
+			continue;
+		}
+
+		FPass Pass;
+		Pass.Filter = Filter;
+		Pass.FirstPredicate = 0;
+		Pass.NumPredicates = 0;
+		Pass.Limit = 0;
+
+		if (FilterClass == UAbleCollisionFilterMaxResults::StaticClass())
+		{
+			// Max Entities of 0 (or less) has never trimmed anything.
+			const int32 MaxEntities = CastChecked<UAbleCollisionFilterMaxResults>(Filter)->GetMaxEntities();
+			if (MaxEntities <= 0)
+			{
+				continue;
+			}
+
+			if (m_Passes.Num() && m_Passes.Last().Type == EAbleCollisionFilterPass::Sort)
+			{
+				m_Passes.Last().Type = EAbleCollisionFilterPass::SortAndLimit;
+				m_Passes.Last().Limit = MaxEntities;
+				continue;
+			}
+
+			Pass.Type = EAbleCollisionFilterPass::Limit;
+			Pass.Limit = MaxEntities;
+		}
+		else if (FilterClass == UAbleCollisionFilterSortByDistance::StaticClass())
+		{
+			Pass.Type = EAbleCollisionFilterPass::Sort;
+		}
+		else
+		{
+			Pass.Type = EAbleCollisionFilterPass::Opaque;
+		}
+
+		m_Passes.Add(Pass);
+	}
+}
+
+void FAbleCollisionFilterProgram::Execute(const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const
+{
+	for (const FPass& Pass : m_Passes)
+	{
+		INC_DWORD_STAT(STAT_AbleCollisionFilterPasses);
+
+		switch (Pass.Type)
+		{
+		case EAbleCollisionFilterPass::Predicates:
+			ExecutePredicates(Pass, Context, InOutArray);
+			break;
+		case EAbleCollisionFilterPass::Sort:
+		case EAbleCollisionFilterPass::SortAndLimit:
+			ExecuteSort(Pass, Context, InOutArray);
+			break;
+		case EAbleCollisionFilterPass::Limit:
+			if (InOutArray.Num() > Pass.Limit)
+			{
+				InOutArray.RemoveAt(Pass.Limit, InOutArray.Num() - Pass.Limit);
+			}
+			break;
+		case EAbleCollisionFilterPass::Opaque:
+		default:
+			INC_DWORD_STAT(STAT_AbleCollisionFilterOpaquePasses);
+			Pass.Filter->Filter(Context, InOutArray);
+			break;
+		}
+	}
+}
+
+void FAbleCollisionFilterProgram::Run(const TArray<UAbleCollisionFilter*>& Filters, const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray)
+{
+	if (!IsCompiledFor(Filters))
+	{
+		if (!IsInGameThread())
+		{
+			for (const UAbleCollisionFilter* Filter : Filters)
+			{
+				if (Filter)
+				{
+					Filter->Filter(Context, InOutArray);
+				}
+			}
+
+			return;
+		}
+
+		Compile(Filters);
+	}
+
+	Execute(Context, InOutArray);
+}
+
+bool FAbleCollisionFilterProgram::IsCompiledFor(const TArray<UAbleCollisionFilter*>& Filters) const
+{
+	return m_IsCompiled && m_Source == Filters;
+}
+
+void FAbleCollisionFilterProgram::ExecutePredicates(const FPass& Pass, const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const
+{
+	if (InOutArray.Num() == 0)
+	{
+		return;
+	}
+
+	const AActor* SelfActor = Context->GetSelfActor();
+	const AActor* Owner = Context->GetOwner();
+	const AActor* Instigator = Context->GetInstigator();
+
+	// Resolve every Actor once up front, rather than once per filter.
+	TArray<const AActor*, TInlineAllocator<64>> Actors;
+	Actors.SetNumUninitialized(InOutArray.Num());
+	for (int32 i = 0; i < InOutArray.Num(); ++i)
+	{
+		Actors[i] = InOutArray[i].Actor.Get();
+	}
+
+	const FPredicate* Predicates = m_Predicates.GetData() + Pass.FirstPredicate;
+
+	// Stable compaction, to keep the order the previous filters left us.
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < InOutArray.Num(); ++ReadIndex)
+	{
+		const AActor* Actor = Actors[ReadIndex];
+		bool Remove = false;
+		for (int32 PredicateIndex = 0; PredicateIndex < Pass.NumPredicates && !Remove; ++PredicateIndex)
+		{
+			const FPredicate& Predicate = Predicates[PredicateIndex];
+			switch (Predicate.Type)
+			{
+			case EAbleCollisionFilterPredicate::Self:
+				Remove = Actor == SelfActor;
+				break;
+			case EAbleCollisionFilterPredicate::Owner:
+				Remove = Actor == Owner;
+				break;
+			case EAbleCollisionFilterPredicate::Instigator:
+				Remove = Actor == Instigator;
+				break;
+			case EAbleCollisionFilterPredicate::ByClass:
+				Remove = static_cast<const UAbleCollisionFilterByClass*>(Predicate.Filter)->ShouldRemove(Actor);
+				break;
+			case EAbleCollisionFilterPredicate::TeamAttitude:
+				Remove = static_cast<const UAbleCollisionFilterTeamAttitude*>(Predicate.Filter)->ShouldRemove(SelfActor, Actor);
+				break;
+			default:
+				break;
+			}
+		}
+
+		if (!Remove)
+		{
+			if (WriteIndex != ReadIndex)
+			{
+				InOutArray[WriteIndex] = MoveTemp(InOutArray[ReadIndex]);
+			}
+			++WriteIndex;
+		}
+	}
+
+	InOutArray.SetNum(WriteIndex, false);
+}
+
+void FAbleCollisionFilterProgram::ExecuteSort(const FPass& Pass, const TWeakObjectPtr<const UAbleAbilityContext>& Context, TArray<FAbleQueryResult>& InOutArray) const
+{
+	const int32 NumResults = InOutArray.Num();
+	if (NumResults == 0)
+	{
+		return;
+	}
+
+	const UAbleCollisionFilterSortByDistance* SortFilter = static_cast<const UAbleCollisionFilterSortByDistance*>(Pass.Filter);
+	const FVector SourceLocation = SortFilter->GetSourceLocation(Context);
+	const bool Use2DDistance = SortFilter->GetUse2DDistance();
+	const bool Ascending = SortFilter->IsAscending();
+
+	// Work out each distance once, a comparison sort would otherwise fetch both Locations every compare.
+	TArray<float, TInlineAllocator<64>> Distances;
+	Distances.SetNumUninitialized(NumResults);
+	for (int32 i = 0; i < NumResults; ++i)
+	{
+		const FVector Location = InOutArray[i].GetLocation();
+		Distances[i] = Use2DDistance ? FVector::DistSquaredXY(SourceLocation, Location) : FVector::DistSquared(SourceLocation, Location);
+	}
+
+	auto IsBetter = [&Distances, Ascending](int32 A, int32 B)
+	{
+		return Ascending ? Distances[A] < Distances[B] : Distances[A] > Distances[B];
+	};
+
+	TArray<int32, TInlineAllocator<64>> Order;
+	FAbleTopKSelector::SelectIndices(NumResults, Pass.Type == EAbleCollisionFilterPass::SortAndLimit ? Pass.Limit : 0, Order, IsBetter);
+
+	TArray<FAbleQueryResult> Sorted;
+	Sorted.Reserve(Order.Num());
+	for (int32 Index : Order)
+	{
+		Sorted.Add(MoveTemp(InOutArray[Index]));
+	}
+	InOutArray = MoveTemp(Sorted);
+}
@@ -54,7 +54,7 @@ FString UAbleCollisionQueryTask::GetModuleName_Implementation() const
 void UAbleCollisionQueryTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleCollisionQueryTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -83,16 +83,20 @@ void UAbleCollisionQueryTask::OnTaskStartBP_Implementation(const UAbleAbilityCon
 
 			if (Results.Num() || (m_CopyResultsToContext && m_ClearExistingTargets))
 			{
-				for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
-				{
-					CollisionFilter->Filter(Context, Results);
-
 #if !(UE_BUILD_SHIPPING)
-					if (IsVerbose())
+				if (IsVerbose())
+				{
+					// Run the filters one by one so we can report on each of them.
+					for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
 					{
+						CollisionFilter->Filter(Context, Results);
 						PrintVerbose(Context, FString::Printf(TEXT("Filter %s executed. Entries remaining: %d"), *CollisionFilter->GetName(), Results.Num()));
 					}
+				}
+				else
 #endif
+				{
+					m_FilterProgram.Run(m_Filters, Context, Results);
 				}
 
 				// We could have filtered out all our entries, so check again if the array is empty.
@@ -134,7 +138,7 @@ void UAbleCollisionQueryTask::OnTaskStartBP_Implementation(const UAbleAbilityCon
 void UAbleCollisionQueryTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleCollisionQueryTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -164,15 +168,20 @@ void UAbleCollisionQueryTask::OnTaskTickBP_Implementation(const UAbleAbilityCont
 
 				if (Results.Num() || (m_CopyResultsToContext && m_ClearExistingTargets))
 				{
-					for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
-					{
-						CollisionFilter->Filter(Context, Results);
 #if !(UE_BUILD_SHIPPING)
-						if (IsVerbose())
+					if (IsVerbose())
+					{
+						// Run the filters one by one so we can report on each of them.
+						for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
 						{
+							CollisionFilter->Filter(Context, Results);
 							PrintVerbose(Context, FString::Printf(TEXT("Filter %s executed. Entries remaining: %d"), *CollisionFilter->GetName(), Results.Num()));
 						}
+					}
+					else
 #endif
+					{
+						m_FilterProgram.Run(m_Filters, Context, Results);
 					}
 
 					if (Results.Num() || ( m_CopyResultsToContext && m_ClearExistingTargets ))
@@ -211,7 +220,7 @@ void UAbleCollisionQueryTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityC
 	const EAbleAbilityTaskResult Result) const
 {
 	Super::OnTaskEnd(Context, Result);
-	OnTaskEndBP(Context.Get(), Result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), Result);
 }
 
 void UAbleCollisionQueryTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context,
@@ -221,7 +230,7 @@ void UAbleCollisionQueryTask::OnTaskEndBP_Implementation(const UAbleAbilityConte
 
 bool UAbleCollisionQueryTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleCollisionQueryTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
@@ -238,6 +247,16 @@ bool UAbleCollisionQueryTask::IsDoneBP_Implementation(const UAbleAbilityContext*
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleCollisionQueryTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_QueryShape && m_QueryShape->IsAsync())
+	{
+		return UAbleCollisionQueryTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAbleCollisionQueryTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if(m_QueryShape && m_QueryShape->IsAsync())
@@ -289,6 +308,8 @@ void UAbleCollisionQueryTask::BindDynamicDelegates(UAbleAbility* Ability)
 			Filter->BindDynamicDelegates(Ability);
 		}
 	}
+
+	m_FilterProgram.Compile(m_Filters);
 }
 
 #if WITH_EDITOR
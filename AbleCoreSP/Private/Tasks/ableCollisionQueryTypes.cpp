@@ -137,13 +137,7 @@ FTransform UAbleCollisionShapeBox::DoQuery(const TWeakObjectPtr<const UAbleAbili
 
 	FCollisionShape Box = FCollisionShape::MakeBox(HalfExtents);
 
-    FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-        ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+    FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	TArray<FOverlapResult> OverlapResults;
     if (World->OverlapMultiByObjectType(OverlapResults, QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, Box))
@@ -204,13 +198,7 @@ FTraceHandle UAbleCollisionShapeBox::DoAsyncQuery(const TWeakObjectPtr<const UAb
 	}
 #endif
 
-    FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-        ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+    FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
     return World->AsyncOverlapByObjectType(OutQueryTransform.GetLocation(), OutQueryTransform.GetRotation(), ObjectQuery, Box);
 }
@@ -298,13 +286,7 @@ FTransform UAbleCollisionShapeSphere::DoQuery(const TWeakObjectPtr<const UAbleAb
 
 	FCollisionShape Sphere = FCollisionShape::MakeSphere(Radius);
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-        ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	TArray<FOverlapResult> OverlapResults;
 	if (World->OverlapMultiByObjectType(OverlapResults, QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, Sphere))
@@ -350,13 +332,7 @@ FTraceHandle UAbleCollisionShapeSphere::DoAsyncQuery(const TWeakObjectPtr<const
 	}
 #endif
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	return World->AsyncOverlapByObjectType(OutQueryTransform.GetLocation(), OutQueryTransform.GetRotation(), ObjectQuery, Sphere);
 }
@@ -438,13 +414,7 @@ FTransform UAbleCollisionShapeCapsule::DoQuery(const TWeakObjectPtr<const UAbleA
 
 	FCollisionShape Capsule = FCollisionShape::MakeCapsule(Radius, Height * 0.5f);
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	TArray<FOverlapResult> OverlapResults;
 	if (World->OverlapMultiByObjectType(OverlapResults, QueryTransform.GetLocation(), QueryTransform.GetRotation(), ObjectQuery, Capsule))
@@ -491,13 +461,7 @@ FTraceHandle UAbleCollisionShapeCapsule::DoAsyncQuery(const TWeakObjectPtr<const
 	}
 #endif
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	return World->AsyncOverlapByObjectType(OutQueryTransform.GetLocation(), OutQueryTransform.GetRotation(), ObjectQuery, Capsule);
 }
@@ -591,13 +555,7 @@ FTransform UAbleCollisionShapeCone::DoQuery(const TWeakObjectPtr<const UAbleAbil
 	const FVector OffsetVector = QueryForward * Radius;
 	const FVector QueryLocation = FOV > 180.0f ? QueryTransform.GetTranslation() : QueryTransform.GetTranslation() + OffsetVector;
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	TArray<FOverlapResult> OverlapResults;
 	if (World->OverlapMultiByObjectType(OverlapResults, QueryLocation, QueryTransform.GetRotation(), ObjectQuery, SphereShape))
@@ -679,13 +637,7 @@ FTraceHandle UAbleCollisionShapeCone::DoAsyncQuery(const TWeakObjectPtr<const UA
 	}
 #endif
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 	OutQueryTransform.SetScale3D(FVector(FOV, Height, Length)); // Store these values in the scale, this is safe because we don't use Scale anyway.
     return World->AsyncOverlapByObjectType(QueryLocation, OutQueryTransform.GetRotation(), ObjectQuery, SphereShape);
 }
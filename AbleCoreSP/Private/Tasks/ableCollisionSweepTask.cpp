@@ -49,7 +49,7 @@ FString UAbleCollisionSweepTask::GetModuleName_Implementation() const
 void UAbleCollisionSweepTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleCollisionSweepTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -67,7 +67,7 @@ void UAbleCollisionSweepTask::OnTaskStartBP_Implementation(const UAbleAbilityCon
 void UAbleCollisionSweepTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleCollisionSweepTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -90,7 +90,7 @@ void UAbleCollisionSweepTask::OnTaskTickBP_Implementation(const UAbleAbilityCont
 void UAbleCollisionSweepTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleCollisionSweepTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -121,16 +121,20 @@ void UAbleCollisionSweepTask::OnTaskEndBP_Implementation(const UAbleAbilityConte
 
 	if (OutResults.Num() || (m_CopyResultsToContext && m_ClearExistingTargets))
 	{
-		for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
-		{
-			CollisionFilter->Filter(Context, OutResults);
-
 #if !(UE_BUILD_SHIPPING)
-			if (IsVerbose())
+		if (IsVerbose())
+		{
+			// Run the filters one by one so we can report on each of them.
+			for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
 			{
+				CollisionFilter->Filter(Context, OutResults);
 				PrintVerbose(Context, FString::Printf(TEXT("Filter %s executed. Entries remaining: %d"), *CollisionFilter->GetName(), OutResults.Num()));
 			}
+		}
+		else
 #endif
+		{
+			m_FilterProgram.Run(m_Filters, Context, OutResults);
 		}
 
 		if (OutResults.Num() || (m_CopyResultsToContext && m_ClearExistingTargets)) // Early out if we filtered everything out.
@@ -163,6 +167,11 @@ void UAbleCollisionSweepTask::OnTaskEndBP_Implementation(const UAbleAbilityConte
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleCollisionSweepTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleCollisionSweepTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleCollisionSweepTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -209,11 +218,13 @@ void UAbleCollisionSweepTask::BindDynamicDelegates(UAbleAbility* Ability)
 			Filter->BindDynamicDelegates(Ability);
 		}
 	}
+
+	m_FilterProgram.Compile(m_Filters);
 }
 
 bool UAbleCollisionSweepTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleCollisionSweepTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
@@ -144,13 +144,7 @@ void UAbleCollisionSweepBox::DoSweep(const TWeakObjectPtr<const UAbleAbilityCont
 	UWorld* World = SourceActor->GetWorld();
 	check(World);
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	FCollisionShape Shape = FCollisionShape::MakeBox(HalfExtents);
 	if (m_OnlyReturnBlockingHit)
@@ -229,13 +223,7 @@ FTraceHandle UAbleCollisionSweepBox::DoAsyncSweep(const TWeakObjectPtr<const UAb
 	}
 #endif
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	return World->AsyncSweepByObjectType(m_OnlyReturnBlockingHit ? EAsyncTraceType::Single : EAsyncTraceType::Multi, StartTransform.GetLocation(), EndTransform.GetLocation(), FQuat::Identity, ObjectQuery, Shape);
 }
@@ -310,13 +298,7 @@ void UAbleCollisionSweepSphere::DoSweep(const TWeakObjectPtr<const UAbleAbilityC
 	UWorld* World = SourceActor->GetWorld();
 	check(World);
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	FCollisionShape Shape = FCollisionShape::MakeSphere(Radius);
 	if (m_OnlyReturnBlockingHit)
@@ -378,13 +360,7 @@ FTraceHandle UAbleCollisionSweepSphere::DoAsyncSweep(const TWeakObjectPtr<const
 	}
 #endif
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	return World->AsyncSweepByObjectType(m_OnlyReturnBlockingHit ? EAsyncTraceType::Single : EAsyncTraceType::Multi, SourceTransform.GetLocation(), EndTransform.GetLocation(), FQuat::Identity, ObjectQuery, Shape);
 }
@@ -457,13 +433,7 @@ void UAbleCollisionSweepCapsule::DoSweep(const TWeakObjectPtr<const UAbleAbility
 	UWorld* World = SourceActor->GetWorld();
 	check(World);
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	FCollisionShape Shape = FCollisionShape::MakeCapsule(Radius, Height * 0.5f);
 	if (m_OnlyReturnBlockingHit)
@@ -526,13 +496,7 @@ FTraceHandle UAbleCollisionSweepCapsule::DoAsyncSweep(const TWeakObjectPtr<const
 	}
 #endif
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context.Get(), m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-    	ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context.Get(), m_ChannelPresent, m_CollisionChannels);
 
 	return World->AsyncSweepByObjectType(m_OnlyReturnBlockingHit ? EAsyncTraceType::Single : EAsyncTraceType::Multi, SourceTransform.GetLocation(), EndTransform.GetLocation(), FQuat::Identity, ObjectQuery, Shape);
 }
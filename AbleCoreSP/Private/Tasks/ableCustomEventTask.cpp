@@ -27,7 +27,7 @@ FString UAbleCustomEventTask::GetModuleName_Implementation() const
 void UAbleCustomEventTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleCustomEventTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
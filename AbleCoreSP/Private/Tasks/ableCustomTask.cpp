@@ -31,7 +31,7 @@ UAbleCustomTask::~UAbleCustomTask()
 
 void UAbleCustomTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleCustomTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -41,7 +41,7 @@ void UAbleCustomTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Co
 
 void UAbleCustomTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleCustomTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float DeltaTime) const
@@ -51,7 +51,7 @@ void UAbleCustomTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Con
 
 void UAbleCustomTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleCustomTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -61,7 +61,7 @@ void UAbleCustomTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Cont
 
 bool UAbleCustomTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleCustomTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
@@ -37,7 +37,7 @@ void UAbleDamageEventTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityCo
 	check(Context.IsValid());
 
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleDamageEventTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
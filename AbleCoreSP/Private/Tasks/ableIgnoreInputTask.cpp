@@ -42,7 +42,7 @@ FString UAbleIgnoreInputTask::GetModuleName_Implementation() const
 void UAbleIgnoreInputTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleIgnoreInputTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -116,7 +116,7 @@ void UAbleIgnoreInputTask::OnTaskStartBP_Implementation(const UAbleAbilityContex
 void UAbleIgnoreInputTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleIgnoreInputTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -177,6 +177,11 @@ void UAbleIgnoreInputTask::OnTaskEndBP_Implementation(const UAbleAbilityContext*
     }
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleIgnoreInputTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleIgnoreInputTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleIgnoreInputTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -47,7 +47,7 @@ FString UAbleJumpToTask::GetModuleName_Implementation() const
 void UAbleJumpToTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleJumpToTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -79,7 +79,7 @@ void UAbleJumpToTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Co
 
 void UAbleJumpToTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleJumpToTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -104,7 +104,7 @@ void UAbleJumpToTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Con
 
 void UAbleJumpToTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult Result) const
 {
-	OnTaskEndBP(Context.Get(), Result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), Result);
 }
 
 void UAbleJumpToTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -129,7 +129,7 @@ void UAbleJumpToTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Cont
 
 bool UAbleJumpToTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleJumpToTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
@@ -162,6 +162,11 @@ bool UAbleJumpToTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context
 	return ScratchPad->JumpingPawns.Num() > 0;
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleJumpToTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleJumpToScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleJumpToTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -31,7 +31,7 @@ FString UAbleModifyContextTask::GetModuleName_Implementation() const
 void UAbleModifyContextTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleModifyContextTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
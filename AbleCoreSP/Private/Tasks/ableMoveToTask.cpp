@@ -52,7 +52,7 @@ FString UAbleMoveToTask::GetModuleName_Implementation() const
 void UAbleMoveToTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleMoveToTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -90,7 +90,7 @@ void UAbleMoveToTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Co
 void UAbleMoveToTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleMoveToTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -180,7 +180,7 @@ void UAbleMoveToTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Con
 void UAbleMoveToTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult Result) const
 {
 	Super::OnTaskEnd(Context, Result);
-	OnTaskEndBP(Context.Get(), Result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), Result);
 }
 
 void UAbleMoveToTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -220,6 +220,11 @@ void UAbleMoveToTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Cont
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleMoveToTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleMoveToScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleMoveToTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -246,7 +251,7 @@ void UAbleMoveToTask::BindDynamicDelegates( UAbleAbility* Ability )
 
 bool UAbleMoveToTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleMoveToTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
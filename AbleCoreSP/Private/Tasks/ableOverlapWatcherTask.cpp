@@ -48,7 +48,7 @@ FString UAbleOverlapWatcherTask::GetModuleName_Implementation() const
 void UAbleOverlapWatcherTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleOverlapWatcherTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -66,7 +66,7 @@ void UAbleOverlapWatcherTask::OnTaskStartBP_Implementation(const UAbleAbilityCon
 void UAbleOverlapWatcherTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
     Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleOverlapWatcherTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -136,7 +136,7 @@ void UAbleOverlapWatcherTask::CheckForOverlaps(const TWeakObjectPtr<const UAbleA
 
 bool UAbleOverlapWatcherTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleOverlapWatcherTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
@@ -152,6 +152,11 @@ bool UAbleOverlapWatcherTask::IsDoneBP_Implementation(const UAbleAbilityContext*
     return UAbleAbilityTask::IsDone(Context);
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleOverlapWatcherTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleOverlapWatcherTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleOverlapWatcherTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -184,22 +189,46 @@ void UAbleOverlapWatcherTask::CopyResultsToContext(const TArray<FAbleQueryResult
 }
 
 
+void UAbleOverlapWatcherTask::BindDynamicDelegates(UAbleAbility* Ability)
+{
+	Super::BindDynamicDelegates(Ability);
+
+	if (m_QueryShape)
+	{
+		m_QueryShape->BindDynamicDelegates(Ability);
+	}
+
+	for (UAbleCollisionFilter* Filter : m_Filters)
+	{
+		if (Filter)
+		{
+			Filter->BindDynamicDelegates(Ability);
+		}
+	}
+
+	m_FilterProgram.Compile(m_Filters);
+}
+
 void UAbleOverlapWatcherTask::ProcessResults(TArray<FAbleQueryResult>& InResults, const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
     UAbleOverlapWatcherTaskScratchPad* ScratchPad = Cast<UAbleOverlapWatcherTaskScratchPad>(Context->GetScratchPadForTask(this));
     if (!ScratchPad) return;
 
-    for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
-    {
-        CollisionFilter->Filter(Context, InResults);
-
 #if !(UE_BUILD_SHIPPING)
-        if (IsVerbose())
-        {
-            PrintVerbose(Context, FString::Printf(TEXT("Filter %s executed. Entries remaining: %d"), *CollisionFilter->GetName(), InResults.Num()));
-        }
+	if (IsVerbose())
+	{
+		// Run the filters one by one so we can report on each of them.
+		for (const UAbleCollisionFilter* CollisionFilter : m_Filters)
+		{
+			CollisionFilter->Filter(Context, InResults);
+			PrintVerbose(Context, FString::Printf(TEXT("Filter %s executed. Entries remaining: %d"), *CollisionFilter->GetName(), InResults.Num()));
+		}
+	}
+	else
 #endif
-    }
+	{
+		m_FilterProgram.Run(m_Filters, Context, InResults);
+	}
 
 	// We either haven't called clear targets at all yet, or we have some results and we want to continually call clear.
 	bool NeedsClearCall = m_CopyResultsToContext && ( (m_ClearExistingTargets && !ScratchPad->HasClearedInitialTargets) || (InResults.Num() && m_ContinuallyClearTargets ) );
@@ -36,7 +36,7 @@ void UAblePlayAbilityTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityCo
 	check(Context.IsValid());
 
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAblePlayAbilityTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -73,13 +73,13 @@ FString UAblePlayAnimationTask::GetModuleName_Implementation() const
 void UAblePlayAnimationTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAblePlayAnimationTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
 {
 
-	const UAnimationAsset* AnimationAsset = m_AnimationAsset.LoadSynchronous();
+	const UAnimationAsset* AnimationAsset = ResolveSoftAsset(m_AnimationAsset, Context);
 
 	if (!AnimationAsset)
 	{
@@ -137,7 +137,7 @@ void UAblePlayAnimationTask::OnTaskStartBP_Implementation(const UAbleAbilityCont
 void UAblePlayAnimationTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAblePlayAnimationTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -274,6 +274,11 @@ float UAblePlayAnimationTask::GetEndTime() const
     return m_Loop ? FMath::Max(Super::GetEndTime(), endTime) : endTime;
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAblePlayAnimationTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAblePlayAnimationTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAblePlayAnimationTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -636,7 +641,7 @@ void UAblePlayAnimationTask::OnAbilityTimeSet(const TWeakObjectPtr<const UAbleAb
 	UAblePlayAnimationTaskScratchPad* ScratchPad = CastChecked<UAblePlayAnimationTaskScratchPad>(Context->GetScratchPadForTask(this));
 	if (!ScratchPad) return;
 
-	const UAnimationAsset* AnimationAsset = m_AnimationAsset.LoadSynchronous();
+	const UAnimationAsset* AnimationAsset = ResolveSoftAsset(m_AnimationAsset, Context.Get());
 	switch (m_AnimationMode.GetValue())
 	{
 	case EAblePlayAnimationTaskAnimMode::AbilityAnimationNode:
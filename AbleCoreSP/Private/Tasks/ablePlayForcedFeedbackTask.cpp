@@ -48,7 +48,7 @@ FString UAblePlayForcedFeedbackTask::GetModuleName_Implementation() const
 void UAblePlayForcedFeedbackTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAblePlayForcedFeedbackTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -100,7 +100,7 @@ void UAblePlayForcedFeedbackTask::OnTaskStartBP_Implementation(const UAbleAbilit
 void UAblePlayForcedFeedbackTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAblePlayForcedFeedbackTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -130,6 +130,11 @@ void UAblePlayForcedFeedbackTask::OnTaskEndBP_Implementation(const UAbleAbilityC
     }
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAblePlayForcedFeedbackTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAblePlayForcedFeedbackTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAblePlayForcedFeedbackTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
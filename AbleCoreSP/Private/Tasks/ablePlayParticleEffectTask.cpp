@@ -63,12 +63,12 @@ void UAblePlayParticleEffectTask::OnTaskStart(const TWeakObjectPtr<const UAbleAb
 		}
 	}
     Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAblePlayParticleEffectTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
 {
-	UParticleSystem* EffectTemplate = m_EffectTemplate.LoadSynchronous();
+	UParticleSystem* EffectTemplate = ResolveSoftAsset(m_EffectTemplate, Context);
     if (!EffectTemplate && !m_UseCustomEffect)
     {
         UE_LOG(LogAbleSP, Warning, TEXT("No Particle System set for PlayParticleEffectTask in Ability [%s]"), *Context->GetAbility()->GetAbilityName());
@@ -324,7 +324,7 @@ void UAblePlayParticleEffectTask::OnTaskStartBP_Implementation(const UAbleAbilit
 void UAblePlayParticleEffectTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAblePlayParticleEffectTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -505,7 +505,7 @@ void UAblePlayParticleEffectTask::OnTickChangeTransform_Implementation(const UAb
 void UAblePlayParticleEffectTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult Result) const
 {
     Super::OnTaskEnd(Context, Result);
-	OnTaskEndBP(Context.Get(), Result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), Result);
 }
 
 void UAblePlayParticleEffectTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult Result) const
@@ -576,6 +576,16 @@ bool UAblePlayParticleEffectTask::NeedsTick() const
 	return m_Parameters.Num() != 0 && m_Parameters.FindByPredicate([](const UAbleParticleEffectParam* RHS){ return RHS && RHS->GetEnableTickUpdate(); }) != nullptr;
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAblePlayParticleEffectTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_DestroyAtEnd)
+	{
+		return UAblePlayParticleEffectTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAblePlayParticleEffectTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (m_DestroyAtEnd)
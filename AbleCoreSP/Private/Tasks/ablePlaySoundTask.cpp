@@ -52,7 +52,7 @@ FString UAblePlaySoundTask::GetModuleName_Implementation() const
 void UAblePlaySoundTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAblePlaySoundTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -191,7 +191,7 @@ void UAblePlaySoundTask::OnTaskStartBP_Implementation(const UAbleAbilityContext*
 void UAblePlaySoundTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult Result) const
 {
 	Super::OnTaskEnd(Context, Result);
-	OnTaskEndBP(Context.Get(), Result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), Result);
 }
 
 void UAblePlaySoundTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult Result) const
@@ -219,6 +219,16 @@ void UAblePlaySoundTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* C
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAblePlaySoundTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_DestroyOnEnd)
+	{
+		return UAblePlaySoundTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAblePlaySoundTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (m_DestroyOnEnd)
@@ -43,7 +43,7 @@ FString UAblePossessionTask::GetModuleName_Implementation() const
 void UAblePossessionTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAblePossessionTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -81,7 +81,7 @@ void UAblePossessionTask::OnTaskStartBP_Implementation(const UAbleAbilityContext
 void UAblePossessionTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAblePossessionTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult Result) const
@@ -105,6 +105,16 @@ void UAblePossessionTask::OnTaskEndBP_Implementation(const UAbleAbilityContext*
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAblePossessionTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_UnPossessOnEnd)
+	{
+		return UAblePossessionTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAblePossessionTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (m_UnPossessOnEnd)
@@ -59,7 +59,7 @@ FString UAbleRayCastQueryTask::GetModuleName_Implementation() const
 void UAbleRayCastQueryTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleRayCastQueryTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -93,13 +93,7 @@ void UAbleRayCastQueryTask::OnTaskStartBP_Implementation(const UAbleAbilityConte
 		RayEnd = QueryEndTransform.GetLocation();
 	}
 
-	FCollisionObjectQueryParams ObjectQuery;
-	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(
-		Context, m_ChannelPresent, m_CollisionChannels);
-    for (TEnumAsByte<ECollisionChannel> Channel : Channels)
-	{
-        ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
-	}
+	FCollisionObjectQueryParams ObjectQuery = FAbleCollisionChannelCache::GetObjectQueryParams(Context, m_ChannelPresent, m_CollisionChannels);
 	FCollisionQueryParams QueryParams;
 	QueryParams.bReturnFaceIndex = ReturnFaceIndex;
 	QueryParams.bReturnPhysicalMaterial = ReturnPhysMaterial;
@@ -217,7 +211,7 @@ void UAbleRayCastQueryTask::OnTaskStartBP_Implementation(const UAbleAbilityConte
 void UAbleRayCastQueryTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleRayCastQueryTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -290,7 +284,7 @@ void UAbleRayCastQueryTask::OnTaskTickBP_Implementation(const UAbleAbilityContex
 
 bool UAbleRayCastQueryTask::IsDone(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
-	return IsDoneBP(Context.Get());
+	return ABLE_TASK_EVENT(IsDone, Context.Get());
 }
 
 bool UAbleRayCastQueryTask::IsDoneBP_Implementation(const UAbleAbilityContext* Context) const
@@ -307,6 +301,16 @@ bool UAbleRayCastQueryTask::IsDoneBP_Implementation(const UAbleAbilityContext* C
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleRayCastQueryTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (IsAsyncFriendly() && USPAbleSettings::IsAsyncEnabled())
+	{
+		return UAbleRayCastQueryTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAbleRayCastQueryTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (IsAsyncFriendly() && USPAbleSettings::IsAsyncEnabled())
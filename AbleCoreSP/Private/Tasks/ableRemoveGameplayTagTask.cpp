@@ -27,7 +27,7 @@ FString UAbleRemoveGameplayTagTask::GetModuleName_Implementation() const
 void UAbleRemoveGameplayTagTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleRemoveGameplayTagTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -50,7 +50,7 @@ FString UAbleSetCollisionChannelResponseTask::GetModuleName_Implementation() con
 void UAbleSetCollisionChannelResponseTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleSetCollisionChannelResponseTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -137,7 +137,7 @@ void UAbleSetCollisionChannelResponseTask::OnTaskStartBP_Implementation(const UA
 void UAbleSetCollisionChannelResponseTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleSetCollisionChannelResponseTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -164,6 +164,16 @@ void UAbleSetCollisionChannelResponseTask::OnTaskEndBP_Implementation(const UAbl
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleSetCollisionChannelResponseTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_RestoreOnEnd)
+	{
+		return UAbleSetCollisionChannelResponseTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAbleSetCollisionChannelResponseTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (m_RestoreOnEnd)
@@ -43,7 +43,7 @@ FString UAbleSetCollisionChannelTask::GetModuleName_Implementation() const
 void UAbleSetCollisionChannelTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleSetCollisionChannelTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -94,7 +94,7 @@ void UAbleSetCollisionChannelTask::OnTaskStartBP_Implementation(const UAbleAbili
 void UAbleSetCollisionChannelTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleSetCollisionChannelTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -123,6 +123,16 @@ void UAbleSetCollisionChannelTask::OnTaskEndBP_Implementation(const UAbleAbility
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleSetCollisionChannelTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_RestoreOnEnd)
+	{
+		return UAbleSetCollisionChannelTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAbleSetCollisionChannelTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (m_RestoreOnEnd)
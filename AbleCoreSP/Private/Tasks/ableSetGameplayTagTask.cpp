@@ -40,7 +40,7 @@ FString UAbleSetGameplayTagTask::GetModuleName_Implementation() const
 void UAbleSetGameplayTagTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleSetGameplayTagTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -86,7 +86,7 @@ void UAbleSetGameplayTagTask::OnTaskStartBP_Implementation(const UAbleAbilityCon
 void UAbleSetGameplayTagTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleSetGameplayTagTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -119,6 +119,16 @@ void UAbleSetGameplayTagTask::OnTaskEndBP_Implementation(const UAbleAbilityConte
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleSetGameplayTagTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_RemoveOnEnd)
+	{
+		return UAbleSetGameplayTagTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAbleSetGameplayTagTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (m_RemoveOnEnd)
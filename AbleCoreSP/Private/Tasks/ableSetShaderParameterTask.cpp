@@ -45,7 +45,7 @@ FString UAbleSetShaderParameterTask::GetModuleName_Implementation() const
 void UAbleSetShaderParameterTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleSetShaderParameterTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -125,7 +125,7 @@ void UAbleSetShaderParameterTask::OnTaskStartBP_Implementation(const UAbleAbilit
 void UAbleSetShaderParameterTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleSetShaderParameterTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -163,7 +163,7 @@ void UAbleSetShaderParameterTask::OnTaskTickBP_Implementation(const UAbleAbility
 void UAbleSetShaderParameterTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult Result) const
 {
 	Super::OnTaskEnd(Context, Result);
-	OnTaskEndBP(Context.Get(), Result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), Result);
 }
 
 void UAbleSetShaderParameterTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -183,6 +183,11 @@ void UAbleSetShaderParameterTask::OnTaskEndBP_Implementation(const UAbleAbilityC
 
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleSetShaderParameterTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleSetShaderParameterTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleSetShaderParameterTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
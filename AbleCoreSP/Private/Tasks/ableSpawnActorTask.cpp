@@ -60,7 +60,7 @@ void UAbleSpawnActorTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityCon
 	check(Context.IsValid());
 
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleSpawnActorTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -192,7 +192,7 @@ void UAbleSpawnActorTask::OnTaskStartBP_Implementation(const UAbleAbilityContext
 void UAbleSpawnActorTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleSpawnActorTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -222,6 +222,16 @@ void UAbleSpawnActorTask::OnTaskEndBP_Implementation(const UAbleAbilityContext*
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleSpawnActorTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	if (m_DestroyAtEnd)
+	{
+		return UAbleSpawnActorTaskScratchPad::StaticClass();
+	}
+
+	return nullptr;
+}
+
 UAbleAbilityTaskScratchPad* UAbleSpawnActorTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (m_DestroyAtEnd)
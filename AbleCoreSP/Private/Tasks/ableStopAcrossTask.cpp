@@ -26,7 +26,7 @@ FString UAbleStopAcrossTask::GetModuleName_Implementation() const
 void UAbleStopAcrossTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleStopAcrossTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -57,7 +57,7 @@ FString UAbleTurnToTask::GetModuleName_Implementation() const
 void UAbleTurnToTask::OnTaskStart(const TWeakObjectPtr<const UAbleAbilityContext>& Context) const
 {
 	Super::OnTaskStart(Context);
-	OnTaskStartBP(Context.Get());
+	ABLE_TASK_EVENT(OnTaskStart, Context.Get());
 }
 
 void UAbleTurnToTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Context) const
@@ -95,7 +95,7 @@ void UAbleTurnToTask::OnTaskStartBP_Implementation(const UAbleAbilityContext* Co
 void UAbleTurnToTask::OnTaskTick(const TWeakObjectPtr<const UAbleAbilityContext>& Context, float deltaTime) const
 {
 	Super::OnTaskTick(Context, deltaTime);
-	OnTaskTickBP(Context.Get(), deltaTime);
+	ABLE_TASK_EVENT(OnTaskTick, Context.Get(), deltaTime);
 }
 
 void UAbleTurnToTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Context, float deltaTime) const
@@ -161,7 +161,7 @@ void UAbleTurnToTask::OnTaskTickBP_Implementation(const UAbleAbilityContext* Con
 void UAbleTurnToTask::OnTaskEnd(const TWeakObjectPtr<const UAbleAbilityContext>& Context, const EAbleAbilityTaskResult result) const
 {
 	Super::OnTaskEnd(Context, result);
-	OnTaskEndBP(Context.Get(), result);
+	ABLE_TASK_EVENT(OnTaskEnd, Context.Get(), result);
 }
 
 void UAbleTurnToTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Context, const EAbleAbilityTaskResult result) const
@@ -197,6 +197,11 @@ void UAbleTurnToTask::OnTaskEndBP_Implementation(const UAbleAbilityContext* Cont
 	}
 }
 
+TSubclassOf<UAbleAbilityTaskScratchPad> UAbleTurnToTask::GetTaskScratchPadClass(const UAbleAbilityContext* Context) const
+{
+	return UAbleTurnToTaskScratchPad::StaticClass();
+}
+
 UAbleAbilityTaskScratchPad* UAbleTurnToTask::CreateScratchPad(const TWeakObjectPtr<UAbleAbilityContext>& Context) const
 {
 	if (UAbleAbilityUtilitySubsystem* Subsystem = Context->GetUtilitySubsystem())
@@ -2,10 +2,13 @@
 
 #include "ableAbility.h"
 #include "AbleCoreSPPrivate.h"
+#include "ableSettings.h"
 #include "Animation/AnimSequence.h"
 #include "Animation/AnimMontage.h"
+#include "Engine/AssetManager.h"
 #include "Engine/Engine.h"
 #include "Engine/NetDriver.h"
+#include "Engine/StreamableManager.h"
 #include "Misc/Crc.h"
 #include "Tasks/ablePlayAnimationTask.h"
 #include "Tasks/IAbleAbilityTask.h"
@@ -13,6 +16,20 @@
 
 #define LOCTEXT_NAMESPACE "AbleAbility"
 
+namespace AbleAssetPreloadUtils
+{
+	static FStreamableManager& GetStreamableManager()
+	{
+		if (UAssetManager::IsValid())
+		{
+			return UAssetManager::GetStreamableManager();
+		}
+
+		static FStreamableManager FallbackManager;
+		return FallbackManager;
+	}
+}
+
 UAbleAbility::UAbleAbility(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer),
 	m_Length(1.0f),
@@ -59,6 +76,9 @@ UAbleAbility::UAbleAbility(const FObjectInitializer& ObjectInitializer)
 void UAbleAbility::PostInitProperties()
 {
 	Super::PostInitProperties();
+
+	// Per-activation instances are created from their template and never see PostLoad, so build our layout here as well.
+	BuildContextParameterLayout();
 }
 
 void UAbleAbility::PreSave(const class ITargetPlatform* TargetPlatform)
@@ -111,6 +131,10 @@ void UAbleAbility::PostLoad()
 
 	// Generate our Name hash.
 	m_AbilityNameHash = FCrc::StrCrc32(*GetName());
+	INC_DWORD_STAT(STAT_AbleNameHashesComputed);
+
+	BuildSegmentLookup();
+	BuildContextParameterLayout();
 }
 
 bool UAbleAbility::IsSupportedForNetworking() const
@@ -124,11 +148,26 @@ void UAbleAbility::PreExecutionInit() const
 	for (int SegmentIndex = 0; SegmentIndex < m_Segments.Num(); SegmentIndex++)
 	{
 		BuildDependencyList(SegmentIndex);
+		BuildTaskTimeline(SegmentIndex);
 	}
+
+#if WITH_EDITOR
+	// Segments and Parameters can be added/renamed in the editor after we've loaded.
+	BuildSegmentLookup();
+	BuildContextParameterLayout();
+#endif
 }
 
 EAbleAbilityStartResult UAbleAbility::CanAbilityExecute(UAbleAbilityContext& Context) const
 {
+	// Kick off our asset streaming the first time we're asked, and optionally hold activation until it's done.
+	const USPAbleSettings* Settings = GetDefault<USPAbleSettings>();
+	const EAbleAssetPreloadPolicy PreloadPolicy = Settings ? Settings->GetAssetPreloadPolicy() : EAbleAssetPreloadPolicy::Disabled;
+	if (PreloadPolicy != EAbleAssetPreloadPolicy::Disabled && !RequestAssetPreload() && PreloadPolicy == EAbleAssetPreloadPolicy::BlockActivation)
+	{
+		return EAbleAbilityStartResult::AsyncProcessing;
+	}
+
 	const AActor* Owner = Context.GetOwner();
 	if (IsValid(Owner))
 	{
@@ -139,7 +178,15 @@ EAbleAbilityStartResult UAbleAbility::CanAbilityExecute(UAbleAbilityContext& Con
 	if (m_Targeting != nullptr)
 	{
 		// If this is Async, it's safe to call it multiple times as it will poll for the results.
-		m_Targeting->FindTargets(Context);
+		// Once the query is back, any filter still waiting on async work picks up where it left off instead.
+		if (Context.HasPendingTargetFilter())
+		{
+			m_Targeting->ResumeFilterTargets(Context);
+		}
+		else
+		{
+			m_Targeting->FindTargets(Context);
+		}
 		
 		if (Context.GetMutableTargetActors().Num())
 		{
@@ -150,7 +197,7 @@ EAbleAbilityStartResult UAbleAbility::CanAbilityExecute(UAbleAbilityContext& Con
 			}
 		}
 
-		if (m_Targeting->IsUsingAsync() && Context.HasValidAsyncHandle())
+		if (m_Targeting->IsUsingAsync() && (Context.HasValidAsyncHandle() || Context.HasPendingTargetFilter()))
 		{
 			return EAbleAbilityStartResult::AsyncProcessing;
 		}
@@ -497,10 +544,34 @@ void UAbleAbility::OnSpawnedActorEventBP_Implementation(const UAbleAbilityContex
 void UAbleAbility::BuildDependencyList(const int SegmentIndex) const
 {
 	if (!m_Segments.IsValidIndex(SegmentIndex)) return;
-	
-	m_Segments[SegmentIndex].m_AllDependentTasks.Empty();
+
+	const FAbilitySegmentDefineData& Segment = m_Segments[SegmentIndex];
+
+#if !WITH_EDITOR
+	if (!Segment.m_DependenciesDirty)
+	{
+		m_AllDependentTasks = Segment.m_AllDependentTasks;
+		return;
+	}
+#endif
+
+	// Per-activation instances share their template's dependencies, so only the template ever searches for them.
+	if (CopyDependencyListFromTemplate(SegmentIndex))
+	{
+		return;
+	}
+
+	Segment.m_AllDependentTasks.Empty();
+	Segment.m_AllDependentTaskIndices.Empty();
 	m_AllDependentTasks.Empty();
 
+	TMap<const UAbleAbilityTask*, int32> SegmentTaskIndices;
+	SegmentTaskIndices.Reserve(Segment.m_Tasks.Num());
+	for (int32 TaskIndex = 0; TaskIndex < Segment.m_Tasks.Num(); ++TaskIndex)
+	{
+		SegmentTaskIndices.Add(Segment.m_Tasks[TaskIndex], TaskIndex);
+	}
+
 	for (UAbleAbilityTask* Task : m_Tasks)
 	{
 		if (!Task)
@@ -521,20 +592,166 @@ void UAbleAbility::BuildDependencyList(const int SegmentIndex) const
 				}
 
                 // Make sure our Tasks and Dependencies are in the same realms (or Client/Server so they'll always run) and that they aren't stale somehow.
+				const int32* DependencyIndex = SegmentTaskIndices.Find(TaskDependency);
                 if ((TaskDependency->GetTaskRealm() == Task->GetTaskRealm() ||
                     TaskDependency->GetTaskRealm() == EAbleAbilityTaskRealm::ATR_ClientAndServer ||
                     Task->GetTaskRealm() == EAbleAbilityTaskRealm::ATR_ClientAndServer) &&
-					m_Segments[SegmentIndex].m_Tasks.Contains(TaskDependency))
-                    // m_Tasks.Contains(TaskDependency))
+					DependencyIndex && !Segment.m_AllDependentTaskIndices.Contains(*DependencyIndex))
                 {
-					m_Segments[SegmentIndex].m_AllDependentTasks.AddUnique(TaskDependency);
-                    m_AllDependentTasks.AddUnique(TaskDependency);
+					Segment.m_AllDependentTaskIndices.Add(*DependencyIndex);
+					Segment.m_AllDependentTasks.Add(TaskDependency);
                 }
             }
         }
 	}
 
-	m_Segments[SegmentIndex].m_DependenciesDirty = false;
+	m_AllDependentTasks = Segment.m_AllDependentTasks;
+	Segment.m_DependenciesDirty = false;
+}
+
+bool UAbleAbility::CopyDependencyListFromTemplate(const int SegmentIndex) const
+{
+	if (!m_Template || !m_Template->m_Segments.IsValidIndex(SegmentIndex)) return false;
+
+	const FAbilitySegmentDefineData& Segment = m_Segments[SegmentIndex];
+	const FAbilitySegmentDefineData& TemplateSegment = m_Template->m_Segments[SegmentIndex];
+
+	// Our Tasks are instanced from the template's, so they line up one to one unless the template has been edited since.
+	if (TemplateSegment.m_Tasks.Num() != Segment.m_Tasks.Num())
+	{
+		return false;
+	}
+
+	m_Template->BuildDependencyList(SegmentIndex);
+
+	Segment.m_AllDependentTaskIndices = TemplateSegment.m_AllDependentTaskIndices;
+	Segment.m_AllDependentTasks.Reset(Segment.m_AllDependentTaskIndices.Num());
+	for (const int32 TaskIndex : Segment.m_AllDependentTaskIndices)
+	{
+		if (const UAbleAbilityTask* Task = Segment.m_Tasks[TaskIndex])
+		{
+			Segment.m_AllDependentTasks.Add(Task);
+		}
+	}
+
+	m_AllDependentTasks = Segment.m_AllDependentTasks;
+	Segment.m_DependenciesDirty = false;
+	return true;
+}
+
+void UAbleAbility::BuildTaskTimeline(const int SegmentIndex) const
+{
+	if (!m_Segments.IsValidIndex(SegmentIndex)) return;
+
+	const FAbilitySegmentDefineData& Segment = m_Segments[SegmentIndex];
+
+#if !WITH_EDITOR
+	if (Segment.m_TaskTimelineBuilt) return;
+#endif
+
+	// Per-activation instances share their template's layout, so only the template ever pays for the sort.
+	if (CopyTaskTimelineFromTemplate(SegmentIndex))
+	{
+		return;
+	}
+
+	Segment.m_TaskTimelineOrder.Reset(Segment.m_Tasks.Num());
+	int32 NumAcrossSegmentTasks = 0;
+	for (int32 TaskIndex = 0; TaskIndex < Segment.m_Tasks.Num(); ++TaskIndex)
+	{
+		if (const UAbleAbilityTask* Task = Segment.m_Tasks[TaskIndex])
+		{
+			Segment.m_TaskTimelineOrder.Add(TaskIndex);
+			NumAcrossSegmentTasks += Task->IsAcrossSegment() ? 1 : 0;
+		}
+	}
+
+	// Instances size themselves from these, so they only ever need to grow.
+	m_MaxSegmentTaskCount = FMath::Max(m_MaxSegmentTaskCount, Segment.m_TaskTimelineOrder.Num());
+	m_NumAcrossSegmentTasks = FMath::Max(m_NumAcrossSegmentTasks, NumAcrossSegmentTasks);
+
+	// Same ordering as SortTasks, but we can't rely on that having been run on older assets.
+	const TArray<UAbleAbilityTask*>& Tasks = Segment.m_Tasks;
+	Segment.m_TaskTimelineOrder.StableSort([&Tasks](const int32 LHS, const int32 RHS)
+	{
+		const UAbleAbilityTask& A = *Tasks[LHS];
+		const UAbleAbilityTask& B = *Tasks[RHS];
+		return A.GetStartTime() == B.GetStartTime() ? A.GetDisplayOrderValue() < B.GetDisplayOrderValue() : A.GetStartTime() < B.GetStartTime();
+	});
+
+	TMap<const UAbleAbilityTask*, int32> TimelineIndexByTask;
+	TimelineIndexByTask.Reserve(Segment.m_TaskTimelineOrder.Num());
+	Segment.m_TaskTimeline.Reset(Segment.m_TaskTimelineOrder.Num());
+	for (const int32 TaskIndex : Segment.m_TaskTimelineOrder)
+	{
+		TimelineIndexByTask.Add(Tasks[TaskIndex], Segment.m_TaskTimeline.Add(Tasks[TaskIndex]));
+	}
+
+	// Now that the order is fixed, hand out dense indices and resolve dependencies against them.
+	for (int32 TimelineIndex = 0; TimelineIndex < Segment.m_TaskTimeline.Num(); ++TimelineIndex)
+	{
+		UAbleAbilityTask* Task = Segment.m_TaskTimeline[TimelineIndex];
+
+		TArray<int32> DependencyIndices;
+		DependencyIndices.Reserve(Task->GetTaskDependencies().Num());
+		for (const UAbleAbilityTask* TaskDependency : Task->GetTaskDependencies())
+		{
+			if (TaskDependency)
+			{
+				const int32* DependencyIndex = TimelineIndexByTask.Find(TaskDependency);
+				DependencyIndices.Add(DependencyIndex ? *DependencyIndex : INDEX_NONE);
+			}
+		}
+
+		Task->SetTimelineIndices(TimelineIndex, MoveTemp(DependencyIndices));
+	}
+
+	Segment.m_TaskTimelineBuilt = true;
+}
+
+bool UAbleAbility::CopyTaskTimelineFromTemplate(const int SegmentIndex) const
+{
+	if (!m_Template || !m_Template->m_Segments.IsValidIndex(SegmentIndex)) return false;
+
+	const FAbilitySegmentDefineData& Segment = m_Segments[SegmentIndex];
+	const FAbilitySegmentDefineData& TemplateSegment = m_Template->m_Segments[SegmentIndex];
+
+	// Our Tasks are instanced from the template's, so they line up one to one unless the template has been edited since.
+	if (TemplateSegment.m_Tasks.Num() != Segment.m_Tasks.Num())
+	{
+		return false;
+	}
+
+	m_Template->BuildTaskTimeline(SegmentIndex);
+	if (!TemplateSegment.m_TaskTimelineBuilt)
+	{
+		return false;
+	}
+
+	Segment.m_TaskTimelineOrder = TemplateSegment.m_TaskTimelineOrder;
+	Segment.m_TaskTimeline.Reset(Segment.m_TaskTimelineOrder.Num());
+	int32 NumAcrossSegmentTasks = 0;
+	for (int32 TimelineIndex = 0; TimelineIndex < Segment.m_TaskTimelineOrder.Num(); ++TimelineIndex)
+	{
+		const int32 TaskIndex = Segment.m_TaskTimelineOrder[TimelineIndex];
+		UAbleAbilityTask* Task = Segment.m_Tasks[TaskIndex];
+		if (!Task)
+		{
+			// Should never occur, but don't leave a half built timeline behind.
+			Segment.m_TaskTimeline.Reset();
+			return false;
+		}
+
+		Segment.m_TaskTimeline.Add(Task);
+		NumAcrossSegmentTasks += Task->IsAcrossSegment() ? 1 : 0;
+		Task->SetTimelineIndices(TimelineIndex, TArray<int32>(TemplateSegment.m_Tasks[TaskIndex]->GetDependencyTimelineIndices()));
+	}
+
+	m_MaxSegmentTaskCount = FMath::Max(m_MaxSegmentTaskCount, Segment.m_TaskTimeline.Num());
+	m_NumAcrossSegmentTasks = FMath::Max(m_NumAcrossSegmentTasks, NumAcrossSegmentTasks);
+
+	Segment.m_TaskTimelineBuilt = true;
+	return true;
 }
 
 FName UAbleAbility::GetDynamicDelegateName(const FString& PropertyName) const
@@ -646,8 +863,82 @@ const TArray<UAbleAbilityTask*> UAbleAbility::GetTasks(const int SegmentIndex) c
 	return m_Segments[SegmentIndex].m_Tasks;
 }
 
+const TArray<UAbleAbilityTask*>& UAbleAbility::GetTaskTimeline(const int SegmentIndex) const
+{
+	static const TArray<UAbleAbilityTask*> EmptyTimeline;
+	if (!m_Segments.IsValidIndex(SegmentIndex)) return EmptyTimeline;
+
+	return m_Segments[SegmentIndex].m_TaskTimeline;
+}
+
+void UAbleAbility::GatherSoftAssetReferences(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const FAbilitySegmentDefineData& Segment : m_Segments)
+	{
+		for (const UAbleAbilityTask* Task : Segment.m_Tasks)
+		{
+			if (Task)
+			{
+				Task->GatherSoftAssetReferences(OutPaths);
+			}
+		}
+	}
+}
+
+bool UAbleAbility::RequestAssetPreload() const
+{
+	// Per-activation instances are thrown away after every activation, so keep the request (and its handle) on our template.
+	if (m_Template)
+	{
+		return m_Template->RequestAssetPreload();
+	}
+
+	if (m_AssetPreloadRequested)
+	{
+		return !m_AssetPreloadHandle.IsValid() || m_AssetPreloadHandle->HasLoadCompleted();
+	}
+	m_AssetPreloadRequested = true;
+
+	TArray<FSoftObjectPath> AssetPaths;
+	GatherSoftAssetReferences(AssetPaths);
+	AssetPaths.RemoveAll([](const FSoftObjectPath& Path) { return Path.ResolveObject() != nullptr; });
+	if (!AssetPaths.Num())
+	{
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_AbleAssetPreloadsRequested);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const FString AbilityName = GetAbilityName();
+	const int32 NumAssets = AssetPaths.Num();
+	m_AssetPreloadHandle = AbleAssetPreloadUtils::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), FStreamableDelegate::CreateLambda([StartTime, AbilityName, NumAssets]()
+	{
+		const float LatencyMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+		SET_FLOAT_STAT(STAT_AbleAssetPreloadLatency, LatencyMs);
+		UE_LOG(LogAbleSP, Verbose, TEXT("Ability [%s] preloaded %d assets in %4.2fms."), *AbilityName, NumAssets, LatencyMs);
+	}), FStreamableManager::AsyncLoadHighPriority);
+
+	return !m_AssetPreloadHandle.IsValid() || m_AssetPreloadHandle->HasLoadCompleted();
+}
+
+void UAbleAbility::BuildContextParameterLayout() const
+{
+	m_ContextParameterLayout.Build(m_ContextParameters);
+}
+
 const int UAbleAbility::FindSegmentIndexByFName(FName name) const
 {
+	if (const int32* FoundIndex = m_SegmentIndexByName.Find(name))
+	{
+		if (m_Segments.IsValidIndex(*FoundIndex) && m_Segments[*FoundIndex].m_SegmentName == name)
+		{
+			return *FoundIndex;
+		}
+	}
+
+	// Our lookup is stale or missing (Segments edited since load), fall back to a scan.
+	INC_DWORD_STAT(STAT_AbleSegmentNameScans);
 	for (int i = 0; i < m_Segments.Num(); i++)
 	{
 		if (m_Segments[i].m_SegmentName == name)
@@ -656,6 +947,45 @@ const int UAbleAbility::FindSegmentIndexByFName(FName name) const
 	return -1;
 }
 
+int32 UAbleAbility::GetBranchSegmentIndex(const FAbilitySegmentBranchData& InBranchData) const
+{
+	if (m_Segments.IsValidIndex(InBranchData.NextIndex) && m_Segments[InBranchData.NextIndex].m_SegmentName == InBranchData.NextName)
+	{
+		return InBranchData.NextIndex;
+	}
+
+	return FindSegmentIndexByFName(InBranchData.NextName);
+}
+
+void UAbleAbility::BuildSegmentLookup() const
+{
+	m_SegmentIndexByName.Reset();
+	for (int32 SegmentIndex = 0; SegmentIndex < m_Segments.Num(); ++SegmentIndex)
+	{
+		// Keep the first, to match the old linear search.
+		if (!m_SegmentIndexByName.Contains(m_Segments[SegmentIndex].m_SegmentName))
+		{
+			m_SegmentIndexByName.Add(m_Segments[SegmentIndex].m_SegmentName, SegmentIndex);
+		}
+	}
+
+	// Now resolve our Branches. Anything that doesn't exist stays INDEX_NONE.
+	for (const FAbilitySegmentDefineData& Segment : m_Segments)
+	{
+		for (const FAbilitySegmentBranchData& SegmentBranch : Segment.BranchData)
+		{
+			const int32* FoundIndex = m_SegmentIndexByName.Find(SegmentBranch.NextName);
+			SegmentBranch.NextIndex = FoundIndex ? *FoundIndex : INDEX_NONE;
+		}
+	}
+
+	for (const FAbilitySegmentBranchData& EntryBranch : BranchData)
+	{
+		const int32* FoundIndex = m_SegmentIndexByName.Find(EntryBranch.NextName);
+		EntryBranch.NextIndex = FoundIndex ? *FoundIndex : INDEX_NONE;
+	}
+}
+
 int UAbleAbility::FindSpecSegmentIndexByFName(TArray<FAbilitySegmentDefineData>& m_SpecSegments, FName name) const
 {
 	for (int i = 0; i < m_SpecSegments.Num(); i++)
@@ -811,6 +1141,16 @@ void UAbleAbility::Process(const UAbleAbility* Template)
 {
 	if (!Template) return;
 
+	m_Template = Template->GetTemplate();
+	m_AbilityNameHash = m_Template->GetAbilityNameHash();
+
+	// Our Segments were copied from the template along with its cached layout, which points at its Tasks rather than ours.
+	for (const FAbilitySegmentDefineData& Segment : m_Segments)
+	{
+		Segment.m_DependenciesDirty = true;
+		Segment.m_TaskTimelineBuilt = false;
+	}
+
 	for (UAbleAbilityTask* Task : m_Tasks)
 	{
 		if (!Task)
@@ -4,9 +4,14 @@
 
 #include "ableAbility.h"
 #include "ableAbilityInstance.h"
+#include "ableAbilityTickManager.h"
 #include "ableAbilityUtilities.h"
+#include "ableCooldownManager.h"
 #include "AbleCoreSPPrivate.h"
 #include "ableSettings.h"
+#include "ableSubSystem.h"
+#include "ableTargetingIndex.h"
+#include "MoeGameplay/Core/MoeGameLibrary.h"
 #include "ableAbilityUtilities.h"
 #include "Animation/AnimNode_SPAbilityAnimPlayer.h"
 
@@ -27,15 +32,15 @@
 FAbleAbilityCooldown::FAbleAbilityCooldown()
 	: Ability(nullptr),
 	Context(nullptr),
-	CurrentTime(0.0f),
+	StartTime(0.0f),
 	CooldownTime(1.0f)
 {
 
 }
-FAbleAbilityCooldown::FAbleAbilityCooldown(const UAbleAbility& InAbility, const UAbleAbilityContext& InContext)
+FAbleAbilityCooldown::FAbleAbilityCooldown(const UAbleAbility& InAbility, const UAbleAbilityContext& InContext, float InStartTime)
 	: Ability(nullptr),
 	Context(nullptr),
-	CurrentTime(0.0f),
+	StartTime(InStartTime),
 	CooldownTime(1.0f)
 {
 	Ability = &InAbility;
@@ -43,20 +48,212 @@ FAbleAbilityCooldown::FAbleAbilityCooldown(const UAbleAbility& InAbility, const
 	CooldownTime = Ability->GetCooldown(Context);
 }
 
-void FAbleAbilityCooldown::Update(float DeltaTime)
+bool FAbleAbilityCooldown::RefreshCooldownTime()
 {
 	if (Ability && Context && !Ability->CanCacheCooldown())
 	{
-		CooldownTime = Ability->GetCooldown(Context);
+		const float NewCooldownTime = Ability->GetCooldown(Context);
+		if (NewCooldownTime != CooldownTime)
+		{
+			CooldownTime = NewCooldownTime;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FAbleAbilityCooldown::CanCacheCooldownTime() const
+{
+	return !Ability || !Context || Ability->CanCacheCooldown();
+}
+
+FAblePassiveAbilityHandle FAblePassiveAbilityInstanceArray::GetHandle(int32 Index) const
+{
+	if (!Instances.IsValidIndex(Index))
+	{
+		return FAblePassiveAbilityHandle();
+	}
+
+	const int32 Slot = IndexToSlot[Index];
+	return FAblePassiveAbilityHandle(Slot, Slots[Slot].Serial);
+}
+
+UAbleAbilityInstance* FAblePassiveAbilityInstanceArray::Resolve(const FAblePassiveAbilityHandle& Handle) const
+{
+	if (!Slots.IsValidIndex(Handle.Slot))
+	{
+		return nullptr;
+	}
+
+	const FAblePassiveAbilitySlot& Slot = Slots[Handle.Slot];
+	return (Slot.Serial == Handle.Serial && Slot.DenseIndex != INDEX_NONE) ? Instances[Slot.DenseIndex] : nullptr;
+}
+
+FAblePassiveAbilityHandle FAblePassiveAbilityInstanceArray::Add(UAbleAbilityInstance* Instance)
+{
+	check(Instance && Instance->IsValid());
+	const uint32 AbilityNameHash = Instance->GetAbilityNameHash();
+
+	const int32 Slot = FreeSlots.Num() > 0 ? FreeSlots.Pop(false) : Slots.AddDefaulted();
+	const int32 Index = Instances.Add(Instance);
+	IndexToSlot.Add(Slot);
+	IndexToHash.Add(AbilityNameHash);
+	Slots[Slot].DenseIndex = Index;
+	// Non-stacking Passives can run more than one Instance, lookups have always returned the oldest.
+	if (!HashToIndex.Contains(AbilityNameHash))
+	{
+		HashToIndex.Add(AbilityNameHash, Index);
+	}
+
+	return FAblePassiveAbilityHandle(Slot, Slots[Slot].Serial);
+}
+
+UAbleAbilityInstance* FAblePassiveAbilityInstanceArray::RemoveAt(int32 Index)
+{
+	check(Instances.IsValidIndex(Index));
+
+	UAbleAbilityInstance* Instance = Instances[Index];
+	const int32 Slot = IndexToSlot[Index];
+
+	// Use our own copy of the hash, the Instance may already be torn down.
+	const uint32 AbilityNameHash = IndexToHash[Index];
+	const int32* IndexedAt = HashToIndex.Find(AbilityNameHash);
+	const bool WasIndexed = IndexedAt && *IndexedAt == Index;
+	if (WasIndexed)
+	{
+		HashToIndex.Remove(AbilityNameHash);
+	}
+
+	// Shift everything after us down rather than swapping, so we stay in activation (and update) order.
+	Instances.RemoveAt(Index, 1, false);
+	IndexToSlot.RemoveAt(Index, 1, false);
+	IndexToHash.RemoveAt(Index, 1, false);
+
+	for (int32 ShiftedIndex = Index; ShiftedIndex < IndexToSlot.Num(); ++ShiftedIndex)
+	{
+		Slots[IndexToSlot[ShiftedIndex]].DenseIndex = ShiftedIndex;
+	}
+
+	for (TPair<uint32, int32>& Indexed : HashToIndex)
+	{
+		if (Indexed.Value > Index)
+		{
+			--Indexed.Value;
+		}
+	}
+
+	if (WasIndexed)
+	{
+		// Hand the lookup to the next oldest Instance of the same Passive, which is the first one left in order.
+		const int32 OtherIndex = IndexToHash.Find(AbilityNameHash);
+		if (OtherIndex != INDEX_NONE)
+		{
+			HashToIndex.Add(AbilityNameHash, OtherIndex);
+		}
+	}
+
+	Slots[Slot].DenseIndex = INDEX_NONE;
+	++Slots[Slot].Serial;
+	FreeSlots.Add(Slot);
+
+	return Instance;
+}
+
+void FAblePassiveAbilityInstanceArray::Empty()
+{
+	while (Instances.Num() > 0)
+	{
+		RemoveAt(Instances.Num() - 1);
+	}
+}
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cooldowns Expired"), STAT_AbleCooldownsExpired, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ability Component Updates"), STAT_AbleComponentUpdates, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Awake Ability Components"), STAT_AbleAwakeComponents, STATGROUP_Able);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combined Tag Rebuilds"), STAT_AbleCombinedTagRebuilds, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Passive Replication Items Dirtied"), STAT_AblePassiveReplicationItemsDirtied, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Passive Replication Arrays Dirtied"), STAT_AblePassiveReplicationArraysDirtied, STATGROUP_Able);
+
+FAbleReplicatedPassiveAbility::FAbleReplicatedPassiveAbility(const FAbleAbilityNetworkContext& InContext)
+	: Context(InContext),
+	AbilityNameHash(InContext.GetAbility().IsValid() ? InContext.GetAbility()->GetAbilityNameHash() : 0U)
+{
+
+}
+
+void FAbleReplicatedPassiveAbility::PreReplicatedRemove(const FAbleReplicatedPassiveAbilityArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnServerPassiveAbilityRemoved(AbilityNameHash);
 	}
+}
+
+void FAbleReplicatedPassiveAbility::PostReplicatedAdd(const FAbleReplicatedPassiveAbilityArray& InArraySerializer)
+{
+	AbilityNameHash = Context.GetAbility().IsValid() ? Context.GetAbility()->GetAbilityNameHash() : 0U;
 
-	CurrentTime += DeltaTime;
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnServerPassiveAbilityAdded(Context);
+	}
+}
+
+void FAbleReplicatedPassiveAbility::PostReplicatedChange(const FAbleReplicatedPassiveAbilityArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnServerPassiveAbilityChanged(Context);
+	}
+}
+
+FAbleReplicatedPassiveAbility* FAbleReplicatedPassiveAbilityArray::FindByHash(uint32 AbilityNameHash)
+{
+	// Only a handful of Passives per Component, and the hash is cached on the entry, so a scan is as quick as anything else.
+	for (FAbleReplicatedPassiveAbility& Item : Items)
+	{
+		if (Item.AbilityNameHash == AbilityNameHash)
+		{
+			return &Item;
+		}
+	}
+
+	return nullptr;
+}
+
+void FAbleReplicatedPassiveAbilityArray::AddOrUpdate(const UAbleAbilityContext& Context, int32 StackCount)
+{
+	const UAbleAbility* Ability = Context.GetAbility();
+	if (!Ability)
+	{
+		return;
+	}
+
+	if (FAbleReplicatedPassiveAbility* ExistingItem = FindByHash(Ability->GetAbilityNameHash()))
+	{
+		if (ExistingItem->Context.GetCurrentStack() != StackCount)
+		{
+			ExistingItem->Context.SetCurrentStacks((int8)StackCount);
+			MarkItemDirty(*ExistingItem);
+			INC_DWORD_STAT(STAT_AblePassiveReplicationItemsDirtied);
+		}
+	}
+	else
+	{
+		FAbleReplicatedPassiveAbility& NewItem = Items.Add_GetRef(FAbleReplicatedPassiveAbility(FAbleAbilityNetworkContext(Context)));
+		NewItem.Context.SetCurrentStacks((int8)StackCount);
+		MarkItemDirty(NewItem);
+		INC_DWORD_STAT(STAT_AblePassiveReplicationItemsDirtied);
+	}
 }
 
 UAbleAbilityComponent::UAbleAbilityComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer),
 	m_ActiveAbilityInstance(nullptr),
     m_PassivesDirty(false),
+	m_CombinedTagsDirty(true),
 	m_ClientPredictionKey(0),
 	m_AbilityAnimationNode(nullptr)
 {
@@ -64,6 +261,7 @@ UAbleAbilityComponent::UAbleAbilityComponent(const FObjectInitializer& ObjectIni
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 	PrimaryComponentTick.bCanEverTick = true;
 	bTickInEditor = true;
+	bWantsInitializeComponent = true;
 	SetIsReplicatedByDefault(true);
 
 	m_Settings = GetDefault<USPAbleSettings>(USPAbleSettings::StaticClass());
@@ -72,11 +270,47 @@ UAbleAbilityComponent::UAbleAbilityComponent(const FObjectInitializer& ObjectIni
 	m_LocallyPredictedAbilities.AddDefaulted(ABLE_ABILITY_PREDICTION_RING_SIZE);
 }
 
+void UAbleAbilityComponent::InitializeComponent()
+{
+	Super::InitializeComponent();
+
+	m_ServerPassiveAbilities.Owner = this;
+}
+
 void UAbleAbilityComponent::BeginPlay()
 {
 	m_TagContainer.AppendTags(m_AutoApplyTags);
+	InvalidateCombinedGameplayTags();
 
 	Super::BeginPlay();
+
+	if (UAbleAbilityTickManager* TickManager = UAbleAbilityTickManager::Get(GetWorld()))
+	{
+		// The Tick Manager drives our updates from here on out, hand over anything we already had going.
+		m_TickManager = TickManager;
+		PrimaryComponentTick.SetTickFunctionEnable(false);
+		CheckNeedsTick();
+	}
+
+	if (UAbleCooldownManager* CooldownManager = UAbleCooldownManager::Get(GetWorld()))
+	{
+		m_CooldownManager = CooldownManager;
+
+		// Anything added before we had a manager still needs its expiry scheduled.
+		for (const TPair<uint32, FAbleAbilityCooldown>& Cooldown : m_ActiveCooldowns)
+		{
+			ScheduleCooldownExpiry(Cooldown.Key, Cooldown.Value);
+		}
+		CheckNeedsTick();
+	}
+
+	if (m_AddToTargetingIndex && GetOwner())
+	{
+		if (UAbleTargetingIndex* TargetingIndex = UAbleTargetingIndex::Get(GetWorld()))
+		{
+			TargetingIndex->AddActor(*GetOwner());
+		}
+	}
 }
 
 void UAbleAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -85,9 +319,10 @@ void UAbleAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	{
 		m_ActiveAbilityInstance->StopAbility();
 		HandleInstanceCleanUp(m_ActiveAbilityInstance->GetAbility());
-	    m_ActiveAbilityInstance->Reset();
+		ReleaseAbilityInstance(m_ActiveAbilityInstance);
 	}
 	m_ActiveAbilityInstance = nullptr;
+	InvalidateCombinedGameplayTags();
 	m_ActiveAbilityResult = EAbleAbilityTaskResult::Successful;
 	
 	for (UAbleAbilityInstance* PassiveInstance : m_PassiveAbilityInstances)
@@ -97,8 +332,32 @@ void UAbleAbilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 			PassiveInstance->StopAbility();
 			HandleInstanceCleanUp(PassiveInstance->GetAbility());
 		}
+		ReleaseAbilityInstance(PassiveInstance);
 	}
 	m_PassiveAbilityInstances.Empty();
+	InvalidateCombinedGameplayTags();
+	FlushRetiredInstances();
+
+	if (UAbleAbilityTickManager* TickManager = m_TickManager.Get())
+	{
+		TickManager->SetComponentTickEnabled(*this, false);
+	}
+	m_TickManager.Reset();
+	m_CooldownManager.Reset();
+
+	if (m_AddToTargetingIndex && GetOwner())
+	{
+		if (UAbleTargetingIndex* TargetingIndex = UAbleTargetingIndex::Get(GetWorld()))
+		{
+			TargetingIndex->RemoveActor(*GetOwner());
+		}
+	}
+
+	if (!m_IsDormant)
+	{
+		m_IsDormant = true;
+		DEC_DWORD_STAT(STAT_AbleAwakeComponents);
+	}
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -107,20 +366,20 @@ void UAbleAbilityComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AbleAbilityComponent::TickComponent"), STAT_AbleAbilityComponent_TickComponent, STATGROUP_Able);
 
-	// Do our cooldowns first (if we're Async this will give it a bit of time to go ahead and start running).
+	// Cooldowns are normally expired by the Cooldown Manager, we only sweep them ourselves if there isn't one (or they can't be cached).
 	if (m_ActiveCooldowns.Num() > 0)
 	{
-		// Go ahead and fire off our cooldown update first.
-		if (USPAbleSettings::IsAsyncEnabled() && m_Settings->GetAllowAsyncCooldownUpdate())
-		{
-			TGraphTask<FAsyncAbilityCooldownUpdaterTask>::CreateTask().ConstructAndDispatchWhenReady(this, DeltaTime);
-		}
-		else
-		{
-			UpdateCooldowns(DeltaTime);
-		}
+		UpdateCooldowns();
 	}
 
+	TickAbilities(DeltaTime);
+}
+
+void UAbleAbilityComponent::TickAbilities(float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AbleAbilityComponent::TickAbilities"), STAT_AbleAbilityComponent_TickAbilities, STATGROUP_Able);
+	INC_DWORD_STAT(STAT_AbleComponentUpdates);
+
 	bool ActiveChanged = false;
 	bool PassivesChanged = false;
 
@@ -174,7 +433,7 @@ void UAbleAbilityComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
 					UAbleAbilityContext* Context = &m_ActiveAbilityInstance->GetMutableContext();
 					for (auto& BranchData : DefineData->BranchData)
 					{
-						int BranchIndex = Ability.FindSegmentIndexByFName(BranchData.NextName);
+						int BranchIndex = Ability.GetBranchSegmentIndex(BranchData);
 						if (BranchIndex < 0)
 							continue;
 						if (!UAbleAbilityBlueprintLibrary::IsValidForNetwork( Context->GetSelfActor(), BranchData.Realm))
@@ -244,8 +503,9 @@ void UAbleAbilityComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
 	if (ActiveChanged && m_ActiveAbilityInstance)
 	{
 		UE_LOG(LogAbleSP, Warning, TEXT("Killed Active Ability manually after it failed to cancel."));
-		m_ActiveAbilityInstance->Reset();
+		ReleaseAbilityInstance(m_ActiveAbilityInstance);
 		m_ActiveAbilityInstance = nullptr;
+		InvalidateCombinedGameplayTags();
 	}
 #endif
 
@@ -342,7 +602,7 @@ void UAbleAbilityComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
 						EAbleAbilityTaskRealm Realm = EAbleAbilityTaskRealm::ATR_TotalRealms;
 						for (auto& BranchData : DefineData->BranchData)
 						{
-							int BranchIndex = Ability.FindSegmentIndexByFName(BranchData.NextName);
+							int BranchIndex = Ability.GetBranchSegmentIndex(BranchData);
 							if (BranchIndex < 0)
 								continue;
 							if (!UAbleAbilityBlueprintLibrary::IsValidForNetwork( Context->GetSelfActor(), BranchData.Realm))
@@ -405,7 +665,7 @@ void UAbleAbilityComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
 							EAbleAbilityTaskRealm Realm = EAbleAbilityTaskRealm::ATR_TotalRealms;
 							for (auto& BranchData : DefineData->BranchData)
 							{
-								int BranchIndex = Ability.FindSegmentIndexByFName(BranchData.NextName);
+								int BranchIndex = Ability.GetBranchSegmentIndex(BranchData);
 								if (BranchIndex < 0)
 									continue;
  								if (!UAbleAbilityBlueprintLibrary::IsValidForNetwork( Context->GetSelfActor(), BranchData.Realm))
@@ -490,6 +750,9 @@ void UAbleAbilityComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
 		}
 	}
 
+	// Nothing is holding onto released Instances now, they can go back to the pool.
+	FlushRetiredInstances();
+
 	CheckNeedsTick();
 
 	// We've finished our update, validate things for remote clients - any Abilities that need to restart will begin next frame.
@@ -504,7 +767,9 @@ void UAbleAbilityComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 
 	// These two fields are replicated and watched by the client.
 	// DOREPLIFETIME(UAbleAbilityComponent, m_ServerActive);
-	// DOREPLIFETIME(UAbleAbilityComponent, m_ServerPassiveAbilities);
+
+	// A fast array, so only the Passives that were added, removed, or restacked go over the wire.
+	DOREPLIFETIME(UAbleAbilityComponent, m_ServerPassiveAbilities);
 	/*DOREPLIFETIME(UAbleAbilityComponent, m_ServerPredictionKey);*/
 }
 
@@ -724,7 +989,7 @@ bool UAbleAbilityComponent::JumpSegment(const UAbleAbilityContext* Context, cons
 				EAbleAbilityTaskRealm Realm = EAbleAbilityTaskRealm::ATR_TotalRealms;
 				for (auto& BranchData : DefineData->BranchData)
 				{
-					int BranchIndex = Ability->FindSegmentIndexByFName(BranchData.NextName);
+					int BranchIndex = Ability->GetBranchSegmentIndex(BranchData);
 					if (BranchIndex < 0)
 						continue;
 					if (UAbleAbilityBlueprintLibrary::CheckBranchCondWithBranchData(&m_ActiveAbilityInstance->GetMutableContext(), BranchData))
@@ -960,8 +1225,9 @@ void UAbleAbilityComponent::CancelActiveAbility(EAbleAbilityTaskResult ResultToU
         }
 		
 		HandleInstanceCleanUp(m_ActiveAbilityInstance->GetAbility());
-		m_ActiveAbilityInstance->Reset();
+		ReleaseAbilityInstance(m_ActiveAbilityInstance);
 		m_ActiveAbilityInstance = nullptr;
+		InvalidateCombinedGameplayTags();
 		m_ActiveAbilityResult = ResultToUse;
 	}
 
@@ -1065,20 +1331,21 @@ EAbleAbilityStartResult UAbleAbilityComponent::ActivatePassiveAbility(UAbleAbili
 
 		// Save and process it later once the Async query is done.
 		m_AsyncContexts.AddUnique(Context);
+		CheckNeedsTick();
 		return Result;
 	}
 	else if (Result == EAbleAbilityStartResult::PassiveMaxStacksReached)
 	{
 		if (Ability->AlwaysRefreshDuration())
 		{
-			UAbleAbilityInstance** FoundPassive = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(Ability->GetAbilityNameHash()));
+			UAbleAbilityInstance* FoundPassive = m_PassiveAbilityInstances.FindByHash(Ability->GetAbilityNameHash());
 			if (FoundPassive)
 			{
-				(*FoundPassive)->ResetTime(Ability->RefreshLoopTimeOnly());
+				FoundPassive->ResetTime(Ability->RefreshLoopTimeOnly());
 
 				if (Ability->ResetLoopCountOnRefresh())
 				{
-					(*FoundPassive)->SetCurrentIteration(0);
+					FoundPassive->SetCurrentIteration(0);
 				}
 
                 if (m_Settings->GetLogVerbose())
@@ -1103,22 +1370,22 @@ EAbleAbilityStartResult UAbleAbilityComponent::ActivatePassiveAbility(UAbleAbili
 	}
 	else if (Result == EAbleAbilityStartResult::Success)
 	{
-		UAbleAbilityInstance** FoundPassive = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(Ability->GetAbilityNameHash()));
+		UAbleAbilityInstance* FoundPassive = m_PassiveAbilityInstances.FindByHash(Ability->GetAbilityNameHash());
 		if (FoundPassive && Ability->CanStack())
 		{
-			UAbleAbilityContext& MutableContext = (*FoundPassive)->GetMutableContext();
+			UAbleAbilityContext& MutableContext = FoundPassive->GetMutableContext();
 			int32 StackIncrement = FMath::Max(Ability->GetStackIncrement(Context), 1);
 			MutableContext.SetStackCount(MutableContext.GetCurrentStackCount() + StackIncrement);
 			Ability->OnAbilityStackAddedBP(&MutableContext);
 
 			if (Ability->RefreshDurationOnNewStack())
 			{
-				(*FoundPassive)->ResetTime(Ability->RefreshLoopTimeOnly());
+				FoundPassive->ResetTime(Ability->RefreshLoopTimeOnly());
 			}
 
 			if (Ability->ResetLoopCountOnRefresh())
 			{
-				(*FoundPassive)->SetCurrentIteration(0);
+				FoundPassive->SetCurrentIteration(0);
 			}
 
             if (m_Settings->GetLogVerbose())
@@ -1139,7 +1406,7 @@ EAbleAbilityStartResult UAbleAbilityComponent::ActivatePassiveAbility(UAbleAbili
 		else
 		{
 			// New Instance
-			UAbleAbilityInstance* NewInstance = NewObject<UAbleAbilityInstance>(this);
+			UAbleAbilityInstance* NewInstance = AcquireAbilityInstance();
 			NewInstance->Initialize(*Context);
 			
 			// We've passed all our checks, go ahead and allocate our Task scratch pads.
@@ -1161,6 +1428,7 @@ EAbleAbilityStartResult UAbleAbilityComponent::ActivatePassiveAbility(UAbleAbili
             }
 			
 			m_PassiveAbilityInstances.Add(NewInstance);
+			InvalidateCombinedGameplayTags();
 		}
 	}
 	else
@@ -1211,15 +1479,40 @@ int32 UAbleAbilityComponent::GetCurrentStackCountForPassiveAbility(const UAbleAb
 		return 0;
 	}
 
-	UAbleAbilityInstance* const * FoundPassive = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(Ability->GetAbilityNameHash()));
+	UAbleAbilityInstance* FoundPassive = m_PassiveAbilityInstances.FindByHash(Ability->GetAbilityNameHash());
 	if (FoundPassive)
 	{
-		return (*FoundPassive)->GetStackCount();
+		return FoundPassive->GetStackCount();
 	}
 
 	return 0;
 }
 
+FAblePassiveAbilityHandle UAbleAbilityComponent::GetPassiveAbilityHandle(const UAbleAbility* Ability) const
+{
+	if (!Ability)
+	{
+		return FAblePassiveAbilityHandle();
+	}
+
+	return m_PassiveAbilityInstances.GetHandle(m_PassiveAbilityInstances.IndexOfHash(Ability->GetAbilityNameHash()));
+}
+
+int32 UAbleAbilityComponent::GetPassiveStackCountByHandle(const FAblePassiveAbilityHandle& Handle) const
+{
+	const UAbleAbilityInstance* PassiveInstance = m_PassiveAbilityInstances.Resolve(Handle);
+	return PassiveInstance && PassiveInstance->IsValid() ? PassiveInstance->GetStackCount() : 0;
+}
+
+void UAbleAbilityComponent::CancelPassiveAbilityByHandle(const FAblePassiveAbilityHandle& Handle, EAbleAbilityTaskResult ResultToUse)
+{
+	const UAbleAbilityInstance* PassiveInstance = m_PassiveAbilityInstances.Resolve(Handle);
+	if (PassiveInstance && PassiveInstance->IsValid())
+	{
+		CancelAbility(&PassiveInstance->GetAbility(), ResultToUse);
+	}
+}
+
 void UAbleAbilityComponent::GetCurrentPassiveAbilities(TArray<UAbleAbility*>& OutPassives) const
 {
 	OutPassives.Empty();
@@ -1238,39 +1531,39 @@ void UAbleAbilityComponent::SetPassiveStackCount(const UAbleAbility* Ability, in
 		return;
 	}
 
-	UAbleAbilityInstance* const * FoundPassive = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(Ability->GetAbilityNameHash()));
+	UAbleAbilityInstance* FoundPassive = m_PassiveAbilityInstances.FindByHash(Ability->GetAbilityNameHash());
 	if (FoundPassive)
 	{
 		if (NewStackCount == 0)
 		{
 			// make sure to notify of "stack removal" first
-			(*FoundPassive)->GetAbility().OnAbilityStackRemovedBP(&(*FoundPassive)->GetContext());
+			FoundPassive->GetAbility().OnAbilityStackRemovedBP(&FoundPassive->GetContext());
 
 			// Just cancel the Passive->
 			CancelAbility(Ability, ResultToUseOnCancel);
 		}
 		else
 		{
-			int32 current = (*FoundPassive)->GetStackCount();
-			(*FoundPassive)->SetStackCount(NewStackCount);
+			int32 current = FoundPassive->GetStackCount();
+			FoundPassive->SetStackCount(NewStackCount);
 
 			if (current > NewStackCount)
 			{
-				(*FoundPassive)->GetAbility().OnAbilityStackRemovedBP(&(*FoundPassive)->GetContext());
+				FoundPassive->GetAbility().OnAbilityStackRemovedBP(&FoundPassive->GetContext());
 			}
 			else
 			{
-				(*FoundPassive)->GetAbility().OnAbilityStackAddedBP(&(*FoundPassive)->GetContext());
+				FoundPassive->GetAbility().OnAbilityStackAddedBP(&FoundPassive->GetContext());
 			}
 
 			if (ResetDuration)
 			{
-				(*FoundPassive)->ResetTime(Ability->RefreshLoopTimeOnly());
+				FoundPassive->ResetTime(Ability->RefreshLoopTimeOnly());
 			}
 
 			if (Ability->ResetLoopCountOnRefresh())
 			{
-				(*FoundPassive)->SetCurrentIteration(0);
+				FoundPassive->SetCurrentIteration(0);
 			}
 		}
 	}
@@ -1283,7 +1576,7 @@ float UAbleAbilityComponent::GetAbilityCooldownRatio(const UAbleAbility* Ability
 	{
 		if (const FAbleAbilityCooldown* FoundCooldown = m_ActiveCooldowns.Find(Ability->GetAbilityNameHash()))
 		{
-			return FoundCooldown->getTimeRatio();
+			return FoundCooldown->getTimeRatio(GetCooldownWorldTime());
 		}
 	}
 
@@ -1318,16 +1611,21 @@ void UAbleAbilityComponent::SetCooldown(const UAbleAbility* Ability, UAbleAbilit
 		if (time <= 0.0f)
 		{
 			RemoveCooldown(Ability);
+			return;
 		}
 
-		if (FAbleAbilityCooldown* cooldown = m_ActiveCooldowns.Find(Ability->GetAbilityNameHash()))
+		const uint32 AbilityNameHash = Ability->GetAbilityNameHash();
+		if (FAbleAbilityCooldown* cooldown = m_ActiveCooldowns.Find(AbilityNameHash))
 		{
 			cooldown->SetCooldownTime(time);
+			ScheduleCooldownExpiry(AbilityNameHash, *cooldown);
 		}
 		else if (Context)
 		{
-			FAbleAbilityCooldown newCooldown(*Ability, *Context);
-			m_ActiveCooldowns.Add(Ability->GetAbilityNameHash(), newCooldown);
+			FAbleAbilityCooldown newCooldown(*Ability, *Context, GetCooldownWorldTime());
+			newCooldown.SetCooldownTime(time);
+			ScheduleCooldownExpiry(AbilityNameHash, m_ActiveCooldowns.Add(AbilityNameHash, newCooldown));
+			CheckNeedsTick();
 		}
 		else
 		{
@@ -1342,10 +1640,10 @@ float UAbleAbilityComponent::GetAbilityCurrentTime(const UAbleAbility* Ability)
 	{
 		if (Ability->IsPassive())
 		{
-			UAbleAbilityInstance* const * FoundPassive = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(Ability->GetAbilityNameHash()));
+			UAbleAbilityInstance* FoundPassive = m_PassiveAbilityInstances.FindByHash(Ability->GetAbilityNameHash());
 			if (FoundPassive)
 			{
-				return (*FoundPassive)->GetCurrentTime();
+				return FoundPassive->GetCurrentTime();
 			}
 		}
 		else if (m_ActiveAbilityInstance && m_ActiveAbilityInstance->GetAbilityNameHash() == Ability->GetAbilityNameHash())
@@ -1363,10 +1661,10 @@ float UAbleAbilityComponent::GetAbilityCurrentTimeRatio(const UAbleAbility* Abil
 	{
 		if (Ability->IsPassive())
 		{
-			UAbleAbilityInstance* const * FoundPassive = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(Ability->GetAbilityNameHash()));
+			UAbleAbilityInstance* FoundPassive = m_PassiveAbilityInstances.FindByHash(Ability->GetAbilityNameHash());
 			if (FoundPassive)
 			{
-				return (*FoundPassive)->GetCurrentTimeRatio();
+				return FoundPassive->GetCurrentTimeRatio();
 			}
 		}
 		else if (m_ActiveAbilityInstance && m_ActiveAbilityInstance->GetAbilityNameHash() == Ability->GetAbilityNameHash())
@@ -1451,14 +1749,36 @@ void UAbleAbilityComponent::ModifyContext(const TWeakObjectPtr<const UAbleAbilit
 
 void UAbleAbilityComponent::CheckNeedsTick()
 {
+	// Anything purely time based (Cooldowns) is handled by the world managers, so if none of the below is true we go
+	// fully dormant and cost nothing per frame. Anything that gives us work (activation, RPCs, replication callbacks) calls back in here to wake us.
 	// We need to tick if we...
 	bool NeedsTick = m_ActiveAbilityInstance || // Have an active ability...
         m_PassivesDirty || // Have pending dirty passives...
         m_PassiveAbilityInstances.Num() || // Have any passive abilities...
-		m_ActiveCooldowns.Num() || // Have active cooldowns...
+		(m_ActiveCooldowns.Num() && (!m_CooldownManager.IsValid() || HasUncachedCooldowns())) || // Have active cooldowns no one else will expire or refresh...
 		m_AsyncContexts.Num() || // Have Async targeting to process...
 		m_PendingContext.Num() || // We have a pending context...
-		m_PendingCancels.Num();  // We have a pending cancel...
+		m_PendingCancels.Num() || // We have a pending cancel...
+		m_RetiredInstances.Num(); // Have released Instances to hand back to the pool...
+
+	if (m_IsDormant == NeedsTick)
+	{
+		m_IsDormant = !NeedsTick;
+		if (NeedsTick)
+		{
+			INC_DWORD_STAT(STAT_AbleAwakeComponents);
+		}
+		else
+		{
+			DEC_DWORD_STAT(STAT_AbleAwakeComponents);
+		}
+	}
+
+	if (UAbleAbilityTickManager* TickManager = m_TickManager.Get())
+	{
+		TickManager->SetComponentTickEnabled(*this, NeedsTick);
+		return;
+	}
 
 	PrimaryComponentTick.SetTickFunctionEnable(NeedsTick);
 }
@@ -1495,6 +1815,7 @@ EAbleAbilityStartResult UAbleAbilityComponent::InternalStartAbility(UAbleAbility
 		{
 			// Save and process it later once the Async query is done.
 			m_AsyncContexts.AddUnique(Context);
+			CheckNeedsTick();
 
 			return Result;
 		}
@@ -1576,8 +1897,9 @@ EAbleAbilityStartResult UAbleAbilityComponent::InternalStartAbility(UAbleAbility
 			m_IsProcessingUpdate = false;
 		}
 		HandleInstanceCleanUp(m_ActiveAbilityInstance->GetAbility());
-		m_ActiveAbilityInstance->Reset();
+		ReleaseAbilityInstance(m_ActiveAbilityInstance);
 		m_ActiveAbilityInstance = nullptr;
+		InvalidateCombinedGameplayTags();
 	}
 
     if (m_Settings->GetLogVerbose())
@@ -1587,13 +1909,14 @@ EAbleAbilityStartResult UAbleAbilityComponent::InternalStartAbility(UAbleAbility
             *(GetNameSafe(Context->GetAbility())));
     }
 	
-	UAbleAbilityInstance* NewInstance = NewObject<UAbleAbilityInstance>(this);
+	UAbleAbilityInstance* NewInstance = AcquireAbilityInstance();
 	NewInstance->Initialize(*Context);
 
 	// We've passed all our checks, go ahead and allocate our Task scratch pads.
 	Context->AllocateScratchPads();
 
 	m_ActiveAbilityInstance = NewInstance;
+	InvalidateCombinedGameplayTags();
 
 	// Go ahead and start our cooldown.
 	AddCooldownForAbility(*(Context->GetAbility()), *Context);
@@ -1626,25 +1949,24 @@ void UAbleAbilityComponent::InternalCancelAbility(const UAbleAbility* Ability, E
 	}
 	else if (Ability && Ability->IsPassive())
 	{
-		for (int i = 0; i < m_PassiveAbilityInstances.Num(); ++i)
+		const int32 PassiveIndex = m_PassiveAbilityInstances.IndexOfHash(Ability->GetAbilityNameHash());
+		UAbleAbilityInstance* PassiveInstance = PassiveIndex != INDEX_NONE ? m_PassiveAbilityInstances[PassiveIndex] : nullptr;
+		if (PassiveInstance && PassiveInstance->IsValid())
 		{
-			if (m_PassiveAbilityInstances[i] && m_PassiveAbilityInstances[i]->IsValid() && m_PassiveAbilityInstances[i]->GetAbilityNameHash() == Ability->GetAbilityNameHash())
-			{
-                if (m_Settings->GetLogVerbose())
-                {
-                    UE_LOG(LogAbleSP, Warning, TEXT("[%s] CancelPassiveAbility( %s ) Result [%s]"),
-                        *FAbleSPLogHelper::GetWorldName(GetOwner()->GetWorld()),
-                        *m_PassiveAbilityInstances[i]->GetAbility().GetAbilityName(),
-                        *FAbleSPLogHelper::GetTaskResultEnumAsString(ResultToUse));
-                }
+            if (m_Settings->GetLogVerbose())
+            {
+                UE_LOG(LogAbleSP, Warning, TEXT("[%s] CancelPassiveAbility( %s ) Result [%s]"),
+                    *FAbleSPLogHelper::GetWorldName(GetOwner()->GetWorld()),
+                    *PassiveInstance->GetAbility().GetAbilityName(),
+                    *FAbleSPLogHelper::GetTaskResultEnumAsString(ResultToUse));
+            }
 
-				m_PassiveAbilityInstances[i]->FinishAbility();
-				HandleInstanceCleanUp(m_PassiveAbilityInstances[i]->GetAbility());
-				m_PassiveAbilityInstances.RemoveAt(i);
+			PassiveInstance->FinishAbility();
+			HandleInstanceCleanUp(PassiveInstance->GetAbility());
+			ReleaseAbilityInstance(m_PassiveAbilityInstances.RemoveAt(PassiveIndex));
+			InvalidateCombinedGameplayTags();
 
-                m_PassivesDirty |= true;
-				break;
-			}
+            m_PassivesDirty |= true;
 		}
 	}
 }
@@ -1653,20 +1975,74 @@ void UAbleAbilityComponent::AddCooldownForAbility(const UAbleAbility& Ability, c
 {
 	if (Ability.GetCooldown(&Context) > 0.0f)
 	{
-		m_ActiveCooldowns.Add(Ability.GetAbilityNameHash(), FAbleAbilityCooldown(Ability, Context));
+		const uint32 AbilityNameHash = Ability.GetAbilityNameHash();
+		ScheduleCooldownExpiry(AbilityNameHash, m_ActiveCooldowns.Add(AbilityNameHash, FAbleAbilityCooldown(Ability, Context, GetCooldownWorldTime())));
 	}
 }
 
 bool UAbleAbilityComponent::IsAbilityOnCooldown(const UAbleAbility* Ability) const
 {
-	return Ability ? m_ActiveCooldowns.Find(Ability->GetAbilityNameHash()) != nullptr : false;
+	if (Ability)
+	{
+		// Compare against the expiry directly, so we're correct even if the Manager hasn't gotten to it yet this frame.
+		if (const FAbleAbilityCooldown* FoundCooldown = m_ActiveCooldowns.Find(Ability->GetAbilityNameHash()))
+		{
+			return !FoundCooldown->IsComplete(GetCooldownWorldTime());
+		}
+	}
+
+	return false;
+}
+
+float UAbleAbilityComponent::GetCooldownWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0f;
+}
+
+void UAbleAbilityComponent::ScheduleCooldownExpiry(uint32 AbilityNameHash, const FAbleAbilityCooldown& Cooldown)
+{
+	if (UAbleCooldownManager* CooldownManager = m_CooldownManager.Get())
+	{
+		CooldownManager->ScheduleCooldown(*this, AbilityNameHash, Cooldown.GetExpiryTime());
+	}
+}
+
+void UAbleAbilityComponent::OnCooldownTimerExpired(uint32 AbilityNameHash, float ExpiryTime, float CurrentTime)
+{
+	FAbleAbilityCooldown* FoundCooldown = m_ActiveCooldowns.Find(AbilityNameHash);
+	if (!FoundCooldown || FoundCooldown->GetExpiryTime() != ExpiryTime)
+	{
+		// Removed or re-scheduled since, the newer timer (if any) will handle it.
+		return;
+	}
+
+	// Uncached Cooldowns are re-evaluated when they come due rather than every frame.
+	if (FoundCooldown->RefreshCooldownTime() && !FoundCooldown->IsComplete(CurrentTime))
+	{
+		ScheduleCooldownExpiry(AbilityNameHash, *FoundCooldown);
+		return;
+	}
+
+	const UAbleAbility* Ability = FoundCooldown->GetAbility();
+	m_ActiveCooldowns.Remove(AbilityNameHash);
+	INC_DWORD_STAT(STAT_AbleCooldownsExpired);
+
+	if (Ability)
+	{
+		m_AbilityCooldownExpiredDelegate.Broadcast(*Ability);
+		AbilityCooldownExpiredBPDelegate.Broadcast(Ability);
+	}
+
+	// Listeners may well have started something.
+	CheckNeedsTick();
 }
 
 bool UAbleAbilityComponent::IsPassiveActive(const UAbleAbility* Ability) const
 {
 	if (Ability && Ability->IsPassive())
 	{
-		return m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(Ability->GetAbilityNameHash())) != nullptr;
+		return m_PassiveAbilityInstances.FindByHash(Ability->GetAbilityNameHash()) != nullptr;
 	}
 
 	return false;
@@ -1691,19 +2067,59 @@ void UAbleAbilityComponent::InternalUpdateAbility(UAbleAbilityInstance* AbilityI
 	}
 }
 
-void UAbleAbilityComponent::UpdateCooldowns(float DeltaTime)
+void UAbleAbilityComponent::UpdateCooldowns()
 {
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("AbleAbilityComponent::UpdateCooldowns"), STAT_AbleAbilityComponent_UpdateCooldowns, STATGROUP_Able);
+	const float CurrentTime = GetCooldownWorldTime();
+	const bool HasCooldownManager = m_CooldownManager.IsValid();
+	TArray<const UAbleAbility*, TInlineAllocator<4>> ExpiredAbilities;
 	for (auto ItUpdate = m_ActiveCooldowns.CreateIterator(); ItUpdate; ++ItUpdate)
 	{
 		FAbleAbilityCooldown& AbilityCooldown = ItUpdate->Value;
+		if (HasCooldownManager && AbilityCooldown.CanCacheCooldownTime())
+		{
+			// Can't change under us, the Manager will tell us when it's done.
+			continue;
+		}
+
+		const bool CooldownChanged = AbilityCooldown.RefreshCooldownTime();
+		if (!AbilityCooldown.IsComplete(CurrentTime))
+		{
+			if (CooldownChanged)
+			{
+				// Any timer we already had is now stale and will be ignored.
+				ScheduleCooldownExpiry(ItUpdate->Key, AbilityCooldown);
+			}
+			continue;
+		}
+
+		if (const UAbleAbility* Ability = AbilityCooldown.GetAbility())
+		{
+			ExpiredAbilities.Add(Ability);
+		}
+		ItUpdate.RemoveCurrent();
+		INC_DWORD_STAT(STAT_AbleCooldownsExpired);
+	}
+
+	// Listeners are free to start (or cooldown) Abilities, so don't let them near m_ActiveCooldowns until we're done iterating it.
+	for (const UAbleAbility* Ability : ExpiredAbilities)
+	{
+		m_AbilityCooldownExpiredDelegate.Broadcast(*Ability);
+		AbilityCooldownExpiredBPDelegate.Broadcast(Ability);
+	}
+}
 
-		AbilityCooldown.Update(DeltaTime);
-		if (AbilityCooldown.IsComplete())
+bool UAbleAbilityComponent::HasUncachedCooldowns() const
+{
+	for (const TPair<uint32, FAbleAbilityCooldown>& Cooldown : m_ActiveCooldowns)
+	{
+		if (!Cooldown.Value.CanCacheCooldownTime())
 		{
-			ItUpdate.RemoveCurrent();
+			return true;
 		}
 	}
+
+	return false;
 }
 
 void UAbleAbilityComponent::HandlePendingContexts()
@@ -1753,8 +2169,9 @@ void UAbleAbilityComponent::HandlePendingContexts()
 
 					HandleInstanceCleanUp(m_ActiveAbilityInstance->GetAbility());
 
-					m_ActiveAbilityInstance->Reset();
+					ReleaseAbilityInstance(m_ActiveAbilityInstance);
 					m_ActiveAbilityInstance = nullptr;
+					InvalidateCombinedGameplayTags();
 					m_ActiveAbilityResult = m_PendingResult[i].GetValue();
 				}
 			}
@@ -1802,28 +2219,31 @@ void UAbleAbilityComponent::HandlePendingCancels()
 			
 			HandleInstanceCleanUp(m_ActiveAbilityInstance->GetAbility());
 
-			m_ActiveAbilityInstance->Reset();
+			ReleaseAbilityInstance(m_ActiveAbilityInstance);
 			m_ActiveAbilityInstance = nullptr;
+			InvalidateCombinedGameplayTags();
 			m_ActiveAbilityResult = CancelContext.GetResult();
 			m_PendingCancelNameHashes.Add(CancelContext.GetNameHash());
 		}
 		else
 		{
-			for (int32 i = 0; i < m_PassiveAbilityInstances.Num(); ++i)
+			const int32 PassiveIndex = m_PassiveAbilityInstances.IndexOfHash(CancelContext.GetNameHash());
+			if (PassiveIndex != INDEX_NONE)
 			{
-				if (m_PassiveAbilityInstances[i] && m_PassiveAbilityInstances[i]->GetAbilityNameHash() == CancelContext.GetNameHash())
+				if (UAbleAbilityInstance* PassiveInstance = m_PassiveAbilityInstances[PassiveIndex])
 				{
-					if (m_PassiveAbilityInstances[i]->IsValid())
+					if (PassiveInstance->IsValid())
 					{
-						m_PassiveAbilityInstances[i]->FinishAbility();
+						PassiveInstance->FinishAbility();
 					}
 
-					HandleInstanceCleanUp(m_PassiveAbilityInstances[i]->GetAbility());
-					m_PassiveAbilityInstances.RemoveAt(i);
-					m_PassivesDirty |= true;
-					m_PendingCancelNameHashes.Add(CancelContext.GetNameHash());
-					break;
+					HandleInstanceCleanUp(PassiveInstance->GetAbility());
 				}
+
+				ReleaseAbilityInstance(m_PassiveAbilityInstances.RemoveAt(PassiveIndex));
+				InvalidateCombinedGameplayTags();
+				m_PassivesDirty |= true;
+				m_PendingCancelNameHashes.Add(CancelContext.GetNameHash());
 			}
 		}
 	}
@@ -1932,6 +2352,45 @@ void UAbleAbilityComponent::HandleInstanceCleanUp(const UAbleAbility& Ability)
 	}*/
 }
 
+UAbleAbilityInstance* UAbleAbilityComponent::AcquireAbilityInstance()
+{
+	if (UAbleAbilityUtilitySubsystem* UtilitySubsystem = Cast<UAbleAbilityUtilitySubsystem>(UMoeGameLibrary::GetGameFeatureSystem(GetWorld(), UAbleAbilityUtilitySubsystem::StaticClass())))
+	{
+		return UtilitySubsystem->FindOrConstructInstance();
+	}
+
+	return NewObject<UAbleAbilityInstance>(this);
+}
+
+void UAbleAbilityComponent::ReleaseAbilityInstance(UAbleAbilityInstance* Instance)
+{
+	if (!Instance)
+	{
+		return;
+	}
+
+	Instance->Reset();
+	m_RetiredInstances.Add(Instance);
+}
+
+void UAbleAbilityComponent::FlushRetiredInstances()
+{
+	if (m_RetiredInstances.Num() == 0)
+	{
+		return;
+	}
+
+	if (UAbleAbilityUtilitySubsystem* UtilitySubsystem = Cast<UAbleAbilityUtilitySubsystem>(UMoeGameLibrary::GetGameFeatureSystem(GetWorld(), UAbleAbilityUtilitySubsystem::StaticClass())))
+	{
+		for (UAbleAbilityInstance* Instance : m_RetiredInstances)
+		{
+			UtilitySubsystem->ReturnInstance(Instance);
+		}
+	}
+
+	m_RetiredInstances.Reset();
+}
+
 void UAbleAbilityComponent::ValidateRemoteRunningAbilities()
 {
 	if (IsOwnerLocallyControlled() || IsAuthoritative())
@@ -1950,8 +2409,9 @@ void UAbleAbilityComponent::ValidateRemoteRunningAbilities()
 	}
 
 	// Validate Passive Abilities.
-	for (const FAbleAbilityNetworkContext& PassiveContext : m_ServerPassiveAbilities)
+	for (const FAbleReplicatedPassiveAbility& ServerPassive : m_ServerPassiveAbilities.Items)
 	{
+		const FAbleAbilityNetworkContext& PassiveContext = ServerPassive.Context;
 		if (PassiveContext.IsValid())
 		{
 			if (!IsPassiveActive(PassiveContext.GetAbility().Get()))
@@ -2081,30 +2541,26 @@ void UAbleAbilityComponent::UpdateServerPassiveAbilities()
 {
 	check(IsAuthoritative()); // Should only be called on the server.
 
-	m_ServerPassiveAbilities.RemoveAll([&](const FAbleAbilityNetworkContext& Passive)
-	{
-		return !Passive.GetAbility().IsValid();
-	});
-
-	TArray<uint32> Whitelist;
+	TArray<uint32, TInlineAllocator<32>> Whitelist;
 	for (const UAbleAbilityInstance* PassiveInstance : m_PassiveAbilityInstances)
 	{
 		if (PassiveInstance && PassiveInstance->IsValid())
 		{
 			Whitelist.Add(PassiveInstance->GetAbilityNameHash());
-			if (FAbleAbilityNetworkContext* ExistingNetworkContext = m_ServerPassiveAbilities.FindByPredicate(FAbleFindAbilityNetworkContextByHash(PassiveInstance->GetAbilityNameHash())))
-			{
-				ExistingNetworkContext->SetCurrentStacks(PassiveInstance->GetStackCount());
-			}
-			else
-			{
-				// New Passive->
-				m_ServerPassiveAbilities.Add(FAbleAbilityNetworkContext(PassiveInstance->GetContext()));
-			}
+			m_ServerPassiveAbilities.AddOrUpdate(PassiveInstance->GetContext(), PassiveInstance->GetStackCount());
 		}
 	}
 
-	m_ServerPassiveAbilities.RemoveAll(FAbleAbilityNetworkContextWhiteList(Whitelist));
+	const int32 NumRemoved = m_ServerPassiveAbilities.Items.RemoveAll([&](const FAbleReplicatedPassiveAbility& Passive)
+	{
+		return !Passive.Context.GetAbility().IsValid() || !Whitelist.Contains(Passive.AbilityNameHash);
+	});
+
+	if (NumRemoved > 0)
+	{
+		m_ServerPassiveAbilities.MarkArrayDirty();
+		INC_DWORD_STAT(STAT_AblePassiveReplicationArraysDirtied);
+	}
 }
 
 void UAbleAbilityComponent::UpdateServerActiveAbility()
@@ -2139,17 +2595,7 @@ void UAbleAbilityComponent::ServerActivateAbility_Implementation(const FAbleAbil
 		}
 		else
 		{
-			int32 StackCount = GetCurrentStackCountForPassiveAbility(Context.GetAbility().Get());
-			if (FAbleAbilityNetworkContext* ExistingContext = m_ServerPassiveAbilities.FindByPredicate(FAbleFindAbilityNetworkContextByHash(Context.GetAbility()->GetAbilityNameHash())))
-			{
-				ExistingContext->SetCurrentStacks(StackCount);
-			}
-			else
-			{
-				FAbleAbilityNetworkContext NewNetworkContext(*LocalContext);
-				NewNetworkContext.SetCurrentStacks(StackCount);
-				m_ServerPassiveAbilities.Add(NewNetworkContext);
-			}
+			m_ServerPassiveAbilities.AddOrUpdate(*LocalContext, GetCurrentStackCountForPassiveAbility(Context.GetAbility().Get()));
 		}
 	}
 }
@@ -2171,10 +2617,10 @@ void UAbleAbilityComponent::ServerCancelAbility_Implementation(uint32 AbilityNam
 	}
 	else
 	{
-		if (UAbleAbilityInstance** PassiveInstance = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(AbilityNameHash)))
+		if (UAbleAbilityInstance* PassiveInstance = m_PassiveAbilityInstances.FindByHash(AbilityNameHash))
 		{
-			Ability = &(*PassiveInstance)->GetAbility();
-			Context = &(*PassiveInstance)->GetContext();
+			Ability = &PassiveInstance->GetAbility();
+			Context = &PassiveInstance->GetContext();
 		}
 	}
 
@@ -2185,6 +2631,7 @@ void UAbleAbilityComponent::ServerCancelAbility_Implementation(uint32 AbilityNam
 		{
 			// Just pass it along.
 			InternalCancelAbility(Ability, ResultToUse);
+			CheckNeedsTick();
 		}
 		else if(m_Settings->GetLogVerbose())
 		{
@@ -2213,6 +2660,7 @@ void UAbleAbilityComponent::ClientForceAbility_Implementation(const FAbleAbility
 	if (GetOwner() && GetOwner()->GetNetMode() == ENetMode::NM_Client)
 	{
 		InternalStartAbility(UAbleAbilityContext::MakeContext(Context), true);
+		CheckNeedsTick();
 	}
 }
 
@@ -2256,42 +2704,64 @@ void UAbleAbilityComponent::OnServerActiveAbilityChanged()
 			InternalCancelAbility(GetActiveAbility(), m_ServerActive.GetResult());
 		}
 	}
+
+	CheckNeedsTick();
 }
 
-void UAbleAbilityComponent::OnServerPassiveAbilitiesChanged()
+void UAbleAbilityComponent::OnServerPassiveAbilityAdded(const FAbleAbilityNetworkContext& ServerPassive)
 {
-	TArray<uint32> ValidAbilityNameHashes;
+	if (!ServerPassive.IsValid() ||
+		!ServerPassive.GetAbility().IsValid() ||
+		!AbilityClientPolicyAllowsExecution(ServerPassive.GetAbility().Get()))
+	{
+		return;
+	}
 
-	m_PassiveAbilityInstances.RemoveAll([&](const UAbleAbilityInstance* Instance)
+	if (UAbleAbilityInstance* CurrentPassive = m_PassiveAbilityInstances.FindByHash(ServerPassive.GetAbility()->GetAbilityNameHash()))
 	{
-		return !IsValid(&Instance->GetAbility());
-	});
-	
-	for (const FAbleAbilityNetworkContext& ServerPassive : m_ServerPassiveAbilities)
+		// Just make sure our stack count is accurate.
+		CurrentPassive->SetStackCount(ServerPassive.GetCurrentStack());
+	}
+	else if (!WasLocallyPredicted(ServerPassive))
 	{
-		if (ServerPassive.IsValid() && 
-			ServerPassive.GetAbility().IsValid() && 
-			AbilityClientPolicyAllowsExecution(ServerPassive.GetAbility().Get()))
-		{
-			if (UAbleAbilityInstance* const * CurrentPassive = m_PassiveAbilityInstances.FindByPredicate(FAbleFindAbilityInstanceByHash(ServerPassive.GetAbility()->GetAbilityNameHash())))
-			{
-				// Just make sure our stack count is accurate.
-				(*CurrentPassive)->SetStackCount(ServerPassive.GetCurrentStack());
-			}
-			else // New Passive Ability
-			{
-				if (!WasLocallyPredicted(ServerPassive))
-				{
-					ActivatePassiveAbility(UAbleAbilityContext::MakeContext(ServerPassive));
-				}
-			}
+		ActivatePassiveAbility(UAbleAbilityContext::MakeContext(ServerPassive));
+	}
 
-			ValidAbilityNameHashes.Add(ServerPassive.GetAbility()->GetAbilityNameHash());
-		}
+	m_PassivesDirty = true;
+	CheckNeedsTick();
+}
+
+void UAbleAbilityComponent::OnServerPassiveAbilityChanged(const FAbleAbilityNetworkContext& ServerPassive)
+{
+	if (!ServerPassive.IsValid() || !ServerPassive.GetAbility().IsValid())
+	{
+		return;
 	}
 
-	m_PassiveAbilityInstances.RemoveAll(FAbleAbilityInstanceWhiteList(ValidAbilityNameHashes));
-    m_PassivesDirty |= true;
+	if (UAbleAbilityInstance* CurrentPassive = m_PassiveAbilityInstances.FindByHash(ServerPassive.GetAbility()->GetAbilityNameHash()))
+	{
+		CurrentPassive->SetStackCount(ServerPassive.GetCurrentStack());
+		m_PassivesDirty = true;
+		CheckNeedsTick();
+	}
+	else
+	{
+		// We missed the add (e.g. the client policy changed), treat it as new.
+		OnServerPassiveAbilityAdded(ServerPassive);
+	}
+}
+
+void UAbleAbilityComponent::OnServerPassiveAbilityRemoved(uint32 AbilityNameHash)
+{
+	const int32 PassiveIndex = m_PassiveAbilityInstances.IndexOfHash(AbilityNameHash);
+	if (PassiveIndex != INDEX_NONE)
+	{
+		// The server finishes its own Passive, we just drop our copy.
+		ReleaseAbilityInstance(m_PassiveAbilityInstances.RemoveAt(PassiveIndex));
+		InvalidateCombinedGameplayTags();
+		m_PassivesDirty = true;
+		CheckNeedsTick();
+	}
 }
 
 /*void UAbleAbilityComponent::OnServerPredictiveKeyChanged()
@@ -2308,8 +2778,9 @@ void UAbleAbilityComponent::PlayAbilityFromEditor(const UAbleAbility* Ability, c
 	if (m_ActiveAbilityInstance)
 	{
 		m_ActiveAbilityInstance->StopAbility();
-		m_ActiveAbilityInstance->Reset();
+		ReleaseAbilityInstance(m_ActiveAbilityInstance);
 		m_ActiveAbilityInstance = nullptr;
+		InvalidateCombinedGameplayTags();
 	}
 
 	if (!Ability)
@@ -2329,13 +2800,14 @@ void UAbleAbilityComponent::PlayAbilityFromEditor(const UAbleAbility* Ability, c
 		FakeContext->GetMutableTargetActors().Add(ForceTarget);
 	}
 
-	UAbleAbilityInstance* NewInstance = NewObject<UAbleAbilityInstance>(this);
+	UAbleAbilityInstance* NewInstance = AcquireAbilityInstance();
 	NewInstance->Initialize(*FakeContext);
 
 	// We've passed all our checks, go ahead and allocate our Task scratch pads.
 	FakeContext->AllocateScratchPads();
 
 	m_ActiveAbilityInstance = NewInstance;
+	InvalidateCombinedGameplayTags();
 
 	CheckNeedsTick();
 }
@@ -2380,41 +2852,37 @@ int UAbleAbilityComponent::GetCurrentSegmentIndex() const
 void UAbleAbilityComponent::AddTag(const FGameplayTag Tag)
 {
 	m_TagContainer.AddTag(Tag);
+	InvalidateCombinedGameplayTags();
 }
 
 void UAbleAbilityComponent::RemoveTag(const FGameplayTag Tag)
 {
 	m_TagContainer.RemoveTag(Tag);
+	InvalidateCombinedGameplayTags();
 }
 
 bool UAbleAbilityComponent::HasTag(const FGameplayTag Tag, bool includeExecutingAbilities) const
 {
-    FGameplayTagContainer CombinedTags;
-    GetCombinedGameplayTags(CombinedTags, includeExecutingAbilities);
-
-    return CombinedTags.HasTag(Tag);
+    FGameplayTagContainer Scratch;
+    return GetCachedCombinedGameplayTags(includeExecutingAbilities, Scratch).HasTag(Tag);
 }
 
 bool UAbleAbilityComponent::MatchesAnyTag(const FGameplayTagContainer Container, bool includeExecutingAbilities) const
 {
-    FGameplayTagContainer CombinedTags;
-    GetCombinedGameplayTags(CombinedTags, includeExecutingAbilities);
-
-    return CombinedTags.HasAny(Container);
+    FGameplayTagContainer Scratch;
+    return GetCachedCombinedGameplayTags(includeExecutingAbilities, Scratch).HasAny(Container);
 }
 
 bool UAbleAbilityComponent::MatchesAllTags(const FGameplayTagContainer Container, bool includeExecutingAbilities) const
 {
-    FGameplayTagContainer CombinedTags;
-    GetCombinedGameplayTags(CombinedTags, includeExecutingAbilities);
-
-    return CombinedTags.HasAll(Container);
+    FGameplayTagContainer Scratch;
+    return GetCachedCombinedGameplayTags(includeExecutingAbilities, Scratch).HasAll(Container);
 }
 
 bool UAbleAbilityComponent::CheckTags(const FGameplayTagContainer& IncludesAny, const FGameplayTagContainer& IncludesAll, const FGameplayTagContainer& ExcludesAny, bool includeExecutingAbilities) const
 {
-    FGameplayTagContainer CombinedTags;
-    GetCombinedGameplayTags(CombinedTags, includeExecutingAbilities);
+    FGameplayTagContainer Scratch;
+    const FGameplayTagContainer& CombinedTags = GetCachedCombinedGameplayTags(includeExecutingAbilities, Scratch);
 
     if (!ExcludesAny.IsEmpty())
     {
@@ -2458,6 +2926,30 @@ void UAbleAbilityComponent::GetCombinedGameplayTags(FGameplayTagContainer& Combi
     }
 }
 
+const FGameplayTagContainer& UAbleAbilityComponent::GetCachedCombinedGameplayTags(bool includeExecutingAbilities, FGameplayTagContainer& Scratch) const
+{
+	if (!includeExecutingAbilities)
+	{
+		return m_TagContainer;
+	}
+
+	if (m_CombinedTagsDirty)
+	{
+		if (!IsInGameThread())
+		{
+			// Don't touch the cache from a worker, just build a copy.
+			GetCombinedGameplayTags(Scratch, true);
+			return Scratch;
+		}
+
+		GetCombinedGameplayTags(m_CombinedTags, true);
+		m_CombinedTagsDirty = false;
+		INC_DWORD_STAT(STAT_AbleCombinedTagRebuilds);
+	}
+
+	return m_CombinedTags;
+}
+
 bool UAbleAbilityComponent::IsAbilityInstancePendingCancel(const UAbleAbilityInstance* AbilityInstance) const
 {
 	if (!AbilityInstance || !AbilityInstance->IsValid() || m_PendingCancels.Num() == 0) return false;
@@ -2471,9 +2963,8 @@ bool UAbleAbilityComponent::IsAbilityInstancePendingCancel(const UAbleAbilityIns
 
 bool UAbleAbilityComponent::MatchesQuery(const FGameplayTagQuery Query, bool includeExecutingAbilities) const
 {
-    FGameplayTagContainer CombinedTags;
-    GetCombinedGameplayTags(CombinedTags, includeExecutingAbilities);
-    return CombinedTags.MatchesQuery(Query);
+    FGameplayTagContainer Scratch;
+    return GetCachedCombinedGameplayTags(includeExecutingAbilities, Scratch).MatchesQuery(Query);
 }
 
 void UAbleAbilityComponent::SetAbilityAnimationNode(const FAnimNode_SPAbilityAnimPlayer* Node)
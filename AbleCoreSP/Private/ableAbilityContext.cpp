@@ -10,11 +10,13 @@
 #include "ableSubSystem.h"
 #include "Components/PrimitiveComponent.h"
 #include "Engine/Engine.h"
+#include "Engine/NetSerialization.h"
 #include "Engine/World.h"
 #include "Misc/ScopeLock.h"
 #include "MoeGameplay/Core/MoeGameLibrary.h"
 #include "Net/UnrealNetwork.h"
 #include "Tasks/IAbleAbilityTask.h"
+#include "UObject/CoreNet.h"
 
 class UGameFeatureSystemManager;
 
@@ -115,6 +117,7 @@ UAbleAbilityContext* UAbleAbilityContext::MakeContext(const UAbleAbility* Abilit
 
 	NewContext->m_Ability = Ability;
 	NewContext->m_AbilityComponent = AbilityComponent;
+	NewContext->InitializeParameterSlots();
 	NewContext->SetRandomSeed(FMath::Rand());
 	NewContext->SetRandomStream(FRandomStream(NewContext->GetRandomSeed()));
 	
@@ -133,7 +136,7 @@ UAbleAbilityContext* UAbleAbilityContext::MakeContext(const UAbleAbility* Abilit
 	const TArray<FAbilitySegmentBranchData>& BranchDataList = Ability->GetBranchData();
 	for (const FAbilitySegmentBranchData& BranchData : BranchDataList)
 	{
-		int32 BranchIndex = Ability->FindSegmentIndexByFName(BranchData.NextName);
+		int32 BranchIndex = Ability->GetBranchSegmentIndex(BranchData);
 		if (BranchIndex < 0)
 			continue;
 		
@@ -161,11 +164,7 @@ UAbleAbilityContext* UAbleAbilityContext::MakeContext(const FAbleAbilityNetworkC
 	}
 	NewContext->GetMutableTargetActors().Append(NetworkContext.GetTargetActors());
 	NewContext->SetTargetLocation(NetworkContext.GetTargetLocation());
-	NewContext->GetMutableIntParameters().Append(NetworkContext.GetIntParameters());
-	NewContext->GetMutableFloatParameters().Append(NetworkContext.GetFloatParameters());
-	NewContext->GetMutableStringParameters().Append(NetworkContext.GetStringParameters());
-	NewContext->GetMutableUObjectParameters().Append(NetworkContext.GetUObjectParameters());
-	NewContext->GetMutableVectorParameters().Append(NetworkContext.GetVectorParameters());
+	NewContext->ImportParameters(NetworkContext.GetIntParameters(), NetworkContext.GetFloatParameters(), NetworkContext.GetStringParameters(), NetworkContext.GetUObjectParameters(), NetworkContext.GetVectorParameters());
 	NewContext->SetAbilityId(NetworkContext.GetAbilityId());
 	NewContext->SetRandomSeed(NetworkContext.GetRandomSeed());
 	NewContext->SetRandomStream(FRandomStream(NewContext->GetRandomSeed()));
@@ -339,38 +338,97 @@ float UAbleAbilityContext::GetCurrentTimeRatio() const
 	return FMath::Clamp(m_CurrentTime / m_Ability->GetLength(m_ActiveSegmentIndex), 0.0f, 1.0f);
 }
 
+namespace AbleContextParameterUtils
+{
+	/* Returns the handle for a declared parameter of the given type, so a type mismatch falls back to the name maps rather than being dropped. */
+	FORCEINLINE FAbleContextParameterHandle FindDeclared(const FAbleContextParameterLayout* Layout, FName Id, EAbleContextParameterType Type)
+	{
+		if (Layout)
+		{
+			const FAbleContextParameterHandle Handle = Layout->Find(Id);
+			if (Handle.IsValid() && Handle.Type == Type)
+			{
+				return Handle;
+			}
+		}
+
+		return FAbleContextParameterHandle();
+	}
+}
+
 void UAbleAbilityContext::SetIntParameter(FName Id, int Value)
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::Int);
+	if (Handle.IsValid())
+	{
+		SetIntParameterByHandle(Handle, Value);
+		return;
+	}
+
 	ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
 	m_IntParameters.Add(Id, Value);
 }
 
 void UAbleAbilityContext::SetFloatParameter(FName Id, float Value)
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::Float);
+	if (Handle.IsValid())
+	{
+		SetFloatParameterByHandle(Handle, Value);
+		return;
+	}
+
 	ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
 	m_FloatParameters.Add(Id, Value);
 }
 
 void UAbleAbilityContext::SetStringParameter(FName Id, const FString& Value)
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::String);
+	if (Handle.IsValid())
+	{
+		SetStringParameterByHandle(Handle, Value);
+		return;
+	}
+
 	ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
 	m_StringParameters.Add(Id, Value);
 }
 
 void UAbleAbilityContext::SetUObjectParameter(FName Id, UObject* Value)
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::UObject);
+	if (Handle.IsValid())
+	{
+		SetUObjectParameterByHandle(Handle, Value);
+		return;
+	}
+
 	ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
 	m_UObjectParameters.Add(Id, Value);
 }
 
 void UAbleAbilityContext::SetVectorParameter(FName Id, FVector Value)
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::Vector);
+	if (Handle.IsValid())
+	{
+		SetVectorParameterByHandle(Handle, Value);
+		return;
+	}
+
 	ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
 	m_VectorParameters.Add(Id, Value);
 }
 
 int UAbleAbilityContext::GetIntParameter(FName Id) const
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::Int);
+	if (Handle.IsValid())
+	{
+		return GetIntParameterByHandle(Handle);
+	}
+
 	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
 	if (const int* var = m_IntParameters.Find(Id))
 	{
@@ -381,6 +439,12 @@ int UAbleAbilityContext::GetIntParameter(FName Id) const
 
 float UAbleAbilityContext::GetFloatParameter(FName Id) const
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::Float);
+	if (Handle.IsValid())
+	{
+		return GetFloatParameterByHandle(Handle);
+	}
+
 	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
 	if (const float* var = m_FloatParameters.Find(Id))
 	{
@@ -391,6 +455,12 @@ float UAbleAbilityContext::GetFloatParameter(FName Id) const
 
 UObject* UAbleAbilityContext::GetUObjectParameter(FName Id) const
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::UObject);
+	if (Handle.IsValid())
+	{
+		return GetUObjectParameterByHandle(Handle);
+	}
+
 	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
 	if (m_UObjectParameters.Contains(Id)) // Find is being weird with double ptr.
 	{
@@ -401,6 +471,12 @@ UObject* UAbleAbilityContext::GetUObjectParameter(FName Id) const
 
 FVector UAbleAbilityContext::GetVectorParameter(FName Id) const
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::Vector);
+	if (Handle.IsValid())
+	{
+		return GetVectorParameterByHandle(Handle);
+	}
+
 	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
 	if (const FVector* var = m_VectorParameters.Find(Id))
 	{
@@ -411,6 +487,12 @@ FVector UAbleAbilityContext::GetVectorParameter(FName Id) const
 
 const FString& UAbleAbilityContext::GetStringParameter(FName Id) const
 {
+	const FAbleContextParameterHandle Handle = AbleContextParameterUtils::FindDeclared(m_ParameterLayout, Id, EAbleContextParameterType::String);
+	if (Handle.IsValid())
+	{
+		return GetStringParameterByHandle(Handle);
+	}
+
 	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
 	if (const FString* var = m_StringParameters.Find(Id))
 	{
@@ -420,6 +502,138 @@ const FString& UAbleAbilityContext::GetStringParameter(FName Id) const
 	return EmptyString;
 }
 
+FAbleContextParameterHandle UAbleAbilityContext::FindParameterHandle(FName Id) const
+{
+	return m_ParameterLayout ? m_ParameterLayout->Find(Id) : FAbleContextParameterHandle();
+}
+
+void UAbleAbilityContext::SetIntParameterByHandle(const FAbleContextParameterHandle& Handle, int Value)
+{
+	if (int32* Slot = GetParameterBlockValue<int32>(Handle, EAbleContextParameterType::Int))
+	{
+		ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
+		*Slot = Value;
+	}
+}
+
+void UAbleAbilityContext::SetFloatParameterByHandle(const FAbleContextParameterHandle& Handle, float Value)
+{
+	if (float* Slot = GetParameterBlockValue<float>(Handle, EAbleContextParameterType::Float))
+	{
+		ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
+		*Slot = Value;
+	}
+}
+
+void UAbleAbilityContext::SetStringParameterByHandle(const FAbleContextParameterHandle& Handle, const FString& Value)
+{
+	if (Handle.Type == EAbleContextParameterType::String && m_StringSlots.IsValidIndex(Handle.Slot))
+	{
+		ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
+		m_StringSlots[Handle.Slot] = Value;
+	}
+}
+
+void UAbleAbilityContext::SetUObjectParameterByHandle(const FAbleContextParameterHandle& Handle, UObject* Value)
+{
+	if (Handle.Type == EAbleContextParameterType::UObject && m_UObjectSlots.IsValidIndex(Handle.Slot))
+	{
+		ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
+		m_UObjectSlots[Handle.Slot] = Value;
+	}
+}
+
+void UAbleAbilityContext::SetVectorParameterByHandle(const FAbleContextParameterHandle& Handle, FVector Value)
+{
+	if (FVector* Slot = GetParameterBlockValue<FVector>(Handle, EAbleContextParameterType::Vector))
+	{
+		ABLE_RWLOCK_SCOPE_WRITE(m_ContextVariablesLock);
+		*Slot = Value;
+	}
+}
+
+int UAbleAbilityContext::GetIntParameterByHandle(const FAbleContextParameterHandle& Handle) const
+{
+	const int32* Slot = GetParameterBlockValue<int32>(Handle, EAbleContextParameterType::Int);
+	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
+	return Slot ? *Slot : 0;
+}
+
+float UAbleAbilityContext::GetFloatParameterByHandle(const FAbleContextParameterHandle& Handle) const
+{
+	const float* Slot = GetParameterBlockValue<float>(Handle, EAbleContextParameterType::Float);
+	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
+	return Slot ? *Slot : 0.0f;
+}
+
+const FString& UAbleAbilityContext::GetStringParameterByHandle(const FAbleContextParameterHandle& Handle) const
+{
+	if (Handle.Type == EAbleContextParameterType::String && m_StringSlots.IsValidIndex(Handle.Slot))
+	{
+		ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
+		return m_StringSlots[Handle.Slot];
+	}
+	static FString EmptyString;
+	return EmptyString;
+}
+
+UObject* UAbleAbilityContext::GetUObjectParameterByHandle(const FAbleContextParameterHandle& Handle) const
+{
+	if (Handle.Type == EAbleContextParameterType::UObject && m_UObjectSlots.IsValidIndex(Handle.Slot))
+	{
+		ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
+		return m_UObjectSlots[Handle.Slot];
+	}
+	return nullptr;
+}
+
+FVector UAbleAbilityContext::GetVectorParameterByHandle(const FAbleContextParameterHandle& Handle) const
+{
+	const FVector* Slot = GetParameterBlockValue<FVector>(Handle, EAbleContextParameterType::Vector);
+	ABLE_RWLOCK_SCOPE_READ(m_ContextVariablesLock);
+	return Slot ? *Slot : FVector::ZeroVector;
+}
+
+void UAbleAbilityContext::ExportDeclaredParameters(TMap<FName, int>& OutInts, TMap<FName, float>& OutFloats, TMap<FName, FString>& OutStrings, TMap<FName, UObject*>& OutUObjects, TMap<FName, FVector>& OutVectors) const
+{
+	if (!m_ParameterLayout)
+	{
+		return;
+	}
+
+	for (const TPair<FName, FAbleContextParameterHandle>& Entry : m_ParameterLayout->Handles)
+	{
+		switch (Entry.Value.Type)
+		{
+		case EAbleContextParameterType::Int: OutInts.Add(Entry.Key, GetIntParameterByHandle(Entry.Value)); break;
+		case EAbleContextParameterType::Float: OutFloats.Add(Entry.Key, GetFloatParameterByHandle(Entry.Value)); break;
+		case EAbleContextParameterType::String: OutStrings.Add(Entry.Key, GetStringParameterByHandle(Entry.Value)); break;
+		case EAbleContextParameterType::UObject: OutUObjects.Add(Entry.Key, GetUObjectParameterByHandle(Entry.Value)); break;
+		case EAbleContextParameterType::Vector: OutVectors.Add(Entry.Key, GetVectorParameterByHandle(Entry.Value)); break;
+		default: break;
+		}
+	}
+}
+
+void UAbleAbilityContext::ImportParameters(const TMap<FName, int>& Ints, const TMap<FName, float>& Floats, const TMap<FName, FString>& Strings, const TMap<FName, UObject*>& UObjects, const TMap<FName, FVector>& Vectors)
+{
+	for (const TPair<FName, int>& Entry : Ints) { SetIntParameter(Entry.Key, Entry.Value); }
+	for (const TPair<FName, float>& Entry : Floats) { SetFloatParameter(Entry.Key, Entry.Value); }
+	for (const TPair<FName, FString>& Entry : Strings) { SetStringParameter(Entry.Key, Entry.Value); }
+	for (const TPair<FName, UObject*>& Entry : UObjects) { SetUObjectParameter(Entry.Key, Entry.Value); }
+	for (const TPair<FName, FVector>& Entry : Vectors) { SetVectorParameter(Entry.Key, Entry.Value); }
+}
+
+void UAbleAbilityContext::InitializeParameterSlots()
+{
+	m_ParameterLayout = m_Ability ? &m_Ability->GetContextParameterLayout() : nullptr;
+
+	// Reset leaves everything zeroed, so we only need to size things (without giving any memory back).
+	m_ParameterBlock.SetNumZeroed(m_ParameterLayout ? m_ParameterLayout->BlockSize : 0, false);
+	m_StringSlots.SetNum(m_ParameterLayout ? m_ParameterLayout->NumStrings : 0, false);
+	m_UObjectSlots.SetNumZeroed(m_ParameterLayout ? m_ParameterLayout->NumObjects : 0, false);
+}
+
 void UAbleAbilityContext::SetActiveSegmentIndex(const uint8 ActiveSegmentIndex)
 {
 	if (m_ActiveSegmentIndex != ActiveSegmentIndex)
@@ -462,19 +676,32 @@ void UAbleAbilityContext::Reset()
 	m_SegmentLoopIteration = 0;
 	m_Owner.Reset();
 	m_Instigator.Reset();
-	m_TargetActors.Empty();
-	m_TaskScratchPadMap.Empty();
+
+	// Pooled Contexts are reused constantly, so clear our containers but keep their allocations around for the next Ability.
+	m_TargetActors.Reset();
+	m_TaskScratchPadMap.Reset();
 	m_AbilityScratchPad = nullptr;
 	m_AsyncHandle._Handle = 0;
 	m_AsyncQueryTransform = FTransform::Identity;
+	ClearPendingTargetFilter();
+	m_BlockingTargetFilters = false;
 	m_TargetLocation = FVector::ZeroVector;
 	m_PredictionKey = 0;
-	m_IntParameters.Empty();
-	m_FloatParameters.Empty();
-	m_StringParameters.Empty();
-	m_UObjectParameters.Empty();
-	m_VectorParameters.Empty();
-	m_HistorySegments.Empty();
+	m_IntParameters.Reset();
+	m_FloatParameters.Reset();
+	m_StringParameters.Reset();
+	m_UObjectParameters.Reset();
+	m_VectorParameters.Reset();
+	m_HistorySegments.Reset();
+
+	// Declared parameters just get zeroed, the next Ability will size them as needed.
+	m_ParameterLayout = nullptr;
+	FMemory::Memzero(m_ParameterBlock.GetData(), m_ParameterBlock.Num());
+	for (FString& StringSlot : m_StringSlots)
+	{
+		StringSlot.Reset();
+	}
+	FMemory::Memzero(m_UObjectSlots.GetData(), m_UObjectSlots.Num() * sizeof(UObject*));
 	m_TargetActorLocationSnap = FVector::ZeroVector;
 	m_TargetActorRotationSnap = FRotator::ZeroRotator;
 	AbilityUniqueID = 0;
@@ -588,6 +815,8 @@ FAbleAbilityNetworkContext::FAbleAbilityNetworkContext(const UAbleAbilityContext
       m_HighPingPawns(Context.GetHighPingPawns()),
 	  m_AbilityUniqueID(Context.GetAbilityUniqueID())
 {
+	Context.ExportDeclaredParameters(m_IntParameters, m_FloatParameters, m_StringParameters, m_UObjectParameters, m_VectorParameters);
+
 	if (GEngine && GEngine->GetWorld())
 	{
 		m_TimeStamp = GEngine->GetWorld()->GetRealTimeSeconds();
@@ -626,6 +855,8 @@ FAbleAbilityNetworkContext::FAbleAbilityNetworkContext(const UAbleAbilityContext
       m_HighPingPawns(Context.GetHighPingPawns()),
 	  m_AbilityUniqueID(Context.GetAbilityUniqueID())
 {
+	Context.ExportDeclaredParameters(m_IntParameters, m_FloatParameters, m_StringParameters, m_UObjectParameters, m_VectorParameters);
+
 	if (GEngine && GEngine->GetWorld())
 	{
 		m_TimeStamp = GEngine->GetWorld()->GetRealTimeSeconds();
@@ -678,3 +909,429 @@ FAbleAbilityNetworkContext FAbleAbilityNetworkContext::UpdateNetworkContext(
 	
 	return newContext;
 }
+
+namespace AbleNetworkContextUtils
+{
+	/* Presence bits, so anything empty/default costs a single bit. */
+	enum ENetworkContextFlags : uint16
+	{
+		HasAbilityComponent = 1 << 0,
+		HasOwner = 1 << 1,
+		HasInstigator = 1 << 2,
+		InstigatorIsOwner = 1 << 3,
+		HasTargetActors = 1 << 4,
+		HasTargetLocation = 1 << 5,
+		HasPredictionKey = 1 << 6,
+		HasLocationSnap = 1 << 7,
+		HasRotationSnap = 1 << 8,
+		HasHighPingPawns = 1 << 9,
+		HasParameters = 1 << 10,
+
+		NumFlags = 11
+	};
+
+	/* Upper bounds we'll accept when reading, so a bad packet can't make us allocate a huge array. */
+	static const uint32 MaxTargetActors = 1024U;
+	static const uint32 MaxHighPingPawns = 256U;
+	static const uint32 MaxParameters = 256U;
+
+	template <typename T>
+	FORCEINLINE void SerializeWeakObject(FArchive& Ar, UPackageMap* Map, TWeakObjectPtr<T>& Object)
+	{
+		UObject* RawObject = Ar.IsSaving() ? const_cast<UObject*>(static_cast<const UObject*>(Object.Get())) : nullptr;
+		Map->SerializeObject(Ar, UObject::StaticClass(), RawObject);
+		if (Ar.IsLoading())
+		{
+			Object = Cast<T>(RawObject);
+		}
+	}
+
+	/* Most of our ints are small and positive. */
+	FORCEINLINE void SerializePackedInt(FArchive& Ar, int32& Value)
+	{
+		uint32 PackedValue = static_cast<uint32>(Value);
+		Ar.SerializeIntPacked(PackedValue);
+		Value = static_cast<int32>(PackedValue);
+	}
+
+	/* Parameters can be negative, so zig-zag them first. */
+	FORCEINLINE void SerializePackedSignedInt(FArchive& Ar, int32& Value)
+	{
+		uint32 PackedValue = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+		Ar.SerializeIntPacked(PackedValue);
+		Value = static_cast<int32>(PackedValue >> 1) ^ -static_cast<int32>(PackedValue & 1U);
+	}
+}
+
+bool FAbleAbilityNetworkContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace AbleNetworkContextUtils;
+
+	bOutSuccess = true;
+	if (!Map)
+	{
+		bOutSuccess = false;
+		return true;
+	}
+
+	uint16 Flags = 0;
+	if (Ar.IsSaving())
+	{
+		Flags |= m_AbilityComponent.IsValid() ? HasAbilityComponent : 0;
+		Flags |= m_Owner.IsValid() ? HasOwner : 0;
+		if (m_Instigator.IsValid())
+		{
+			Flags |= m_Instigator == m_Owner ? InstigatorIsOwner : HasInstigator;
+		}
+		Flags |= m_TargetActors.Num() ? HasTargetActors : 0;
+		Flags |= !m_TargetLocation.IsZero() ? HasTargetLocation : 0;
+		Flags |= m_PredictionKey != 0 ? HasPredictionKey : 0;
+		Flags |= !m_TargetActorLocationSnap.IsZero() ? HasLocationSnap : 0;
+		Flags |= !m_TargetActorRotationSnap.IsZero() ? HasRotationSnap : 0;
+		Flags |= m_HighPingPawns.Num() ? HasHighPingPawns : 0;
+		const bool AnyParameters = m_IntParameters.Num() || m_FloatParameters.Num() || m_StringParameters.Num() || m_UObjectParameters.Num() || m_VectorParameters.Num();
+		Flags |= m_Ability.IsValid() && AnyParameters ? HasParameters : 0;
+	}
+	Ar.SerializeBits(&Flags, NumFlags);
+
+	// Abilities are assets, so after the first send this is just a packed NetGUID.
+	SerializeWeakObject(Ar, Map, m_Ability);
+
+	if (Flags & HasAbilityComponent)
+	{
+		SerializeWeakObject(Ar, Map, m_AbilityComponent);
+	}
+	else if (Ar.IsLoading())
+	{
+		m_AbilityComponent.Reset();
+	}
+
+	if (Flags & HasOwner)
+	{
+		SerializeWeakObject(Ar, Map, m_Owner);
+	}
+	else if (Ar.IsLoading())
+	{
+		m_Owner.Reset();
+	}
+
+	if (Flags & HasInstigator)
+	{
+		SerializeWeakObject(Ar, Map, m_Instigator);
+	}
+	else if (Ar.IsLoading())
+	{
+		m_Instigator = (Flags & InstigatorIsOwner) ? m_Owner : nullptr;
+	}
+
+	if (Flags & HasTargetActors)
+	{
+		uint32 NumTargets = m_TargetActors.Num();
+		Ar.SerializeIntPacked(NumTargets);
+		if (Ar.IsLoading())
+		{
+			if (NumTargets > MaxTargetActors)
+			{
+				bOutSuccess = false;
+				return true;
+			}
+			m_TargetActors.SetNum(NumTargets);
+		}
+
+		for (TWeakObjectPtr<AActor>& TargetActor : m_TargetActors)
+		{
+			SerializeWeakObject(Ar, Map, TargetActor);
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		m_TargetActors.Reset();
+	}
+
+	uint8 CurrentStacks = static_cast<uint8>(m_CurrentStacks);
+	Ar << CurrentStacks;
+	m_CurrentStacks = static_cast<int8>(CurrentStacks);
+
+	Ar << m_TimeStamp;
+
+	uint8 Result = m_Result.GetValue();
+	Ar << Result;
+	m_Result = static_cast<EAbleAbilityTaskResult>(Result);
+
+	if (Flags & HasTargetLocation)
+	{
+		SerializePackedVector<10, 24>(m_TargetLocation, Ar);
+	}
+	else if (Ar.IsLoading())
+	{
+		m_TargetLocation = FVector::ZeroVector;
+	}
+
+	if (Flags & HasPredictionKey)
+	{
+		Ar << m_PredictionKey;
+	}
+	else if (Ar.IsLoading())
+	{
+		m_PredictionKey = 0;
+	}
+
+	SerializePackedInt(Ar, m_AbilityId);
+	Ar << m_RandomSeed;
+	SerializePackedInt(Ar, m_SegmentIndex);
+	SerializePackedInt(Ar, m_AbilityUniqueID);
+
+	if (Flags & HasLocationSnap)
+	{
+		SerializePackedVector<10, 24>(m_TargetActorLocationSnap, Ar);
+	}
+	else if (Ar.IsLoading())
+	{
+		m_TargetActorLocationSnap = FVector::ZeroVector;
+	}
+
+	if (Flags & HasRotationSnap)
+	{
+		m_TargetActorRotationSnap.SerializeCompressedShort(Ar);
+	}
+	else if (Ar.IsLoading())
+	{
+		m_TargetActorRotationSnap = FRotator::ZeroRotator;
+	}
+
+	if (Flags & HasHighPingPawns)
+	{
+		uint32 NumPawns = m_HighPingPawns.Num();
+		Ar.SerializeIntPacked(NumPawns);
+		if (Ar.IsLoading())
+		{
+			if (NumPawns > MaxHighPingPawns)
+			{
+				bOutSuccess = false;
+				return true;
+			}
+			m_HighPingPawns.SetNum(NumPawns);
+		}
+
+		for (int64& PawnId : m_HighPingPawns)
+		{
+			Ar << PawnId;
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		m_HighPingPawns.Reset();
+	}
+
+	if (Ar.IsLoading())
+	{
+		m_IntParameters.Reset();
+		m_FloatParameters.Reset();
+		m_StringParameters.Reset();
+		m_UObjectParameters.Reset();
+		m_VectorParameters.Reset();
+	}
+
+	if (Flags & HasParameters)
+	{
+		NetSerializeParameters(Ar, Map, bOutSuccess);
+	}
+
+	return true;
+}
+
+void FAbleAbilityNetworkContext::NetSerializeParameters(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace AbleNetworkContextUtils;
+
+	// Declared Network Relevant parameters are sent as (declaration index, type, value). The type goes along so we can still read the stream if the Ability didn't resolve on this end.
+	// Anything that was never declared follows by name, behind a presence bit. Only parameters declared without Network Relevant stay local.
+	const FAbleContextParameterLayout* Layout = m_Ability.IsValid() ? &m_Ability->GetContextParameterLayout() : nullptr;
+	const TArray<FAbleContextParameterDeclaration>* NetworkRelevant = Layout ? &Layout->NetworkRelevant : nullptr;
+
+	if (Ar.IsSaving())
+	{
+		check(NetworkRelevant);
+
+		TArray<int32, TInlineAllocator<16>> PresentIndices;
+		for (int32 DeclarationIndex = 0; DeclarationIndex < NetworkRelevant->Num(); ++DeclarationIndex)
+		{
+			const FAbleContextParameterDeclaration& Declaration = (*NetworkRelevant)[DeclarationIndex];
+			if (HasParameter(Declaration.Type, Declaration.Name))
+			{
+				PresentIndices.Add(DeclarationIndex);
+			}
+		}
+
+		uint32 NumParameters = PresentIndices.Num();
+		Ar.SerializeIntPacked(NumParameters);
+
+		for (int32 DeclarationIndex : PresentIndices)
+		{
+			const FAbleContextParameterDeclaration& Declaration = (*NetworkRelevant)[DeclarationIndex];
+			uint32 PackedIndex = DeclarationIndex;
+			uint8 Type = static_cast<uint8>(Declaration.Type);
+			Ar.SerializeIntPacked(PackedIndex);
+			Ar.SerializeBits(&Type, 3);
+			NetSerializeParameterValue(Ar, Map, Declaration.Type, Declaration.Name);
+		}
+
+		TArray<TPair<FName, EAbleContextParameterType>, TInlineAllocator<16>> Undeclared;
+		auto GatherUndeclared = [Layout, &Undeclared](const auto& Parameters, EAbleContextParameterType Type)
+		{
+			for (const auto& Entry : Parameters)
+			{
+				if (!Layout->Handles.Contains(Entry.Key))
+				{
+					Undeclared.Emplace(Entry.Key, Type);
+				}
+			}
+		};
+		GatherUndeclared(m_IntParameters, EAbleContextParameterType::Int);
+		GatherUndeclared(m_FloatParameters, EAbleContextParameterType::Float);
+		GatherUndeclared(m_StringParameters, EAbleContextParameterType::String);
+		GatherUndeclared(m_UObjectParameters, EAbleContextParameterType::UObject);
+		GatherUndeclared(m_VectorParameters, EAbleContextParameterType::Vector);
+
+		uint8 HasUndeclared = Undeclared.Num() ? 1 : 0;
+		Ar.SerializeBits(&HasUndeclared, 1);
+		if (HasUndeclared)
+		{
+			uint32 NumUndeclared = Undeclared.Num();
+			Ar.SerializeIntPacked(NumUndeclared);
+
+			for (TPair<FName, EAbleContextParameterType>& Entry : Undeclared)
+			{
+				uint8 Type = static_cast<uint8>(Entry.Value);
+				UPackageMap::StaticSerializeName(Ar, Entry.Key);
+				Ar.SerializeBits(&Type, 3);
+				NetSerializeParameterValue(Ar, Map, Entry.Value, Entry.Key);
+			}
+		}
+
+		return;
+	}
+
+	uint32 NumParameters = 0;
+	Ar.SerializeIntPacked(NumParameters);
+	if (NumParameters > MaxParameters)
+	{
+		bOutSuccess = false;
+		return;
+	}
+
+	for (uint32 i = 0; i < NumParameters && !Ar.IsError(); ++i)
+	{
+		uint32 DeclarationIndex = 0;
+		uint8 Type = 0;
+		Ar.SerializeIntPacked(DeclarationIndex);
+		Ar.SerializeBits(&Type, 3);
+
+		// If we can't match it to a declaration of the same type, read it and drop it.
+		const FAbleContextParameterDeclaration* Declaration = NetworkRelevant && NetworkRelevant->IsValidIndex(DeclarationIndex) ? &(*NetworkRelevant)[DeclarationIndex] : nullptr;
+		if (Declaration && static_cast<uint8>(Declaration->Type) != Type)
+		{
+			Declaration = nullptr;
+		}
+
+		if (!NetSerializeParameterValue(Ar, Map, static_cast<EAbleContextParameterType>(Type), Declaration ? Declaration->Name : NAME_None))
+		{
+			// Unknown type, we can't stay in sync with the stream.
+			bOutSuccess = false;
+			return;
+		}
+	}
+
+	uint8 HasUndeclared = 0;
+	Ar.SerializeBits(&HasUndeclared, 1);
+	if (!HasUndeclared)
+	{
+		return;
+	}
+
+	uint32 NumUndeclared = 0;
+	Ar.SerializeIntPacked(NumUndeclared);
+	if (NumUndeclared > MaxParameters)
+	{
+		bOutSuccess = false;
+		return;
+	}
+
+	for (uint32 i = 0; i < NumUndeclared && !Ar.IsError(); ++i)
+	{
+		FName Name;
+		uint8 Type = 0;
+		UPackageMap::StaticSerializeName(Ar, Name);
+		Ar.SerializeBits(&Type, 3);
+
+		if (!NetSerializeParameterValue(Ar, Map, static_cast<EAbleContextParameterType>(Type), Name))
+		{
+			bOutSuccess = false;
+			return;
+		}
+	}
+}
+
+bool FAbleAbilityNetworkContext::HasParameter(EAbleContextParameterType Type, FName Name) const
+{
+	switch (Type)
+	{
+	case EAbleContextParameterType::Int: return m_IntParameters.Contains(Name);
+	case EAbleContextParameterType::Float: return m_FloatParameters.Contains(Name);
+	case EAbleContextParameterType::String: return m_StringParameters.Contains(Name);
+	case EAbleContextParameterType::UObject: return m_UObjectParameters.Contains(Name);
+	case EAbleContextParameterType::Vector: return m_VectorParameters.Contains(Name);
+	default: return false;
+	}
+}
+
+bool FAbleAbilityNetworkContext::NetSerializeParameterValue(FArchive& Ar, UPackageMap* Map, EAbleContextParameterType Type, FName Name)
+{
+	using namespace AbleNetworkContextUtils;
+
+	// When saving, Name is always present in the map for Type. When loading, a None Name means read the value and drop it.
+	const bool Saving = Ar.IsSaving();
+	switch (Type)
+	{
+	case EAbleContextParameterType::Int:
+	{
+		int32 Value = Saving ? m_IntParameters[Name] : 0;
+		SerializePackedSignedInt(Ar, Value);
+		if (!Saving && Name != NAME_None) { m_IntParameters.Add(Name, Value); }
+	}
+	break;
+	case EAbleContextParameterType::Float:
+	{
+		float Value = Saving ? m_FloatParameters[Name] : 0.0f;
+		Ar << Value;
+		if (!Saving && Name != NAME_None) { m_FloatParameters.Add(Name, Value); }
+	}
+	break;
+	case EAbleContextParameterType::String:
+	{
+		FString Value = Saving ? m_StringParameters[Name] : FString();
+		Ar << Value;
+		if (!Saving && Name != NAME_None) { m_StringParameters.Add(Name, MoveTemp(Value)); }
+	}
+	break;
+	case EAbleContextParameterType::UObject:
+	{
+		UObject* Value = Saving ? m_UObjectParameters[Name] : nullptr;
+		Map->SerializeObject(Ar, UObject::StaticClass(), Value);
+		if (!Saving && Name != NAME_None) { m_UObjectParameters.Add(Name, Value); }
+	}
+	break;
+	case EAbleContextParameterType::Vector:
+	{
+		// Parameters can hold anything (directions, scales, offsets), so these go at full precision.
+		FVector Value = Saving ? m_VectorParameters[Name] : FVector::ZeroVector;
+		Ar << Value;
+		if (!Saving && Name != NAME_None) { m_VectorParameters.Add(Name, Value); }
+	}
+	break;
+	default:
+		return false;
+	}
+
+	return true;
+}
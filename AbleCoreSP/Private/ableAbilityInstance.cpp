@@ -16,6 +16,8 @@
 #include "Logging/TokenizedMessage.h"
 #include "Misc/ScopeLock.h"
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Task Start Checks"), STAT_AbleAbilityInstance_TaskStartChecks, STATGROUP_Able);
+
 struct FAbleAbilityTaskIsDonePredicate
 {
 	FAbleAbilityTaskIsDonePredicate(float InCurrentTime)
@@ -48,6 +50,9 @@ void UAbleAbilityInstance::Initialize(UAbleAbilityContext& AbilityContext)
 	m_Ability->PreExecutionInit();
 	m_Context = &AbilityContext;
 
+	// Size everything for the busiest Segment up front. Pooled Instances usually have the room already, so this is normally free.
+	ReserveForAbility(*m_Ability);
+
 	ENetMode NetMode = NM_Standalone;
 	if (AbilityContext.GetSelfActor())
 	{
@@ -182,7 +187,15 @@ void UAbleAbilityInstance::ResetTargetingForIteration(const bool Called) const
 		{
 			UE_LOG(LogAbleSP, Log, TEXT("[SPAbility] ability [%d] segment [%d] ResetTargetingForIteration"), m_Context->GetAbilityId(), GetActiveSegmentIndex())
 			m_Context->ClearTargetActors();
+
+			// We're mid-Ability, so we can't wait a frame on any filters. Tell them up front so they don't issue async work we'd only redo.
+			m_Context->SetTargetFiltersBlocking(true);
 			m_Targeting->FindTargets(*m_Context);
+			if (m_Context->HasPendingTargetFilter())
+			{
+				m_Targeting->ResumeFilterTargets(*m_Context, true);
+			}
+			m_Context->SetTargetFiltersBlocking(false);
 		}
 	}
 }
@@ -225,8 +238,15 @@ void UAbleAbilityInstance::ResetForNextIteration()
 
 			// Sort our Tasks into Sync/Async queues (again, people apparently want to dynamically turn on/off tasks).
 			m_SyncTasks.Empty(m_SyncTasks.Num());
+			m_SyncTaskAdditionInfo.Empty(m_SyncTaskAdditionInfo.Num());
+
+			ENetMode NetMode = NM_Standalone;
+			if (m_Context->GetSelfActor())
+			{
+				NetMode = m_Context->GetSelfActor()->GetNetMode();
+			}
 
-			const TArray<UAbleAbilityTask*>& Tasks = m_Ability->GetTasks(m_ActiveSegmentIndex);
+			const TArray<UAbleAbilityTask*>& Tasks = m_Ability->GetTaskTimeline(m_ActiveSegmentIndex);
 			for (UAbleAbilityTask* Task : Tasks)
 			{
 				if (!Task || Task->IsDisabled())
@@ -234,20 +254,17 @@ void UAbleAbilityInstance::ResetForNextIteration()
 					continue;
 				}
 
-				ENetMode NetMode = NM_Standalone;
-				if (m_Context->GetSelfActor())
-				{
-					NetMode = m_Context->GetSelfActor()->GetNetMode();
-				}
-
 				if (Task->IsValidForNetMode(NetMode, m_Context->GetSelfActor(), m_Context))
 				{
 					if (!m_ActiveSyncTasks.Contains(Task))
 					{
 						m_SyncTasks.Add(Task);
+						m_SyncTaskAdditionInfo.Add(FSyncTaskAdditionInfo{ true });
 					}
 				}
 			}
+
+			ResetSyncTaskCursor();
 		}
 	}
 	else
@@ -276,14 +293,14 @@ bool UAbleAbilityInstance::IsIterationDone() const
 	{
 		if (m_Ability->SegmentMustFinishAllTasks(m_ActiveSegmentIndex))
 		{
-			return m_ActiveSyncTasks.Num() == 0 && m_SyncTasks.Num() <= 0;
+			return m_ActiveSyncTasks.Num() == 0 && GetNumPendingSyncTasks() <= 0;
 		}
 
 		return true;
 	}
 	else if (m_Ability->SegmentMustFinishAllTasks(m_ActiveSegmentIndex))
 	{
-		return m_ActiveSyncTasks.Num() == 0 && m_SyncTasks.Num() <= 0;
+		return m_ActiveSyncTasks.Num() == 0 && GetNumPendingSyncTasks() <= 0;
 	}
 	else if (m_Ability->IsSegmentLooping(m_ActiveSegmentIndex) && m_Context->GetCurrentSegmentLoopIteration() != 0)
 	{
@@ -433,13 +450,38 @@ void UAbleAbilityInstance::SyncUpdate(float DeltaTime)
 	const float CurrentTime = m_Context->GetCurrentTime();
 	const float AdjustedTime = CurrentTime + DeltaTime;
 
-	InternalUpdateTasks(m_SyncTasks, m_ActiveSyncTasks, m_FinishedSyncTasks, CurrentTime, DeltaTime);
+	InternalUpdateTasks(m_ActiveSyncTasks, m_FinishedSyncTasks, CurrentTime, DeltaTime);
 
 	m_Context->UpdateTime(DeltaTime);
 
     m_DecayTime += DeltaTime;
 }
 
+void UAbleAbilityInstance::GatherThreadSafeTasks(float DeltaTime, TArray<FAbleThreadSafeTaskTick>& OutTasks) const
+{
+	// Instances that are still waiting on their dependencies don't update at all, so they don't get a worker tick either.
+	if (!IsValid() || !IsPendingPassed())
+	{
+		return;
+	}
+
+	for (const UAbleAbilityTask* Task : m_ActiveSyncTasks)
+	{
+		if (Task && Task->HasThreadSafeTick() && Task->NeedsTick())
+		{
+			OutTasks.Add(FAbleThreadSafeTaskTick{ Task, m_Context, DeltaTime });
+		}
+	}
+
+	for (const UAbleAbilityTask* Task : m_ActiveAcrossTasks)
+	{
+		if (Task && Task->HasThreadSafeTick() && Task->NeedsTick())
+		{
+			OutTasks.Add(FAbleThreadSafeTaskTick{ Task, m_Context, DeltaTime });
+		}
+	}
+}
+
 void UAbleAbilityInstance::SetStackCount(int32 TotalStacks)
 {
 	check(m_Context != nullptr);
@@ -707,7 +749,7 @@ void UAbleAbilityInstance::SetCurrentTime(const float NewTime, const bool FromPr
 	TArray<UAbleAbilityTask*> NewTasks;
 	TArray<UAbleAbilityTask*> CurrentTasks;
 
-	const TArray<UAbleAbilityTask*> & Tasks = m_Ability->GetTasks(m_ActiveSegmentIndex);
+	const TArray<UAbleAbilityTask*>& Tasks = m_Ability->GetTaskTimeline(m_ActiveSegmentIndex);
 	for (UAbleAbilityTask* Task : Tasks)
 	{
 		if (Task && Task->CanStart(m_Context, NewTime, 0.0f ) && !Task->IsDisabled() && !Task->IsAcrossSegment())
@@ -782,11 +824,10 @@ void UAbleAbilityInstance::SetActiveSegmentIndex(int Index)
 		NetMode = m_Context->GetSelfActor()->GetNetMode();
 	}
 	// Sort our Tasks into Sync/Async queues.
-	m_SyncTasks.Empty();
-	m_SyncTaskAdditionInfo.Empty();
+	m_SyncTasks.Reset();
+	m_SyncTaskAdditionInfo.Reset();
 
-	const TArray<UAbleAbilityTask*> & Tasks = m_Ability->GetTasks(m_ActiveSegmentIndex);
-	TArray<UAbleAbilityTask*> AcrossSegments;
+	const TArray<UAbleAbilityTask*>& Tasks = m_Ability->GetTaskTimeline(m_ActiveSegmentIndex);
 	for (UAbleAbilityTask* Task : Tasks)
 	{
 		if (!Task || Task->IsDisabled())
@@ -813,19 +854,8 @@ void UAbleAbilityInstance::SetActiveSegmentIndex(int Index)
 		}
 	}
 	
-	{
-		m_TaskDependencyMap.Empty();
-		m_TaskIterationMap.Empty();
-	}
-	const TArray<const UAbleAbilityTask*>& TaskDependencies = m_Ability->GetAllTaskDependencies(m_ActiveSegmentIndex);
-	for (const UAbleAbilityTask* TaskDependency : TaskDependencies)
-	{
-		if (TaskDependency == nullptr)
-			continue;
-
-		check(!m_TaskDependencyMap.Contains(TaskDependency));
-		m_TaskDependencyMap.Add(TaskDependency);
-	}
+	m_CompletedTimelineTasks.Init(false, Tasks.Num());
+	m_TaskIterationMap.Reset();
 
 #if WITH_EDITOR
 	m_SyncTasks.StableSort([](const UAbleAbilityTask& A, const UAbleAbilityTask& B)
@@ -838,7 +868,9 @@ void UAbleAbilityInstance::SetActiveSegmentIndex(int Index)
 	}
 #endif
 
-	m_FinishedSyncTasks.Empty();
+	ResetSyncTaskCursor();
+
+	m_FinishedSyncTasks.Reset();
 	m_FinishedSyncTasks.Reserve(m_SyncTasks.Num());
 }
 
@@ -848,27 +880,42 @@ void UAbleAbilityInstance::SetCurrentIteration(uint32 NewIteration)
 	m_Context->SetSegmentLoopIteration(NewIteration, m_ActiveSegmentIndex);
 }
 
+void UAbleAbilityInstance::ReserveForAbility(const UAbleAbility& Ability)
+{
+	const int32 MaxTasks = Ability.GetMaxSegmentTaskCount();
+	m_SyncTasks.Reserve(MaxTasks);
+	m_SyncTaskAdditionInfo.Reserve(MaxTasks);
+	m_ActiveSyncTasks.Reserve(MaxTasks);
+	m_FinishedSyncTasks.Reserve(MaxTasks);
+	m_DueSyncTasks.Reserve(MaxTasks);
+
+	const int32 MaxAcrossTasks = Ability.GetNumAcrossSegmentTasks();
+	m_AcrossTasks.Reserve(MaxAcrossTasks);
+	m_ActiveAcrossTasks.Reserve(MaxAcrossTasks);
+}
+
 void UAbleAbilityInstance::Reset()
 {
-	// Defaulting to false on the shrink for the arrays. These array entry values are so small, that having them constantly go in/out of allocation could be pretty gross for fragmentation.
-	// Just keep the memory for now, and if it becomes an issue (not sure why it would), then just remove the false and let the memory get released.
+	// Instances are pooled, so keep all our allocations around for the next Ability rather than releasing them.
 	m_DecayTime = 0.0f;
-	m_SyncTasks.Empty(false);
-	m_ActiveSyncTasks.Empty(false);
-	m_FinishedSyncTasks.Empty(false);
+	m_SyncTasks.Reset();
+	m_SyncTaskAdditionInfo.Reset();
+	ResetSyncTaskCursor();
+	m_ActiveSyncTasks.Reset();
+	m_FinishedSyncTasks.Reset();
 	m_Ability = nullptr;
 	m_Context = nullptr;
 	m_ClearTargets = false;
-	m_AdditionalTargets.Empty(false);
-	m_TaskDependencyMap.Empty(false);
+	m_AdditionalTargets.Reset();
+	m_CompletedTimelineTasks.Reset();
 	m_RequestedInstigator.Reset();
 	m_RequestedOwner.Reset();
 	m_RequestedTargetLocation = FVector::ZeroVector;
 	m_ActiveSegmentIndex = -1;
-	m_PreRemoveTask.Empty(false);
-	m_AcrossTasks.Empty(false);
-	m_ActiveAcrossTasks.Empty(false);
-	m_TaskIterationMap.Empty();
+	m_PreRemoveTask.Reset();
+	m_AcrossTasks.Reset();
+	m_ActiveAcrossTasks.Reset();
+	m_TaskIterationMap.Reset();
 	m_PendingPassed = false;
 }
 
@@ -938,7 +985,7 @@ bool UAbleAbilityInstance::CheckForceDependency()
 	return true;
 }
 
-void UAbleAbilityInstance::InternalUpdateTasks(TArray<UAbleAbilityTask*>& InTasks, TArray<const UAbleAbilityTask*>& InActiveTasks, TArray<const UAbleAbilityTask*>& InFinishedTasks, float CurrentTime, float DeltaTime)
+void UAbleAbilityInstance::InternalUpdateTasks(TArray<const UAbleAbilityTask*>& InActiveTasks, TArray<const UAbleAbilityTask*>& InFinishedTasks, float CurrentTime, float DeltaTime)
 {
 	const float AdjustedTime = CurrentTime + DeltaTime;
 	const bool IsLooping = m_Ability->IsSegmentLooping(m_ActiveSegmentIndex) || m_Ability->GetDecrementAndRestartOnEnd();
@@ -986,16 +1033,31 @@ void UAbleAbilityInstance::InternalUpdateTasks(TArray<UAbleAbilityTask*>& InTask
 		m_AcrossTasks.Remove(AcrossTask);
 	}
 	
-	// First go through our Tasks and see if they need to be started.
-	for (int i = 0; i < InTasks.Num(); )
+	// Advance our cursor over any Tasks whose start time we've now reached. If time went backwards, start over
+	// (anything that was retired stays retired, same as if it had been removed from the list).
+	if (AdjustedTime < m_SyncTaskCursorTime)
 	{
-		UAbleAbilityTask* Task = InTasks[i];
-		if (!Task)
+		m_SyncTaskCursor = 0;
+		m_DueSyncTasks.Reset();
+	}
+	m_SyncTaskCursorTime = AdjustedTime;
+
+	while (m_SyncTaskCursor < m_SyncTasks.Num() && m_SyncTasks[m_SyncTaskCursor]->GetStartTime() <= AdjustedTime)
+	{
+		if (!m_RetiredSyncTasks[m_SyncTaskCursor])
 		{
-			++i;
-			continue;
+			m_DueSyncTasks.Add(m_SyncTaskCursor);
 		}
-		
+		++m_SyncTaskCursor;
+	}
+
+	// Now see if any of our due Tasks can be started. Tasks past the cursor can't start this frame, so we never look at them.
+	INC_DWORD_STAT_BY(STAT_AbleAbilityInstance_TaskStartChecks, m_DueSyncTasks.Num());
+	for (int32 DueIndex = 0; DueIndex < m_DueSyncTasks.Num(); )
+	{
+		const int32 TaskIndex = m_DueSyncTasks[DueIndex];
+		UAbleAbilityTask* Task = m_SyncTasks[TaskIndex];
+
 		IsStarting = !Task->IsDisabled() && Task->CanStart(m_Context, CurrentTime, DeltaTime) && CanStartTask(Task);
 
 		if (IsLooping)
@@ -1005,44 +1067,18 @@ void UAbleAbilityInstance::InternalUpdateTasks(TArray<UAbleAbilityTask*>& InTask
 		}
 
 		// Check any dependencies.
-		if (IsStarting && Task->HasDependencies())
+		if (IsStarting && Task->GetDependencyTimelineIndices().Num())
 		{
-			for (const UAbleAbilityTask* DependantTask : Task->GetTaskDependencies())
+			if (!AreDependenciesCompleted(Task))
 			{
-				if (!DependantTask)
-				{
-					continue;
-				}
-
-				// This *should* always be true, but in the editor sometimes the list isn't properly updated.
-				// This is by far the assert I hit the most during iteration, so there's obviously a case I'm missing but I'd rather make this code a bit
-				// more adaptive as it was written before I added the finished lists for both processes.
-				if (!m_TaskDependencyMap.Contains(DependantTask))
-				{
-					FScopeLock DependencyMapLock(&m_DependencyMapCS);
-
-					m_TaskDependencyMap.Add(DependantTask);
-					m_TaskDependencyMap[DependantTask] = m_FinishedSyncTasks.Contains(DependantTask);
-				}
-
-				if (!m_TaskDependencyMap[DependantTask])
-				{
-					// A dependent Task is still executing, we can't start this frame.
-					// UE_LOG(LogTemp, Warning, TEXT("Task [%s] Want to Execute but DependantTask [%s] did not complete yet !"), *GetNameSafe(Task), *GetNameSafe(DependantTask));
-					IsStarting = false;
-					break;
-				}
-				else
-				{
-					// Our dependency is done, but we have some context targets that are pending. These could be needed, so delay for a frame.
-					IsStarting = m_AdditionalTargets.Num() == 0;
-				}
+				// A dependent Task is still executing, we can't start this frame.
+				IsStarting = false;
+			}
+			else
+			{
+				// Our dependencies are done, but we have some context targets that are pending. These could be needed, so delay for a frame.
+				IsStarting = m_AdditionalTargets.Num() == 0;
 			}
-		}
-
-		if (!Task)
-		{
-			UE_LOG(LogAbleSP, Warning, TEXT("Task NULL [%s]!"), *GetNameSafe(&GetAbility()));
 		}
 
 		if (IsStarting && !InActiveTasks.Contains(Task))
@@ -1070,11 +1106,7 @@ void UAbleAbilityInstance::InternalUpdateTasks(TArray<UAbleAbilityTask*>& InTask
 					Task->OnTaskEnd(m_Context, EAbleAbilityTaskResult::Successful);
 				}
 
-				if (m_TaskDependencyMap.Contains(Task))
-				{
-					FScopeLock DependencyMapLock(&m_DependencyMapCS);
-					m_TaskDependencyMap[Task] = true;
-				}
+				MarkTaskCompleted(Task);
 
 				InFinishedTasks.Add(Task);
 			}
@@ -1085,23 +1117,17 @@ void UAbleAbilityInstance::InternalUpdateTasks(TArray<UAbleAbilityTask*>& InTask
 			
 			if (!IsLooping || Task->GetStartTime() < LoopTimeRange.X)
 			{
-				// If we aren't looping, or our task starts before our loop range, we can remove items from this list as we start tasks to cut down on future iterations.
-				InTasks.RemoveAt(i, 1, false);
+				// If we aren't looping, or our task starts before our loop range, we can retire it as we start it to cut down on future iterations.
+				m_RetiredSyncTasks[TaskIndex] = true;
+				++m_NumRetiredSyncTasks;
+				m_DueSyncTasks.RemoveAt(DueIndex, 1, false);
 				continue;
 			}
-
-		}
-		else if (!Task || AdjustedTime < Task->GetStartTime())
-		{
-			// Since our array is sorted by time. It's safe to early out.
-			break;
 		}
 
-		++i;
+		++DueIndex;
 	}
 
-	InTasks.Shrink();
-
 	// Update our actives.
 	bool TaskCompleted = false;
 	const UAbleAbilityTask* ActiveTask = nullptr;
@@ -1125,16 +1151,7 @@ void UAbleAbilityInstance::InternalUpdateTasks(TArray<UAbleAbilityTask*>& InTask
 				ActiveTask->OnTaskEnd(m_Context, EAbleAbilityTaskResult::Successful);
 			}
 
-			if (m_TaskDependencyMap.Contains(ActiveTask))
-			{
-				FScopeLock DependencyMapLock(&m_DependencyMapCS);
-				m_TaskDependencyMap[ActiveTask] = true;
-				// UE_LOG(LogTemp, Warning, TEXT("m_TaskDependencyMap set Dependant %s true !"), *GetNameSafe(ActiveTask));
-			}
-			else
-			{
-				// UE_LOG(LogTemp, Warning, TEXT("m_TaskDependencyMap dont contains task [%s]!"), *GetNameSafe(ActiveTask));
-			}
+			MarkTaskCompleted(ActiveTask);
 
 			if (IsLooping)
 			{
@@ -1207,7 +1224,7 @@ void UAbleAbilityInstance::InternalStopRunningTasks(EAbleAbilityTaskResult Reaso
 			if (!UKismetSystemLibrary::IsValid(Task) || Task->IsAcrossSegment()) continue;
 			Task->OnTaskEnd(m_Context, Reason);
 		}
-		m_ActiveSyncTasks.Empty();
+		m_ActiveSyncTasks.Reset();
 	}
 
 }
@@ -1221,28 +1238,26 @@ void UAbleAbilityInstance::InternalStopAcrossTasks(EAbleAbilityTaskResult Reason
 		AcrossTask->OnTaskEnd(m_Context, Reason);
 	}
 
-	m_AcrossTasks.Empty(false);
-	m_ActiveAcrossTasks.Empty(false);
+	m_AcrossTasks.Reset();
+	m_ActiveAcrossTasks.Reset();
 }
 
 void UAbleAbilityInstance::ResetTaskDependencyStatus()
 {
-	TMap<const UAbleAbilityTask*, bool>::TIterator ResetIt = m_TaskDependencyMap.CreateIterator();
-	const UAbleAbilityTask* Task;
-	for (; ResetIt; ++ResetIt)
+	if (!m_Ability->IsSegmentLooping(m_ActiveSegmentIndex))
+	{
+		m_CompletedTimelineTasks.SetRange(0, m_CompletedTimelineTasks.Num(), false);
+		return;
+	}
+
+	// Only reset if our task falls within our Loop range.
+	const float LoopStart = m_Ability->GetSegmentLoopRange(m_ActiveSegmentIndex).X;
+	const TArray<UAbleAbilityTask*>& Timeline = m_Ability->GetTaskTimeline(m_ActiveSegmentIndex);
+	for (int32 TimelineIndex = 0; TimelineIndex < Timeline.Num() && TimelineIndex < m_CompletedTimelineTasks.Num(); ++TimelineIndex)
 	{
-		Task = ResetIt.Key();
-		if (!m_Ability->IsSegmentLooping(m_ActiveSegmentIndex))
+		if (Timeline[TimelineIndex]->GetStartTime() > LoopStart)
 		{
-			ResetIt.Value() = false;
-		}
-		else
-		{
-			// Only reset if our task falls within our Loop range.
-			if (Task->GetStartTime() > m_Ability->GetSegmentLoopRange(m_ActiveSegmentIndex).X)
-			{
-				ResetIt.Value() = false;
-			}
+			m_CompletedTimelineTasks[TimelineIndex] = false;
 		}
 	}
 }
@@ -1258,3 +1273,35 @@ bool UAbleAbilityInstance::CanStartTask(const UAbleAbilityTask* Task) const
 
 	return true;
 }
+
+void UAbleAbilityInstance::ResetSyncTaskCursor()
+{
+	m_SyncTaskCursor = 0;
+	m_SyncTaskCursorTime = 0.0f;
+	m_DueSyncTasks.Reset();
+	m_RetiredSyncTasks.Init(false, m_SyncTasks.Num());
+	m_NumRetiredSyncTasks = 0;
+}
+
+void UAbleAbilityInstance::MarkTaskCompleted(const UAbleAbilityTask* Task)
+{
+	const int32 TimelineIndex = Task->GetTimelineIndex();
+	if (m_CompletedTimelineTasks.IsValidIndex(TimelineIndex))
+	{
+		m_CompletedTimelineTasks[TimelineIndex] = true;
+	}
+}
+
+bool UAbleAbilityInstance::AreDependenciesCompleted(const UAbleAbilityTask* Task) const
+{
+	// Dependencies outside of our Segment are INDEX_NONE, and can never complete.
+	for (const int32 DependencyIndex : Task->GetDependencyTimelineIndices())
+	{
+		if (!m_CompletedTimelineTasks.IsValidIndex(DependencyIndex) || !m_CompletedTimelineTasks[DependencyIndex])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,237 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#include "ableAbilityTickManager.h"
+
+#include "ableAbilityComponent.h"
+#include "AbleCoreSPPrivate.h"
+#include "ableSettings.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+
+DECLARE_CYCLE_STAT(TEXT("AbleAbilityTickManager::Tick"), STAT_AbleAbilityTickManager_Tick, STATGROUP_Able);
+DECLARE_CYCLE_STAT(TEXT("AbleAbilityTickManager::UpdateCooldowns"), STAT_AbleAbilityTickManager_UpdateCooldowns, STATGROUP_Able);
+DECLARE_CYCLE_STAT(TEXT("AbleAbilityTickManager::UpdateAbilities"), STAT_AbleAbilityTickManager_UpdateAbilities, STATGROUP_Able);
+DECLARE_CYCLE_STAT(TEXT("AbleAbilityTickManager::UpdateThreadSafeTasks"), STAT_AbleAbilityTickManager_UpdateThreadSafeTasks, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Ability Components"), STAT_AbleAbilityTickManager_NumComponents, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Thread Safe Task Ticks"), STAT_AbleAbilityTickManager_NumThreadSafeTasks, STATGROUP_Able);
+
+UAbleAbilityTickManager::UAbleAbilityTickManager()
+	: m_NumStaleEntries(0),
+	m_IsUpdating(false)
+{
+
+}
+
+UAbleAbilityTickManager::~UAbleAbilityTickManager()
+{
+
+}
+
+bool UAbleAbilityTickManager::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const USPAbleSettings* Settings = GetDefault<USPAbleSettings>();
+	return Settings && Settings->GetUseBatchedAbilityTick();
+}
+
+void UAbleAbilityTickManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	m_TickingComponents.Reset();
+	m_NumStaleEntries = 0;
+	m_IsUpdating = false;
+}
+
+void UAbleAbilityTickManager::Deinitialize()
+{
+	for (UAbleAbilityComponent* Component : m_TickingComponents)
+	{
+		if (Component)
+		{
+			Component->m_BatchedTickIndex = INDEX_NONE;
+		}
+	}
+	m_TickingComponents.Empty();
+	m_ThreadSafeTasks.Empty();
+	m_NumStaleEntries = 0;
+
+	Super::Deinitialize();
+}
+
+UAbleAbilityTickManager* UAbleAbilityTickManager::Get(const UWorld* World)
+{
+	if (World && World->IsGameWorld())
+	{
+		return World->GetSubsystem<UAbleAbilityTickManager>();
+	}
+
+	return nullptr;
+}
+
+ETickableTickType UAbleAbilityTickManager::GetTickableTickType() const
+{
+	// The CDO never ticks, instances are conditional on having registered Components.
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UAbleAbilityTickManager::IsTickable() const
+{
+	return m_TickingComponents.Num() > 0;
+}
+
+TStatId UAbleAbilityTickManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAbleAbilityTickManager, STATGROUP_Able);
+}
+
+void UAbleAbilityTickManager::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbleAbilityTickManager_Tick);
+
+	// Anything that registers during the update is picked up next frame, same as a regular tick function would be.
+	const int32 NumComponents = m_TickingComponents.Num();
+	SET_DWORD_STAT(STAT_AbleAbilityTickManager_NumComponents, NumComponents - m_NumStaleEntries);
+
+	m_IsUpdating = true;
+
+	// Cooldowns are normally expired by the Cooldown Manager, this only picks up Components that don't have one.
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AbleAbilityTickManager_UpdateCooldowns);
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			UAbleAbilityComponent* Component = m_TickingComponents[i];
+			if (Component && Component->m_ActiveCooldowns.Num() > 0 && !Component->m_CooldownManager.IsValid())
+			{
+				Component->UpdateCooldowns();
+			}
+		}
+	}
+
+	const USPAbleSettings* Settings = GetDefault<USPAbleSettings>();
+	if (USPAbleSettings::IsAsyncEnabled() && Settings && Settings->GetAllowAbilityAsyncUpdate())
+	{
+		UpdateThreadSafeTasks(NumComponents, DeltaTime);
+	}
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AbleAbilityTickManager_UpdateAbilities);
+		for (int32 i = 0; i < NumComponents; ++i)
+		{
+			UAbleAbilityComponent* Component = m_TickingComponents[i];
+			if (Component && !Component->IsPendingKill())
+			{
+				Component->TickAbilities(DeltaTime);
+			}
+		}
+	}
+
+	m_IsUpdating = false;
+
+	CompactTickingComponents();
+}
+
+void UAbleAbilityTickManager::UpdateThreadSafeTasks(int32 NumComponents, float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbleAbilityTickManager_UpdateThreadSafeTasks);
+
+	// Gather on the Game Thread, since Play Rate can come from Blueprint.
+	m_ThreadSafeTasks.Reset();
+	for (int32 i = 0; i < NumComponents; ++i)
+	{
+		UAbleAbilityComponent* Component = m_TickingComponents[i];
+		if (!Component || Component->IsPendingKill())
+		{
+			continue;
+		}
+
+		if (UAbleAbilityInstance* ActiveInstance = Component->m_ActiveAbilityInstance)
+		{
+			if (ActiveInstance->IsValid())
+			{
+				ActiveInstance->GatherThreadSafeTasks(DeltaTime * ActiveInstance->GetPlayRate(), m_ThreadSafeTasks);
+			}
+		}
+
+		for (UAbleAbilityInstance* PassiveInstance : Component->m_PassiveAbilityInstances)
+		{
+			if (PassiveInstance && PassiveInstance->IsValid())
+			{
+				PassiveInstance->GatherThreadSafeTasks(DeltaTime * PassiveInstance->GetPlayRate(), m_ThreadSafeTasks);
+			}
+		}
+	}
+
+	SET_DWORD_STAT(STAT_AbleAbilityTickManager_NumThreadSafeTasks, m_ThreadSafeTasks.Num());
+
+	if (m_ThreadSafeTasks.Num() == 0)
+	{
+		return;
+	}
+
+	// ParallelFor doesn't return until every entry is done, so the Game Thread update that follows always sees the finished results.
+	ParallelFor(m_ThreadSafeTasks.Num(), [this](int32 Index)
+	{
+		const FAbleThreadSafeTaskTick& Entry = m_ThreadSafeTasks[Index];
+		FScopeCycleCounter TaskScope(Entry.Task->GetStatId());
+		Entry.Task->OnTaskTickThreadSafe(*Entry.Context, Entry.DeltaTime);
+	}, !FApp::ShouldUseThreadingForPerformance());
+}
+
+void UAbleAbilityTickManager::SetComponentTickEnabled(UAbleAbilityComponent& Component, bool Enabled)
+{
+	if (Enabled)
+	{
+		if (Component.m_BatchedTickIndex == INDEX_NONE)
+		{
+			Component.m_BatchedTickIndex = m_TickingComponents.Add(&Component);
+		}
+		return;
+	}
+
+	const int32 Index = Component.m_BatchedTickIndex;
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	check(m_TickingComponents.IsValidIndex(Index) && m_TickingComponents[Index] == &Component);
+	Component.m_BatchedTickIndex = INDEX_NONE;
+
+	if (m_IsUpdating)
+	{
+		// Don't shuffle the array out from under the update, just leave a hole and compact afterwards.
+		m_TickingComponents[Index] = nullptr;
+		++m_NumStaleEntries;
+		return;
+	}
+
+	m_TickingComponents.RemoveAtSwap(Index, 1, false);
+	if (m_TickingComponents.IsValidIndex(Index) && m_TickingComponents[Index])
+	{
+		m_TickingComponents[Index]->m_BatchedTickIndex = Index;
+	}
+}
+
+void UAbleAbilityTickManager::CompactTickingComponents()
+{
+	// GC can also null out entries on us, so always do a pass if we see any.
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < m_TickingComponents.Num(); ++ReadIndex)
+	{
+		UAbleAbilityComponent* Component = m_TickingComponents[ReadIndex];
+		if (Component && Component->m_BatchedTickIndex == ReadIndex)
+		{
+			Component->m_BatchedTickIndex = WriteIndex;
+			m_TickingComponents[WriteIndex++] = Component;
+		}
+	}
+
+	m_TickingComponents.SetNum(WriteIndex, false);
+	m_NumStaleEntries = 0;
+}
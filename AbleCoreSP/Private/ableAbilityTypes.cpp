@@ -4,7 +4,9 @@
 #include "AbleCoreSPPrivate.h"
 #include "ableAbility.h"
 #include "ableAbilityBlueprintLibrary.h"
+#include "ableAbilityComponent.h"
 #include "ableAbilityContext.h"
+#include "ableSubSystem.h"
 #include "DrawDebugHelpers.h"
 #include "Camera/CameraActor.h"
 #include "Components/PrimitiveComponent.h"
@@ -16,6 +18,95 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
 
+FCollisionObjectQueryParams FAbleCollisionChannelCache::GetObjectQueryParams(const UAbleAbilityContext* Context, EAbleChannelPresent Present, const TArray<TEnumAsByte<ESPAbleTraceType>>& TraceTypes)
+{
+	const UAbleAbilityComponent* AbilityComponent = Context ? Context->GetSelfAbilityComponent() : nullptr;
+	UAbleAbilityUtilitySubsystem* UtilitySubsystem = AbilityComponent && IsInGameThread() ? Context->GetUtilitySubsystem() : nullptr;
+	if (!UtilitySubsystem)
+	{
+		return Resolve(Context, Present, TraceTypes);
+	}
+
+	const FAbleChannelPresentKey Key(Present, TraceTypes, AbilityComponent->GetClass());
+	FCollisionObjectQueryParams ObjectQuery;
+	if (!UtilitySubsystem->FindChannelPresent(Key, ObjectQuery))
+	{
+		ObjectQuery = Resolve(Context, Present, TraceTypes);
+		UtilitySubsystem->CacheChannelPresent(Key, ObjectQuery);
+	}
+
+	return ObjectQuery;
+}
+
+FCollisionObjectQueryParams FAbleCollisionChannelCache::Resolve(const UAbleAbilityContext* Context, EAbleChannelPresent Present, const TArray<TEnumAsByte<ESPAbleTraceType>>& TraceTypes)
+{
+	FCollisionObjectQueryParams ObjectQuery;
+	const TArray<TEnumAsByte<ECollisionChannel>> Channels = UAbleAbilityBlueprintLibrary::GetCollisionChannelPresent(Context, Present, TraceTypes);
+	for (TEnumAsByte<ECollisionChannel> Channel : Channels)
+	{
+		ObjectQuery.AddObjectTypesToQuery(Channel.GetValue());
+	}
+
+	return ObjectQuery;
+}
+
+void FAbleContextParameterLayout::Build(const TArray<FAbleContextParameterDeclaration>& Declarations)
+{
+	Handles.Reset();
+	NetworkRelevant.Reset();
+	BlockSize = 0;
+	NumStrings = 0;
+	NumObjects = 0;
+
+	for (const FAbleContextParameterDeclaration& Declaration : Declarations)
+	{
+		if (Declaration.Name.IsNone())
+		{
+			continue;
+		}
+
+		if (Handles.Contains(Declaration.Name))
+		{
+			UE_LOG(LogAbleSP, Warning, TEXT("Context Parameter [%s] is declared more than once, only the first declaration is used."), *Declaration.Name.ToString());
+			continue;
+		}
+
+		// Everything in the block is 4 byte aligned (int32, float, FVector), so we can just pack them.
+		int32 Slot = INDEX_NONE;
+		switch (Declaration.Type)
+		{
+		case EAbleContextParameterType::Int:
+			Slot = BlockSize;
+			BlockSize += sizeof(int32);
+			break;
+		case EAbleContextParameterType::Float:
+			Slot = BlockSize;
+			BlockSize += sizeof(float);
+			break;
+		case EAbleContextParameterType::Vector:
+			Slot = BlockSize;
+			BlockSize += sizeof(FVector);
+			break;
+		case EAbleContextParameterType::String:
+			Slot = NumStrings++;
+			break;
+		case EAbleContextParameterType::UObject:
+			Slot = NumObjects++;
+			break;
+		default:
+			checkNoEntry();
+			break;
+		}
+
+		Handles.Add(Declaration.Name, FAbleContextParameterHandle(Slot, Declaration.Type));
+
+		if (Declaration.NetworkRelevant)
+		{
+			NetworkRelevant.Add(Declaration);
+		}
+	}
+}
+
 FAbleAbilityTargetTypeLocation::FAbleAbilityTargetTypeLocation()
 	: m_Source(EAbleAbilityTargetType::ATT_Self),
 	  m_TargetIndex(0),
@@ -0,0 +1,221 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#include "ableCooldownManager.h"
+
+#include "ableAbilityComponent.h"
+#include "AbleCoreSPPrivate.h"
+#include "ableSettings.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("AbleCooldownManager::Tick"), STAT_AbleCooldownManager_Tick, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cooldown Timers"), STAT_AbleCooldownManager_NumTimers, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cooldown Timers Expired"), STAT_AbleCooldownManager_NumExpired, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cooldown Timers Cascaded"), STAT_AbleCooldownManager_NumCascaded, STATGROUP_Able);
+
+UAbleCooldownManager::UAbleCooldownManager()
+	: m_CurrentTick(0),
+	m_Resolution(0.05f),
+	m_NumTimers(0)
+{
+
+}
+
+UAbleCooldownManager::~UAbleCooldownManager()
+{
+
+}
+
+void UAbleCooldownManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const USPAbleSettings* Settings = GetDefault<USPAbleSettings>();
+	m_Resolution = FMath::Max(Settings ? Settings->GetCooldownTimerResolution() : 0.05f, KINDA_SMALL_NUMBER);
+
+	m_Slots.Reset();
+	m_Slots.SetNum(NumLevels * NumSlots);
+	m_Overflow.Reset();
+	m_Expired.Reset();
+	m_NumTimers = 0;
+
+	const UWorld* World = GetWorld();
+	m_CurrentTick = World ? TimeToTick(World->GetTimeSeconds()) : 0;
+}
+
+void UAbleCooldownManager::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_AbleCooldownManager_NumTimers, m_NumTimers);
+
+	m_Slots.Empty();
+	m_Overflow.Empty();
+	m_Expired.Empty();
+	m_NumTimers = 0;
+
+	Super::Deinitialize();
+}
+
+UAbleCooldownManager* UAbleCooldownManager::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UAbleCooldownManager>() : nullptr;
+}
+
+ETickableTickType UAbleCooldownManager::GetTickableTickType() const
+{
+	// The CDO never ticks, instances are conditional on having timers.
+	return HasAnyFlags(RF_ClassDefaultObject) ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UAbleCooldownManager::IsTickable() const
+{
+	return m_NumTimers > 0;
+}
+
+TStatId UAbleCooldownManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAbleCooldownManager, STATGROUP_Able);
+}
+
+void UAbleCooldownManager::ScheduleCooldown(UAbleAbilityComponent& Component, uint32 AbilityNameHash, float ExpiryTime)
+{
+	check(IsInGameThread());
+
+	if (m_NumTimers == 0)
+	{
+		// We don't tick while empty, so jump straight to now rather than having AdvanceTo step across the whole gap.
+		const UWorld* World = GetWorld();
+		m_CurrentTick = FMath::Max(m_CurrentTick, World ? TimeToTick(World->GetTimeSeconds()) : m_CurrentTick);
+	}
+
+	FAbleCooldownTimer Timer;
+	Timer.Component = &Component;
+	Timer.AbilityNameHash = AbilityNameHash;
+	Timer.ExpiryTime = ExpiryTime;
+	// Round up, so a timer never fires before its Cooldown is actually done.
+	Timer.ExpiryTick = FMath::Max<int64>(TimeToTick(ExpiryTime) + 1, m_CurrentTick + 1);
+
+	InsertTimer(Timer);
+
+	++m_NumTimers;
+	INC_DWORD_STAT(STAT_AbleCooldownManager_NumTimers);
+}
+
+void UAbleCooldownManager::InsertTimer(const FAbleCooldownTimer& Timer)
+{
+	if (Timer.ExpiryTick <= m_CurrentTick)
+	{
+		m_Expired.Add(Timer);
+		return;
+	}
+
+	// Use the finest level where the timer shares the same parent slot as the current tick, that way the slot
+	// is guaranteed to be ahead of us and we'll reach it before the parent moves on.
+	for (int32 Level = 0; Level < NumLevels; ++Level)
+	{
+		const int32 ParentShift = SlotBits * (Level + 1);
+		if ((Timer.ExpiryTick >> ParentShift) == (m_CurrentTick >> ParentShift))
+		{
+			const int32 Slot = (int32)((Timer.ExpiryTick >> (SlotBits * Level)) & SlotMask);
+			GetSlot(Level, Slot).Add(Timer);
+			return;
+		}
+	}
+
+	m_Overflow.Add(Timer);
+}
+
+void UAbleCooldownManager::CascadeSlot(int32 Level, int32 Slot)
+{
+	TArray<FAbleCooldownTimer>& SlotTimers = GetSlot(Level, Slot);
+	if (SlotTimers.Num() == 0)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_AbleCooldownManager_NumCascaded, SlotTimers.Num());
+
+	// InsertTimer can never put a timer back into the slot it came from, but take a copy anyway so we aren't iterating what we add to.
+	TArray<FAbleCooldownTimer> Cascading = MoveTemp(SlotTimers);
+	SlotTimers.Reset();
+	for (const FAbleCooldownTimer& Timer : Cascading)
+	{
+		InsertTimer(Timer);
+	}
+}
+
+void UAbleCooldownManager::AdvanceTo(int64 TargetTick)
+{
+	if (m_NumTimers == 0)
+	{
+		// Nothing to fire, just catch up.
+		m_CurrentTick = FMath::Max(m_CurrentTick, TargetTick);
+		return;
+	}
+
+	while (m_CurrentTick < TargetTick)
+	{
+		++m_CurrentTick;
+
+		// Top level wrapped, see if any of our far out timers fit now.
+		if ((m_CurrentTick & ((int64(1) << (SlotBits * NumLevels)) - 1)) == 0 && m_Overflow.Num() > 0)
+		{
+			TArray<FAbleCooldownTimer> Overflow = MoveTemp(m_Overflow);
+			m_Overflow.Reset();
+			for (const FAbleCooldownTimer& Timer : Overflow)
+			{
+				InsertTimer(Timer);
+			}
+		}
+
+		// Coarsest first, so timers cascading out of a higher level can continue on down this same tick.
+		for (int32 Level = NumLevels - 1; Level > 0; --Level)
+		{
+			const int32 Shift = SlotBits * Level;
+			if ((m_CurrentTick & ((int64(1) << Shift) - 1)) == 0)
+			{
+				CascadeSlot(Level, (int32)((m_CurrentTick >> Shift) & SlotMask));
+			}
+		}
+
+		TArray<FAbleCooldownTimer>& DueTimers = GetSlot(0, (int32)(m_CurrentTick & SlotMask));
+		if (DueTimers.Num() > 0)
+		{
+			m_Expired.Append(DueTimers);
+			DueTimers.Reset();
+		}
+	}
+}
+
+void UAbleCooldownManager::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbleCooldownManager_Tick);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetTimeSeconds();
+	AdvanceTo(TimeToTick(CurrentTime));
+
+	if (m_Expired.Num() == 0)
+	{
+		return;
+	}
+
+	// Callbacks are free to schedule new timers, so work from a local copy.
+	TArray<FAbleCooldownTimer> Expired = MoveTemp(m_Expired);
+	m_Expired.Reset();
+
+	m_NumTimers -= Expired.Num();
+	DEC_DWORD_STAT_BY(STAT_AbleCooldownManager_NumTimers, Expired.Num());
+	INC_DWORD_STAT_BY(STAT_AbleCooldownManager_NumExpired, Expired.Num());
+
+	for (const FAbleCooldownTimer& Timer : Expired)
+	{
+		if (UAbleAbilityComponent* Component = Timer.Component.Get())
+		{
+			Component->OnCooldownTimerExpired(Timer.AbilityNameHash, Timer.ExpiryTime, CurrentTime);
+		}
+	}
+}
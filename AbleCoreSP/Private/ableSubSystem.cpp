@@ -2,11 +2,35 @@
 
 #include "ableSubSystem.h"
 #include "ableAbility.h"
+#include "ableAbilityComponent.h"
 #include "ableAbilityContext.h"
+#include "ableAbilityInstance.h"
+#include "AbleCoreSPPrivate.h"
 #include "ableSettings.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scratch Pad Pool Hits"), STAT_AbleScratchPadPoolHits, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Scratch Pad Pool Misses"), STAT_AbleScratchPadPoolMisses, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Scratch Pads"), STAT_AblePooledScratchPads, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Scratch Pads High Water"), STAT_AblePooledScratchPadsHighWater, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Context Pool Hits"), STAT_AbleContextPoolHits, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Context Pool Misses"), STAT_AbleContextPoolMisses, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Contexts"), STAT_AblePooledContexts, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Outstanding Contexts"), STAT_AbleOutstandingContexts, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Trimmed Contexts"), STAT_AbleTrimmedContexts, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Instance Pool Hits"), STAT_AbleInstancePoolHits, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Instance Pool Misses"), STAT_AbleInstancePoolMisses, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Instances"), STAT_AblePooledInstances, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Line of Sight Cache Hits"), STAT_AbleLineOfSightCacheHits, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Line of Sight Cache Misses"), STAT_AbleLineOfSightCacheMisses, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Cached Line of Sight Results"), STAT_AbleCachedLineOfSight, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Channel Present Cache Hits"), STAT_AbleChannelPresentCacheHits, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Channel Present Cache Misses"), STAT_AbleChannelPresentCacheMisses, STATGROUP_Able);
+
+/* Once the Line of Sight cache is at least this big, we prune stale results (at most once a frame). */
+static const int32 AbleLineOfSightPruneThreshold = 128;
+
 UAbleAbilityUtilitySubsystem::UAbleAbilityUtilitySubsystem(const FObjectInitializer& ObjectInitializer)
-	: m_Settings(nullptr), m_ChannelPresentDataTable(nullptr)
+	: m_AvailableContextsLowWater(0), m_LastContextTrimTime(0.0), m_NumPooledScratchPads(0U), m_PooledScratchPadsHighWater(0U), m_LineOfSightPruneFrame(0U), m_Settings(nullptr), m_ChannelPresentDataTable(nullptr)
 {
 
 }
@@ -24,12 +48,10 @@ void UAbleAbilityUtilitySubsystem::Initialize(UObject& Outer)
 	if (m_Settings && m_Settings->GetInitialContextPoolSize() > 0)
 	{
 		m_AvailableContexts.Reserve(m_Settings->GetInitialContextPoolSize());
-		m_AllocatedContexts.Reserve(m_Settings->GetInitialContextPoolSize());
+		m_OutstandingContexts.Reserve(m_Settings->GetInitialContextPoolSize());
 		for (uint32 i = 0; i < m_Settings->GetInitialContextPoolSize(); ++i)
 		{
-			UAbleAbilityContext* Context = NewObject<UAbleAbilityContext>(this);
-			m_AllocatedContexts.Add(Context);
-			m_AvailableContexts.Push(Context);
+			m_AvailableContexts.Push(NewObject<UAbleAbilityContext>(this));
 		}
 	}
 
@@ -43,29 +65,33 @@ FString UAbleAbilityUtilitySubsystem::GetModuleName_Implementation() const
 
 UAbleAbilityTaskScratchPad* UAbleAbilityUtilitySubsystem::FindOrConstructTaskScratchPad(TSubclassOf<UAbleAbilityTaskScratchPad>& Class)
 {
+	// Scratch Pads are UObjects, so they're only ever handed out (and allocated) on the Game Thread. Async Task updates use what was allocated at start.
+	check(IsInGameThread());
+
 	if (m_Settings && !m_Settings->GetAllowScratchPadReuse())
 	{
 		return NewObject<UAbleAbilityTaskScratchPad>(this, *Class);
 	}
 
 	UAbleAbilityTaskScratchPad* OutInstance = nullptr;
-	if (FAbleTaskScratchPadBucket* ExistingBucket = GetTaskBucketByClass(Class))
+	FAbleTaskScratchPadBucket* Bucket = GetTaskBucketByClass(Class);
+	if (!Bucket)
 	{
-		if (ExistingBucket->Instances.Num())
-		{
-			OutInstance = ExistingBucket->Instances.Pop(false);
-		}
-		else
-		{
-			// Ran out of Instances, make one.
-			OutInstance = NewObject<UAbleAbilityTaskScratchPad>(this, *Class);
-		}
+		Bucket = &m_TaskBuckets.Add(Class.Get());
+		Bucket->ScratchPadClass = Class;
+	}
+
+	if (Bucket->Instances.Num())
+	{
+		OutInstance = Bucket->Instances.Pop(false);
+		OnScratchPadUnpooled();
+		INC_DWORD_STAT(STAT_AbleScratchPadPoolHits);
 	}
 	else
 	{
-		FAbleTaskScratchPadBucket& NewBucket = m_TaskBuckets.AddDefaulted_GetRef();
-		NewBucket.ScratchPadClass = Class;
+		// Ran out of Instances, make one.
 		OutInstance = NewObject<UAbleAbilityTaskScratchPad>(this, *Class);
+		INC_DWORD_STAT(STAT_AbleScratchPadPoolMisses);
 	}
 
 	check(OutInstance);
@@ -74,62 +100,207 @@ UAbleAbilityTaskScratchPad* UAbleAbilityUtilitySubsystem::FindOrConstructTaskScr
 
 UAbleAbilityScratchPad* UAbleAbilityUtilitySubsystem::FindOrConstructAbilityScratchPad(TSubclassOf<UAbleAbilityScratchPad>& Class)
 {
+	check(IsInGameThread());
+
 	if (m_Settings && !m_Settings->GetAllowScratchPadReuse())
 	{
 		return NewObject<UAbleAbilityScratchPad>(this, *Class);
 	}
 
 	UAbleAbilityScratchPad* OutInstance = nullptr;
-	if (FAbleAbilityScratchPadBucket* ExistingBucket = GetAbilityBucketByClass(Class))
+	FAbleAbilityScratchPadBucket* Bucket = GetAbilityBucketByClass(Class);
+	if (!Bucket)
 	{
-		if (ExistingBucket->Instances.Num())
-		{
-			OutInstance = ExistingBucket->Instances.Pop(false);
-		}
-		else
-		{
-			// Ran out of Instances, make one.
-			OutInstance = NewObject<UAbleAbilityScratchPad>(this, *Class);
-		}
+		Bucket = &m_AbilityBuckets.Add(Class.Get());
+		Bucket->ScratchPadClass = Class;
+	}
+
+	if (Bucket->Instances.Num())
+	{
+		OutInstance = Bucket->Instances.Pop(false);
+		OnScratchPadUnpooled();
+		INC_DWORD_STAT(STAT_AbleScratchPadPoolHits);
 	}
 	else
 	{
-		FAbleAbilityScratchPadBucket& NewBucket = m_AbilityBuckets.AddDefaulted_GetRef();
-		NewBucket.ScratchPadClass = Class;
+		// Ran out of Instances, make one.
 		OutInstance = NewObject<UAbleAbilityScratchPad>(this, *Class);
+		INC_DWORD_STAT(STAT_AbleScratchPadPoolMisses);
 	}
 
 	check(OutInstance);
 	return OutInstance;
 }
 
+void UAbleAbilityUtilitySubsystem::PrewarmScratchPads(UAbleAbilityComponent* AbilityComponent, const UAbleAbility* Ability, int32 Count)
+{
+	check(IsInGameThread());
+
+	if (!AbilityComponent || !Ability || Count <= 0 || (m_Settings && !m_Settings->GetAllowScratchPadReuse()))
+	{
+		return;
+	}
+
+	// No Context here, so Tasks/Abilities that pick their Scratch Pad class at runtime get a null one.
+	TArray<UClass*, TInlineAllocator<16>> TaskScratchPadClasses;
+	for (const UAbleAbilityTask* Task : Ability->GetTasks())
+	{
+		if (!Task)
+		{
+			continue;
+		}
+
+		TSubclassOf<UAbleAbilityTaskScratchPad> ScratchPadClass = Task->GetTaskScratchPadClass(nullptr);
+		if (ScratchPadClass.Get())
+		{
+			TaskScratchPadClasses.AddUnique(ScratchPadClass.Get());
+		}
+	}
+
+	for (UClass* ScratchPadClass : TaskScratchPadClasses)
+	{
+		TSubclassOf<UAbleAbilityTaskScratchPad> Class = ScratchPadClass;
+		FAbleTaskScratchPadBucket* Bucket = GetTaskBucketByClass(Class);
+		if (!Bucket)
+		{
+			Bucket = &m_TaskBuckets.Add(ScratchPadClass);
+			Bucket->ScratchPadClass = Class;
+		}
+
+		while (Bucket->Instances.Num() < Count && CanPoolScratchPad())
+		{
+			Bucket->Instances.Push(NewObject<UAbleAbilityTaskScratchPad>(this, ScratchPadClass));
+			OnScratchPadPooled();
+		}
+	}
+
+	TSubclassOf<UAbleAbilityScratchPad> AbilityScratchPadClass = Ability->GetAbilityScratchPadClassBP(nullptr);
+	if (AbilityScratchPadClass.Get())
+	{
+		FAbleAbilityScratchPadBucket* Bucket = GetAbilityBucketByClass(AbilityScratchPadClass);
+		if (!Bucket)
+		{
+			Bucket = &m_AbilityBuckets.Add(AbilityScratchPadClass.Get());
+			Bucket->ScratchPadClass = AbilityScratchPadClass;
+		}
+
+		while (Bucket->Instances.Num() < Count && CanPoolScratchPad())
+		{
+			Bucket->Instances.Push(NewObject<UAbleAbilityScratchPad>(this, *AbilityScratchPadClass));
+			OnScratchPadPooled();
+		}
+	}
+}
+
 void UAbleAbilityUtilitySubsystem::ClearAllCachePools()
 {
 	m_AbilityBuckets.Empty();
 	m_TaskBuckets.Empty();
 	m_AvailableContexts.Empty();
-	m_AllocatedContexts.Empty();
+	m_OutstandingContexts.Empty();
+	m_AvailableContextsLowWater = 0;
+	m_AvailableInstances.Empty();
+	m_LineOfSightCache.Empty();
+	m_ChannelPresentCache.Empty();
+
+	m_NumPooledScratchPads = 0U;
+	SET_DWORD_STAT(STAT_AblePooledScratchPads, 0);
+	SET_DWORD_STAT(STAT_AblePooledContexts, 0);
+	SET_DWORD_STAT(STAT_AbleOutstandingContexts, 0);
+	SET_DWORD_STAT(STAT_AblePooledInstances, 0);
+	SET_DWORD_STAT(STAT_AbleCachedLineOfSight, 0);
 }
 
-void UAbleAbilityUtilitySubsystem::ReturnTaskScratchPad(UAbleAbilityTaskScratchPad* Scratchpad)
+bool UAbleAbilityUtilitySubsystem::FindLineOfSight(const FAbleLineOfSightKey& Key, bool& OutBlocked) const
 {
-	if (m_Settings)
+	check(IsInGameThread());
+
+	const FLineOfSightResult* Result = m_LineOfSightCache.Find(Key);
+	if (Result && IsLineOfSightFresh(Result->Frame))
 	{
-		if (!m_Settings->GetAllowScratchPadReuse())
-		{
-			return;
-		}
+		INC_DWORD_STAT(STAT_AbleLineOfSightCacheHits);
+		OutBlocked = Result->bBlocked;
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_AbleLineOfSightCacheMisses);
+	return false;
+}
+
+void UAbleAbilityUtilitySubsystem::CacheLineOfSight(const FAbleLineOfSightKey& Key, bool bBlocked)
+{
+	check(IsInGameThread());
+
+	if (m_LineOfSightCache.Num() >= AbleLineOfSightPruneThreshold)
+	{
+		PruneLineOfSightCache();
+	}
+
+	FLineOfSightResult& Result = m_LineOfSightCache.FindOrAdd(Key);
+	Result.bBlocked = bBlocked;
+	Result.Frame = GFrameCounter;
+
+	SET_DWORD_STAT(STAT_AbleCachedLineOfSight, m_LineOfSightCache.Num());
+}
+
+bool UAbleAbilityUtilitySubsystem::FindChannelPresent(const FAbleChannelPresentKey& Key, FCollisionObjectQueryParams& OutObjectQuery) const
+{
+	check(IsInGameThread());
+
+	if (const FCollisionObjectQueryParams* ObjectQuery = m_ChannelPresentCache.Find(Key))
+	{
+		INC_DWORD_STAT(STAT_AbleChannelPresentCacheHits);
+		OutObjectQuery = *ObjectQuery;
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_AbleChannelPresentCacheMisses);
+	return false;
+}
 
-		if (m_Settings->GetMaxScratchPadPoolSize() > 0U && GetTotalScratchPads() > m_Settings->GetMaxScratchPadPoolSize())
+void UAbleAbilityUtilitySubsystem::CacheChannelPresent(const FAbleChannelPresentKey& Key, const FCollisionObjectQueryParams& ObjectQuery)
+{
+	check(IsInGameThread());
+	m_ChannelPresentCache.Add(Key, ObjectQuery);
+}
+
+void UAbleAbilityUtilitySubsystem::PruneLineOfSightCache()
+{
+	if (m_LineOfSightPruneFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	m_LineOfSightPruneFrame = GFrameCounter;
+	for (TMap<FAbleLineOfSightKey, FLineOfSightResult>::TIterator It(m_LineOfSightCache); It; ++It)
+	{
+		if (!IsLineOfSightFresh(It.Value().Frame))
 		{
-			return;
+			It.RemoveCurrent();
 		}
 	}
+}
+
+bool UAbleAbilityUtilitySubsystem::IsLineOfSightFresh(uint64 Frame) const
+{
+	const uint64 CacheFrames = m_Settings ? m_Settings->GetLineOfSightCacheFrames() : 0U;
+	return GFrameCounter <= Frame + CacheFrames;
+}
+
+void UAbleAbilityUtilitySubsystem::ReturnTaskScratchPad(UAbleAbilityTaskScratchPad* Scratchpad)
+{
+	check(IsInGameThread());
+
+	if (!CanPoolScratchPad())
+	{
+		return;
+	}
 
 	TSubclassOf<UAbleAbilityTaskScratchPad> ClassSubClass = Scratchpad->GetClass();
 	if (FAbleTaskScratchPadBucket* Bucket = GetTaskBucketByClass(ClassSubClass))
 	{
 		Bucket->Instances.Push(Scratchpad);
+		OnScratchPadPooled();
 	}
 
 	// If we don't have a bucket then we somehow mixed worlds... which doesn't make sense. Just let it release through the GC system.
@@ -137,23 +308,18 @@ void UAbleAbilityUtilitySubsystem::ReturnTaskScratchPad(UAbleAbilityTaskScratchP
 
 void UAbleAbilityUtilitySubsystem::ReturnAbilityScratchPad(UAbleAbilityScratchPad* Scratchpad)
 {
-	if (m_Settings)
-	{
-		if (!m_Settings->GetAllowScratchPadReuse())
-		{
-			return;
-		}
+	check(IsInGameThread());
 
-		if (m_Settings->GetMaxScratchPadPoolSize() > 0U && GetTotalScratchPads() > m_Settings->GetMaxScratchPadPoolSize())
-		{
-			return;
-		}
+	if (!CanPoolScratchPad())
+	{
+		return;
 	}
 
 	TSubclassOf<UAbleAbilityScratchPad> ClassSubClass = Scratchpad->GetClass();
 	if (FAbleAbilityScratchPadBucket* Bucket = GetAbilityBucketByClass(ClassSubClass))
 	{
 		Bucket->Instances.Push(Scratchpad);
+		OnScratchPadPooled();
 	}
 
 	// If we don't have a bucket then we somehow mixed worlds... which doesn't make sense. Just let it release through the GC system.
@@ -166,102 +332,233 @@ UDataTable* UAbleAbilityUtilitySubsystem::TryGetChannelPresentDataTable()
 		const FString DataTableReference = "/Game/Feature/StarP/Data/AssetData/SP_AbleChannelPresent.SP_AbleChannelPresent";
 		UDataTable* DataTable = Cast<UDataTable>(FSoftObjectPath(DataTableReference).TryLoad());
 		m_ChannelPresentDataTable = DataTable;
+
+#if WITH_EDITOR
+		// Queries cache what the presets resolve to, so they need to hear about edits and reimports.
+		if (m_ChannelPresentDataTable)
+		{
+			m_ChannelPresentDataTable->OnDataTableChanged().AddUObject(this, &UAbleAbilityUtilitySubsystem::OnChannelPresentDataTableChanged);
+		}
+#endif
 	}
 
 	return m_ChannelPresentDataTable;
 }
 
+#if WITH_EDITOR
+void UAbleAbilityUtilitySubsystem::OnChannelPresentDataTableChanged()
+{
+	m_ChannelPresentCache.Empty();
+}
+#endif
+
 FAbleTaskScratchPadBucket* UAbleAbilityUtilitySubsystem::GetTaskBucketByClass(TSubclassOf<UAbleAbilityTaskScratchPad>& Class)
 {
-	if (!Class.Get())
-	{
-		return nullptr;
-	}
+	return Class.Get() ? m_TaskBuckets.Find(Class.Get()) : nullptr;
+}
+
+FAbleAbilityScratchPadBucket* UAbleAbilityUtilitySubsystem::GetAbilityBucketByClass(TSubclassOf<UAbleAbilityScratchPad>& Class)
+{
+	return Class.Get() ? m_AbilityBuckets.Find(Class.Get()) : nullptr;
+}
 
-	for (FAbleTaskScratchPadBucket& Bucket : m_TaskBuckets)
+bool UAbleAbilityUtilitySubsystem::CanPoolScratchPad() const
+{
+	if (m_Settings)
 	{
-		if (Class->GetFName() == Bucket.ScratchPadClass->GetFName())
+		if (!m_Settings->GetAllowScratchPadReuse())
 		{
-			return &Bucket;
+			return false;
+		}
+
+		if (m_Settings->GetMaxScratchPadPoolSize() > 0U && GetTotalScratchPads() >= m_Settings->GetMaxScratchPadPoolSize())
+		{
+			return false;
 		}
 	}
 
-	return nullptr;
+	return true;
 }
 
-FAbleAbilityScratchPadBucket* UAbleAbilityUtilitySubsystem::GetAbilityBucketByClass(TSubclassOf<UAbleAbilityScratchPad>& Class)
+void UAbleAbilityUtilitySubsystem::OnScratchPadPooled()
+{
+	++m_NumPooledScratchPads;
+	m_PooledScratchPadsHighWater = FMath::Max(m_PooledScratchPadsHighWater, m_NumPooledScratchPads);
+
+	SET_DWORD_STAT(STAT_AblePooledScratchPads, m_NumPooledScratchPads);
+	SET_DWORD_STAT(STAT_AblePooledScratchPadsHighWater, m_PooledScratchPadsHighWater);
+}
+
+void UAbleAbilityUtilitySubsystem::OnScratchPadUnpooled()
 {
-	if (!Class.Get())
+	check(m_NumPooledScratchPads > 0U);
+	--m_NumPooledScratchPads;
+
+	SET_DWORD_STAT(STAT_AblePooledScratchPads, m_NumPooledScratchPads);
+}
+
+UAbleAbilityContext* UAbleAbilityUtilitySubsystem::FindOrConstructContext()
+{
+	check(IsInGameThread());
+
+	UAbleAbilityContext* Context = nullptr;
+	if (m_AvailableContexts.Num() != 0 && (!m_Settings || m_Settings->GetAllowAbilityContextReuse()))
+	{
+		Context = m_AvailableContexts.Pop(false);
+		m_AvailableContextsLowWater = FMath::Min(m_AvailableContextsLowWater, m_AvailableContexts.Num());
+		INC_DWORD_STAT(STAT_AbleContextPoolHits);
+	}
+	else
 	{
-		return nullptr;
+		Context = NewObject<UAbleAbilityContext>(this);
+		m_AvailableContextsLowWater = 0;
+		INC_DWORD_STAT(STAT_AbleContextPoolMisses);
 	}
 
-	for (FAbleAbilityScratchPadBucket& Bucket : m_AbilityBuckets)
+	// Only Contexts we've handed out come back in to the pool, so we can also see what hasn't come back.
+	m_OutstandingContexts.Add(Context, FPlatformTime::Seconds());
+
+	SET_DWORD_STAT(STAT_AblePooledContexts, m_AvailableContexts.Num());
+	SET_DWORD_STAT(STAT_AbleOutstandingContexts, m_OutstandingContexts.Num());
+
+	return Context;
+}
+
+UAbleAbilityInstance* UAbleAbilityUtilitySubsystem::FindOrConstructInstance()
+{
+	check(IsInGameThread());
+
+	if (m_AvailableInstances.Num() > 0)
 	{
-		if (Class->GetFName() == Bucket.ScratchPadClass->GetFName())
-		{
-			return &Bucket;
-		}
+		INC_DWORD_STAT(STAT_AbleInstancePoolHits);
+		UAbleAbilityInstance* Instance = m_AvailableInstances.Pop(false);
+		SET_DWORD_STAT(STAT_AblePooledInstances, m_AvailableInstances.Num());
+		return Instance;
 	}
 
-	return nullptr;
+	INC_DWORD_STAT(STAT_AbleInstancePoolMisses);
+	return NewObject<UAbleAbilityInstance>(this);
 }
 
-uint32 UAbleAbilityUtilitySubsystem::GetTotalScratchPads() const
+void UAbleAbilityUtilitySubsystem::ReturnInstance(UAbleAbilityInstance* Instance)
 {
-	uint32 TotalAmount = 0;
+	check(IsInGameThread());
 
-	for (const FAbleAbilityScratchPadBucket& Bucket : m_AbilityBuckets)
+	if (!Instance)
 	{
-		TotalAmount += Bucket.Instances.Num();
+		return;
 	}
 
-	for (const FAbleTaskScratchPadBucket& Bucket : m_TaskBuckets)
+	if (m_Settings && m_Settings->GetMaxInstancePoolSize() > 0U && (uint32)m_AvailableInstances.Num() >= m_Settings->GetMaxInstancePoolSize())
 	{
-		TotalAmount += Bucket.Instances.Num();
+		return;
 	}
 
-	return TotalAmount;
+	// Callers should have done this already, but a stale Instance in the pool would be very hard to track down.
+	Instance->Reset();
+	m_AvailableInstances.Push(Instance);
+	SET_DWORD_STAT(STAT_AblePooledInstances, m_AvailableInstances.Num());
 }
 
-UAbleAbilityContext* UAbleAbilityUtilitySubsystem::FindOrConstructContext()
+void UAbleAbilityUtilitySubsystem::ReturnContext(UAbleAbilityContext* Context)
 {
-	UAbleAbilityContext* Context = nullptr;
-	if (m_Settings && !m_Settings->GetAllowAbilityContextReuse())
+	check(IsInGameThread());
+
+	if (!Context || m_OutstandingContexts.Remove(Context) == 0)
 	{
-		Context = NewObject<UAbleAbilityContext>(this);
-		m_AllocatedContexts.Add(Context);
+		// Either it was created outside of the pool, or it's already been returned.
+		return;
 	}
-	else
+
+	SET_DWORD_STAT(STAT_AbleOutstandingContexts, m_OutstandingContexts.Num());
+
+	if (m_Settings)
 	{
-		if (m_AvailableContexts.Num() != 0)
+		if (!m_Settings->GetAllowAbilityContextReuse())
 		{
-			Context = m_AvailableContexts.Pop(false);
+			return;
 		}
-		else
+
+		if (m_Settings->GetMaxContextPoolSize() > 0U && (uint32)m_AvailableContexts.Num() >= m_Settings->GetMaxContextPoolSize())
 		{
-			Context = NewObject<UAbleAbilityContext>(this);
-			m_AllocatedContexts.Add(Context);
+			return;
 		}
 	}
 
-	return Context;
+	m_AvailableContexts.Push(Context);
+	SET_DWORD_STAT(STAT_AblePooledContexts, m_AvailableContexts.Num());
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (m_LastContextTrimTime <= 0.0)
+	{
+		m_LastContextTrimTime = CurrentTime;
+		m_AvailableContextsLowWater = m_AvailableContexts.Num();
+	}
+	else if (m_Settings && m_Settings->GetContextPoolTrimInterval() > 0.0f && CurrentTime - m_LastContextTrimTime >= m_Settings->GetContextPoolTrimInterval())
+	{
+		TrimContextPool(CurrentTime);
+	}
 }
 
-void UAbleAbilityUtilitySubsystem::ReturnContext(UAbleAbilityContext* Context)
+void UAbleAbilityUtilitySubsystem::TrimContextPool(double CurrentTime)
 {
-	if (m_Settings && !m_Settings->GetAllowAbilityContextReuse())
+	m_LastContextTrimTime = CurrentTime;
+
+	// Anything that sat in the pool the whole interval wasn't needed. Release the oldest of those, but keep our initial pool around.
+	const int32 MinPoolSize = m_Settings ? (int32)m_Settings->GetInitialContextPoolSize() : 0;
+	const int32 NumToTrim = FMath::Min(m_AvailableContextsLowWater, m_AvailableContexts.Num() - MinPoolSize);
+	if (NumToTrim > 0)
 	{
-		if (!m_Settings->GetAllowAbilityContextReuse())
+		m_AvailableContexts.RemoveAt(0, NumToTrim, false);
+		INC_DWORD_STAT_BY(STAT_AbleTrimmedContexts, NumToTrim);
+		SET_DWORD_STAT(STAT_AblePooledContexts, m_AvailableContexts.Num());
+	}
+
+	m_AvailableContextsLowWater = m_AvailableContexts.Num();
+
+	// Contexts that were garbage collected without being returned aren't leaking, they just never came back. Stop tracking them.
+	for (TMap<TWeakObjectPtr<UAbleAbilityContext>, double>::TIterator It = m_OutstandingContexts.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
 		{
-			return;
+			It.RemoveCurrent();
 		}
+	}
+	SET_DWORD_STAT(STAT_AbleOutstandingContexts, m_OutstandingContexts.Num());
 
-		if (m_Settings->GetMaxContextPoolSize() > 0U && (uint32)m_AvailableContexts.Num() >= m_Settings->GetMaxContextPoolSize())
+	if (m_Settings && m_Settings->GetContextLeakWarningTime() > 0.0f)
+	{
+		LogOutstandingContexts(m_Settings->GetContextLeakWarningTime());
+	}
+}
+
+void UAbleAbilityUtilitySubsystem::LogOutstandingContexts(float MinAge) const
+{
+	struct FOutstandingContextInfo
+	{
+		int32 Count = 0;
+		double OldestAge = 0.0;
+	};
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	TMap<FName, FOutstandingContextInfo> InfoByAbility;
+	for (const TPair<TWeakObjectPtr<UAbleAbilityContext>, double>& Entry : m_OutstandingContexts)
+	{
+		const UAbleAbilityContext* Context = Entry.Key.Get();
+		const double Age = CurrentTime - Entry.Value;
+		if (!Context || Age < MinAge)
 		{
-			return;
+			continue;
 		}
+
+		const UAbleAbility* Ability = Context->GetAbility();
+		FOutstandingContextInfo& Info = InfoByAbility.FindOrAdd(Ability ? Ability->GetFName() : NAME_None);
+		++Info.Count;
+		Info.OldestAge = FMath::Max(Info.OldestAge, Age);
 	}
 
-	m_AvailableContexts.Push(Context);
+	for (const TPair<FName, FOutstandingContextInfo>& Entry : InfoByAbility)
+	{
+		UE_LOG(LogAbleSP, Warning, TEXT("Ability [%s] has %d Context(s) checked out for more than %.1f seconds (oldest %.1f seconds). Possible leak."), *Entry.Key.ToString(), Entry.Value.Count, MinAge, Entry.Value.OldestAge);
+	}
 }
@@ -0,0 +1,478 @@
+// Copyright (c) Extra Life Studios, LLC. All rights reserved.
+
+#include "ableTargetingIndex.h"
+
+#include "AbleCoreSPPrivate.h"
+#include "ableSettings.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("AbleTargetingIndex::Query"), STAT_AbleTargetingIndex_Query, STATGROUP_Able);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Targeting Index Entries"), STAT_AbleTargetingIndex_NumEntries, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Index Queries"), STAT_AbleTargetingIndex_NumQueries, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Index Candidates"), STAT_AbleTargetingIndex_NumCandidates, STATGROUP_Able);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Index Moves"), STAT_AbleTargetingIndex_NumMoves, STATGROUP_Able);
+
+namespace AbleTargetingIndex
+{
+	/* Returns true if the sphere touches the box. */
+	FORCEINLINE bool SphereOverlapsBox(const FVector& Center, float RadiusSqr, const FVector& BoxOrigin, const FVector& BoxExtent)
+	{
+		const FVector Delta = (Center - BoxOrigin).GetAbs() - BoxExtent;
+		return Delta.ComponentMax(FVector::ZeroVector).SizeSquared() <= RadiusSqr;
+	}
+
+	/* Returns true if the oriented box touches the axis aligned one. Edge/edge axes aren't tested, so this can pass boxes that just miss each other at the corners. */
+	FORCEINLINE bool OrientedBoxOverlapsBox(const FVector& Center, const FVector Axes[3], const FVector& HalfExtents, const FVector& BoxOrigin, const FVector& BoxExtent)
+	{
+		const FVector Delta = BoxOrigin - Center;
+
+		// World axes.
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const float Projected = FMath::Abs(Axes[0][i]) * HalfExtents.X + FMath::Abs(Axes[1][i]) * HalfExtents.Y + FMath::Abs(Axes[2][i]) * HalfExtents.Z;
+			if (FMath::Abs(Delta[i]) > BoxExtent[i] + Projected)
+			{
+				return false;
+			}
+		}
+
+		// Our axes.
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const float Projected = BoxExtent.X * FMath::Abs(Axes[i].X) + BoxExtent.Y * FMath::Abs(Axes[i].Y) + BoxExtent.Z * FMath::Abs(Axes[i].Z);
+			if (FMath::Abs(FVector::DotProduct(Delta, Axes[i])) > HalfExtents[i] + Projected)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+UAbleTargetingIndex::UAbleTargetingIndex()
+	: m_CellSize(1000.0f),
+	m_InvCellSize(1.0f / 1000.0f),
+	m_MaxExtent(0.0f),
+	m_IndexedObjectTypes(0)
+{
+
+}
+
+UAbleTargetingIndex::~UAbleTargetingIndex()
+{
+
+}
+
+bool UAbleTargetingIndex::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	const USPAbleSettings* Settings = GetDefault<USPAbleSettings>();
+	return Settings && Settings->GetUseTargetingIndex();
+}
+
+void UAbleTargetingIndex::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const USPAbleSettings* Settings = GetDefault<USPAbleSettings>();
+	m_CellSize = FMath::Max(Settings ? Settings->GetTargetingIndexCellSize() : 1000.0f, 100.0f);
+	m_InvCellSize = 1.0f / m_CellSize;
+	m_MaxExtent = 0.0f;
+
+	m_IndexedObjectTypes = 0;
+	if (Settings)
+	{
+		for (const TEnumAsByte<ECollisionChannel>& ObjectType : Settings->GetTargetingIndexObjectTypes())
+		{
+			m_IndexedObjectTypes |= ECC_TO_BITFIELD(ObjectType.GetValue());
+		}
+	}
+
+	// We only answer for our object types if every Actor with them is in here, not just the ones with an Ability Component.
+	if (UWorld* World = GetWorld())
+	{
+		m_ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UAbleTargetingIndex::OnActorSpawned));
+	}
+	m_ActorsInitializedHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(this, &UAbleTargetingIndex::OnActorsInitialized);
+	m_LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UAbleTargetingIndex::OnLevelAdded);
+}
+
+void UAbleTargetingIndex::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(m_ActorSpawnedHandle);
+	}
+	FWorldDelegates::OnWorldInitializedActors.Remove(m_ActorsInitializedHandle);
+	FWorldDelegates::LevelAddedToWorld.Remove(m_LevelAddedHandle);
+
+	for (FAbleTargetingIndexEntry& Entry : m_Entries)
+	{
+		if (USceneComponent* Component = Entry.Component.Get())
+		{
+			Component->TransformUpdated.Remove(Entry.MovedHandle);
+		}
+	}
+
+	for (const TPair<FObjectKey, FObjectKey>& ActorComponent : m_ActorComponents)
+	{
+		if (AActor* Actor = Cast<AActor>(ActorComponent.Key.ResolveObjectPtr()))
+		{
+			Actor->OnEndPlay.RemoveDynamic(this, &UAbleTargetingIndex::OnActorEndPlay);
+		}
+	}
+
+	DEC_DWORD_STAT_BY(STAT_AbleTargetingIndex_NumEntries, m_Entries.Num());
+
+	m_Entries.Empty();
+	m_EntryLookup.Empty();
+	m_ActorComponents.Empty();
+	m_Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+UAbleTargetingIndex* UAbleTargetingIndex::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UAbleTargetingIndex>() : nullptr;
+}
+
+bool UAbleTargetingIndex::AddActor(AActor& Actor, bool bIncludeRoot)
+{
+	check(IsInGameThread());
+
+	if (Actor.IsPendingKill())
+	{
+		return false;
+	}
+
+	const USceneComponent* Root = Actor.GetRootComponent();
+	for (UActorComponent* ActorComponent : Actor.GetComponents())
+	{
+		UPrimitiveComponent* Component = Cast<UPrimitiveComponent>(ActorComponent);
+		if (!Component || !Component->IsRegistered())
+		{
+			continue;
+		}
+
+		// The root can switch into one of our types later (and Ability Components ask for it), anything else has to be one of them now.
+		if ((bIncludeRoot && Component == Root) || (ECC_TO_BITFIELD(Component->GetCollisionObjectType()) & m_IndexedObjectTypes))
+		{
+			AddComponent(Actor, *Component);
+		}
+	}
+
+	if (!m_ActorComponents.Contains(FObjectKey(&Actor)))
+	{
+		return false;
+	}
+
+	Actor.OnEndPlay.AddUniqueDynamic(this, &UAbleTargetingIndex::OnActorEndPlay);
+	return true;
+}
+
+void UAbleTargetingIndex::AddComponent(AActor& Actor, UPrimitiveComponent& Component)
+{
+	const FObjectKey ComponentKey(&Component);
+	if (m_EntryLookup.Contains(ComponentKey))
+	{
+		return;
+	}
+
+	const int32 EntryIndex = m_Entries.AddDefaulted();
+	FAbleTargetingIndexEntry& Entry = m_Entries[EntryIndex];
+	Entry.Actor = &Actor;
+	Entry.ComponentKey = ComponentKey;
+	Entry.Component = &Component;
+	Entry.MovedHandle = Component.TransformUpdated.AddUObject(this, &UAbleTargetingIndex::OnComponentMoved);
+	Entry.BoundsOrigin = Component.Bounds.Origin;
+	Entry.BoundsExtent = Component.Bounds.BoxExtent;
+	Entry.Cell = GetCell(Entry.BoundsOrigin);
+
+	m_EntryLookup.Add(ComponentKey, EntryIndex);
+	m_ActorComponents.Add(FObjectKey(&Actor), ComponentKey);
+	m_MaxExtent = FMath::Max3(m_MaxExtent, Entry.BoundsExtent.X, Entry.BoundsExtent.Y);
+	AddToCell(EntryIndex);
+
+	INC_DWORD_STAT(STAT_AbleTargetingIndex_NumEntries);
+}
+
+void UAbleTargetingIndex::RemoveActor(AActor& Actor)
+{
+	check(IsInGameThread());
+
+	const FObjectKey ActorKey(&Actor);
+	TArray<FObjectKey, TInlineAllocator<4>> ComponentKeys;
+	m_ActorComponents.MultiFind(ActorKey, ComponentKeys);
+	if (!ComponentKeys.Num())
+	{
+		return;
+	}
+
+	m_ActorComponents.Remove(ActorKey);
+	Actor.OnEndPlay.RemoveDynamic(this, &UAbleTargetingIndex::OnActorEndPlay);
+
+	for (const FObjectKey& ComponentKey : ComponentKeys)
+	{
+		int32 EntryIndex = INDEX_NONE;
+		if (m_EntryLookup.RemoveAndCopyValue(ComponentKey, EntryIndex))
+		{
+			RemoveEntry(EntryIndex);
+		}
+	}
+}
+
+void UAbleTargetingIndex::RemoveEntry(int32 EntryIndex)
+{
+	if (USceneComponent* Component = m_Entries[EntryIndex].Component.Get())
+	{
+		Component->TransformUpdated.Remove(m_Entries[EntryIndex].MovedHandle);
+	}
+	RemoveFromCell(EntryIndex);
+
+	// Move our last entry into the hole, which means re-filing it under its new index.
+	const int32 LastIndex = m_Entries.Num() - 1;
+	if (EntryIndex != LastIndex)
+	{
+		RemoveFromCell(LastIndex);
+		m_Entries.RemoveAtSwap(EntryIndex, 1, false);
+		AddToCell(EntryIndex);
+		m_EntryLookup.Add(m_Entries[EntryIndex].ComponentKey, EntryIndex);
+	}
+	else
+	{
+		m_Entries.RemoveAt(EntryIndex, 1, false);
+	}
+
+	DEC_DWORD_STAT(STAT_AbleTargetingIndex_NumEntries);
+}
+
+void UAbleTargetingIndex::AddLevelActors(const ULevel* Level)
+{
+	if (!Level)
+	{
+		return;
+	}
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (Actor)
+		{
+			AddActor(*Actor, false);
+		}
+	}
+}
+
+void UAbleTargetingIndex::OnActorSpawned(AActor* Actor)
+{
+	if (Actor)
+	{
+		AddActor(*Actor, false);
+	}
+}
+
+void UAbleTargetingIndex::OnActorsInitialized(const UWorld::FActorsInitializedParams& Params)
+{
+	if (Params.World != GetWorld())
+	{
+		return;
+	}
+
+	for (const ULevel* Level : Params.World->GetLevels())
+	{
+		AddLevelActors(Level);
+	}
+}
+
+void UAbleTargetingIndex::OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (World == GetWorld())
+	{
+		AddLevelActors(Level);
+	}
+}
+
+void UAbleTargetingIndex::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	if (Actor)
+	{
+		RemoveActor(*Actor);
+	}
+}
+
+void UAbleTargetingIndex::OnComponentMoved(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	if (const int32* EntryIndex = m_EntryLookup.Find(FObjectKey(Component)))
+	{
+		UpdateEntry(*EntryIndex);
+	}
+}
+
+void UAbleTargetingIndex::UpdateEntry(int32 EntryIndex)
+{
+	FAbleTargetingIndexEntry& Entry = m_Entries[EntryIndex];
+	const USceneComponent* Component = Entry.Component.Get();
+	if (!Component)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_AbleTargetingIndex_NumMoves);
+
+	Entry.BoundsOrigin = Component->Bounds.Origin;
+	Entry.BoundsExtent = Component->Bounds.BoxExtent;
+	m_MaxExtent = FMath::Max3(m_MaxExtent, Entry.BoundsExtent.X, Entry.BoundsExtent.Y);
+
+	const FIntPoint NewCell = GetCell(Entry.BoundsOrigin);
+	if (NewCell != Entry.Cell)
+	{
+		RemoveFromCell(EntryIndex);
+		Entry.Cell = NewCell;
+		AddToCell(EntryIndex);
+	}
+}
+
+void UAbleTargetingIndex::AddToCell(int32 EntryIndex)
+{
+	m_Cells.FindOrAdd(m_Entries[EntryIndex].Cell).Add(EntryIndex);
+}
+
+void UAbleTargetingIndex::RemoveFromCell(int32 EntryIndex)
+{
+	const FIntPoint& Cell = m_Entries[EntryIndex].Cell;
+	if (TArray<int32>* CellEntries = m_Cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex, false);
+		if (CellEntries->Num() == 0)
+		{
+			m_Cells.Remove(Cell);
+		}
+	}
+}
+
+template <typename VisitorType>
+void UAbleTargetingIndex::ForEachCandidate(const FBox& QueryBounds, int32 ObjectTypes, VisitorType Visitor) const
+{
+	INC_DWORD_STAT(STAT_AbleTargetingIndex_NumQueries);
+
+	if (!(ObjectTypes & m_IndexedObjectTypes) || m_Cells.Num() == 0)
+	{
+		return;
+	}
+
+	const FIntPoint MinCell = GetCell(QueryBounds.Min - FVector(m_MaxExtent, m_MaxExtent, 0.0f));
+	const FIntPoint MaxCell = GetCell(QueryBounds.Max + FVector(m_MaxExtent, m_MaxExtent, 0.0f));
+	const int64 NumQueryCells = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	auto VisitCell = [this, ObjectTypes, &Visitor](const TArray<int32>& CellEntries)
+	{
+		for (const int32 EntryIndex : CellEntries)
+		{
+			const FAbleTargetingIndexEntry& Entry = m_Entries[EntryIndex];
+			const UPrimitiveComponent* Component = Entry.Component.Get();
+
+			// Collision can be switched off or the object type changed at any time (death, ragdoll, etc), so check it as physics would.
+			if (Component && Entry.Actor.IsValid() && Component->IsQueryCollisionEnabled() && (ECC_TO_BITFIELD(Component->GetCollisionObjectType()) & ObjectTypes))
+			{
+				INC_DWORD_STAT(STAT_AbleTargetingIndex_NumCandidates);
+				Visitor(Entry);
+			}
+		}
+	};
+
+	// Big queries in a sparse grid, cheaper to just walk what we have.
+	if (NumQueryCells > m_Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32>>& Cell : m_Cells)
+		{
+			if (Cell.Key.X >= MinCell.X && Cell.Key.X <= MaxCell.X && Cell.Key.Y >= MinCell.Y && Cell.Key.Y <= MaxCell.Y)
+			{
+				VisitCell(Cell.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			if (const TArray<int32>* CellEntries = m_Cells.Find(FIntPoint(X, Y)))
+			{
+				VisitCell(*CellEntries);
+			}
+		}
+	}
+}
+
+void UAbleTargetingIndex::QuerySphere(const FVector& Center, float Radius, int32 ObjectTypes, TArray<TWeakObjectPtr<AActor>>& OutActors) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbleTargetingIndex_Query);
+
+	const float RadiusSqr = Radius * Radius;
+	ForEachCandidate(FBox(Center - FVector(Radius), Center + FVector(Radius)), ObjectTypes, [&](const FAbleTargetingIndexEntry& Entry)
+	{
+		if (AbleTargetingIndex::SphereOverlapsBox(Center, RadiusSqr, Entry.BoundsOrigin, Entry.BoundsExtent))
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
+
+void UAbleTargetingIndex::QueryBox(const FTransform& Transform, const FVector& HalfExtents, int32 ObjectTypes, TArray<TWeakObjectPtr<AActor>>& OutActors) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbleTargetingIndex_Query);
+
+	const FQuat Rotation = Transform.GetRotation();
+	const FVector Center = Transform.GetLocation();
+	const FVector Axes[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
+
+	const FVector WorldExtent(
+		FMath::Abs(Axes[0].X) * HalfExtents.X + FMath::Abs(Axes[1].X) * HalfExtents.Y + FMath::Abs(Axes[2].X) * HalfExtents.Z,
+		FMath::Abs(Axes[0].Y) * HalfExtents.X + FMath::Abs(Axes[1].Y) * HalfExtents.Y + FMath::Abs(Axes[2].Y) * HalfExtents.Z,
+		FMath::Abs(Axes[0].Z) * HalfExtents.X + FMath::Abs(Axes[1].Z) * HalfExtents.Y + FMath::Abs(Axes[2].Z) * HalfExtents.Z);
+
+	ForEachCandidate(FBox(Center - WorldExtent, Center + WorldExtent), ObjectTypes, [&](const FAbleTargetingIndexEntry& Entry)
+	{
+		if (AbleTargetingIndex::OrientedBoxOverlapsBox(Center, Axes, HalfExtents, Entry.BoundsOrigin, Entry.BoundsExtent))
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
+
+void UAbleTargetingIndex::QueryCapsule(const FTransform& Transform, float Radius, float HalfHeight, int32 ObjectTypes, TArray<TWeakObjectPtr<AActor>>& OutActors) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AbleTargetingIndex_Query);
+
+	// Half Height includes the hemispheres.
+	const FVector SegmentOffset = Transform.GetRotation().GetAxisZ() * FMath::Max(HalfHeight - Radius, 0.0f);
+	const FVector SegmentStart = Transform.GetLocation() - SegmentOffset;
+	const FVector SegmentEnd = Transform.GetLocation() + SegmentOffset;
+	const float RadiusSqr = Radius * Radius;
+
+	FBox QueryBounds(SegmentStart.ComponentMin(SegmentEnd), SegmentStart.ComponentMax(SegmentEnd));
+	QueryBounds = QueryBounds.ExpandBy(Radius);
+
+	ForEachCandidate(QueryBounds, ObjectTypes, [&](const FAbleTargetingIndexEntry& Entry)
+	{
+		const FVector Nearest = FMath::ClosestPointOnSegment(Entry.BoundsOrigin, SegmentStart, SegmentEnd);
+		if (AbleTargetingIndex::SphereOverlapsBox(Nearest, RadiusSqr, Entry.BoundsOrigin, Entry.BoundsExtent))
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
@@ -0,0 +1,119 @@
+---@class SPAbilityCollisionDamageTask : USPAbilityTask
+local SPAbilityCollisionDamageTask = UE4.Class(nil, "SPAbilityCollisionDamageTask")
+
+local SPAbilityUtils = require("Feature.StarP.Script.System.Ability.SPAbilityUtils")
+
+local IsValid = _SP.IsValid
+local tonumber = tonumber
+local string_format = string.format
+
+local function Warning(...)
+    _SP.LogWarning("SPAbility", "[SPAbilityCollisionDamageTask]", ...)
+end
+
+function SPAbilityCollisionDamageTask:OnInterruptBP(Context)
+    local AbilityComponent = Context:GetSelfAbilityComponent()
+    if not IsValid(AbilityComponent) then
+        return
+    end
+
+    AbilityComponent:InterruptedAbility(Context:GetAbilityId(), "interrupt on collision post collision")
+    if self.m_ComboAbilityId ~= 0 then
+        AbilityComponent:TryActivateAbility(self.m_ComboAbilityId, Context:GetOwner(), Context:GetInstigator(), false)
+    end
+end
+
+function SPAbilityCollisionDamageTask:GetDamageId(Context)
+    if self.m_DamageId ~= -1 then
+        return self.m_DamageId
+    end
+
+    local AbilityId = Context:GetAbilityId()
+    local AbilityData = _SP.SPGameplayUtils:GetSkillData(AbilityId)
+    if not AbilityData then
+        return -1
+    end
+
+    local DamageIds = AbilityData.damageIds or {}
+    local DamageId = tonumber(DamageIds[self.m_DamageIndex + 1])
+    if DamageId == nil then
+        Warning("Ability Damage Config Error ", string_format("Ability [%s] config DamageIndex [%s], damage list length = [%s]", AbilityId, self.m_DamageIndex, #DamageIds))
+        return -1
+    end
+    return DamageId
+end
+
+function SPAbilityCollisionDamageTask:CheckPerfectDodge(ScratchPad, DamageConfig, DamageResult)
+    local HitActor = DamageResult.HitResult.Actor
+    if not IsValid(HitActor) or not HitActor:IsA(UE4.ASPGameCharacterBase) then
+        return
+    end
+    if not DamageConfig or not DamageConfig.canTriggerPerfectDodge or DamageConfig.canTriggerPerfectDodge <= 0 then
+        return
+    end
+    if not ScratchPad.CanTriggerPerfectDodge then
+        return
+    end
+
+    local PerfectDodgeComponent = HitActor:GetComponentByClass(UE4.USPPerfectDodgeComponent:StaticClass())
+    if IsValid(PerfectDodgeComponent) and PerfectDodgeComponent:GetPerfectDodgeCheckTime() then
+        if DamageConfig.canTriggerPerfectDodge == SPAbilityUtils.ESPCollisionTriggerDodgeType.Once then
+            ScratchPad.CanTriggerPerfectDodge = false
+        end
+        DamageResult.bPerfectDodge = true
+    end
+end
+
+---Builds the damage for DamageTargets and hands it to the Instigator's ability damage component.
+---Shared with SPAbilityLaserTask, so only uses what both Tasks and their Scratch Pads expose.
+function SPAbilityCollisionDamageTask:DoDamage(Context, DamageTargets)
+    local Owner = Context:GetOwner()
+    local Instigator = Context:GetInstigator() or Owner
+    local AbilityDamageComponent = UE4.USPAbilityFunctionLibrary.GetAbilityDamageComponent(Instigator)
+    if not IsValid(AbilityDamageComponent) then
+        return
+    end
+
+    local ScratchPad = self:GetScratchPad(Context)
+    local DamageId = SPAbilityCollisionDamageTask.GetDamageId(self, Context)
+    local DamageConfig = _SP.SPConfigManager:GetConfigById("SPDamageConfigTable", "SPDamageConfig", DamageId)
+
+    ---@type USPAbilityDamage
+    local DamageInfo = UE4.USPAbilityDamage.MakeDamage(AbilityDamageComponent)
+    DamageInfo.HighPingPawns = Context:GetHighPingPawns()
+
+    local Struct = UE4.FSPAbilityDamageStruct()
+    Struct.AbilityId = Context:GetAbilityId()
+    Struct.DamageId = DamageId
+    Struct.Owner = Owner
+    Struct.Instigator = Instigator
+    Struct.Orientation = ScratchPad and ScratchPad.QueryTransform.Rotation:ToRotator() or Owner:K2_GetActorRotation()
+    Struct.UniqueID = Context:GetAbilityUniqueID()
+    Struct.bForceTrustServer = (self.m_DamageForceTrustServer or self.m_HitAndBranchSegment) == true -- branching needs the server's word
+
+    for i = 1, DamageTargets:Length() do
+        local Target = DamageTargets:Get(i)
+        local HitResult = UE4.FHitResult()
+        HitResult.Actor = Target.Actor
+        HitResult.Component = Target.PrimitiveComponent
+        HitResult.ImpactPoint = Target.Actor:K2_GetActorLocation()
+
+        ---@type FSPAbilityDamageResult
+        local DamageResult = UE4.FSPAbilityDamageResult()
+        DamageResult.HitResult = HitResult
+        if ScratchPad then
+            SPAbilityCollisionDamageTask.CheckPerfectDodge(self, ScratchPad, DamageConfig, DamageResult)
+        end
+
+        Struct.DamageArray:Add(DamageResult)
+    end
+
+    DamageInfo:SetStruct(Struct)
+    AbilityDamageComponent:DoDamage(DamageInfo)
+end
+
+function SPAbilityCollisionDamageTask:OnDamageTargetsBP(Context, DamageTargets)
+    SPAbilityCollisionDamageTask.DoDamage(self, Context, DamageTargets)
+end
+
+return SPAbilityCollisionDamageTask
@@ -0,0 +1,10 @@
+---@class SPAbilityLaserTask : USPAbilityTask
+local SPAbilityLaserTask = UE4.Class(nil, "SPAbilityLaserTask")
+
+local SPAbilityCollisionDamageTask = require("Feature.StarP.Script.System.Ability.Task.SPAbilityCollisionDamageTask")
+
+function SPAbilityLaserTask:OnDamageTargetsBP(Context, DamageTargets)
+    SPAbilityCollisionDamageTask.DoDamage(self, Context, DamageTargets)
+end
+
+return SPAbilityLaserTask